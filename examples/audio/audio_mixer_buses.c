@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Mixer buses and effects
+*
+*   Music, sound effects and voice are mixed into their own bus, every bus has its own
+*   effects chain processed by the mixer: low-pass filter, reverb and ducking
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+// Set music bus effects chain: low-pass filter (muffled music) and ducking while voice plays
+static void SetMusicBusEffects(bool lowpass, bool ducking)
+{
+    ClearAudioBusEffects(AUDIO_BUS_MUSIC);
+
+    if (lowpass) AddAudioBusEffect(AUDIO_BUS_MUSIC, AUDIO_EFFECT_LOWPASS, 600.0f, 0.7071f);
+    if (ducking) AddAudioBusEffect(AUDIO_BUS_MUSIC, AUDIO_EFFECT_DUCKING, AUDIO_BUS_VOICE, 0.2f);
+}
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - mixer buses and effects");
+
+    InitAudioDevice();              // Initialize audio device
+
+    Music music = LoadMusicStream("resources/guitar_noodling.ogg");     // Mixed into AUDIO_BUS_MUSIC by default
+    Sound fxCoin = LoadSound("resources/coin.wav");                     // Mixed into AUDIO_BUS_SFX by default
+    Sound voice = LoadSound("resources/sound.wav");
+
+    SetSoundBus(voice, AUDIO_BUS_VOICE);
+
+    bool lowpass = false;
+    bool reverb = false;
+    bool ducking = true;
+
+    SetMusicBusEffects(lowpass, ducking);
+
+    // Limiter keeps voice peaks under -1 dB
+    AddAudioBusEffect(AUDIO_BUS_VOICE, AUDIO_EFFECT_LIMITER, -1.0f, 50.0f);
+
+    PlayMusicStream(music);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateMusicStream(music);   // Update music buffer with new stream data
+
+        if (IsKeyPressed(KEY_SPACE)) PlaySoundMulti(fxCoin);
+        if (IsKeyPressed(KEY_ENTER)) PlaySound(voice);
+
+        // Toggle buses effects, effects chains are rebuilt on change
+        if (IsKeyPressed(KEY_ONE))
+        {
+            lowpass = !lowpass;
+            SetMusicBusEffects(lowpass, ducking);
+        }
+
+        if (IsKeyPressed(KEY_TWO))
+        {
+            ducking = !ducking;
+            SetMusicBusEffects(lowpass, ducking);
+        }
+
+        if (IsKeyPressed(KEY_THREE))
+        {
+            reverb = !reverb;
+
+            ClearAudioBusEffects(AUDIO_BUS_SFX);
+            if (reverb) AddAudioBusEffect(AUDIO_BUS_SFX, AUDIO_EFFECT_REVERB, 0.85f, 0.4f);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("PRESS SPACE TO PLAY SOUND EFFECT (SFX BUS)", 160, 80, 20, LIGHTGRAY);
+            DrawText("PRESS ENTER TO PLAY VOICE (VOICE BUS)", 190, 110, 20, LIGHTGRAY);
+
+            DrawText(TextFormat("[1] MUSIC LOW-PASS FILTER: %s", lowpass? "ON" : "OFF"), 190, 170, 20, lowpass? MAROON : GRAY);
+            DrawText(TextFormat("[2] MUSIC DUCKING ON VOICE: %s", ducking? "ON" : "OFF"), 190, 200, 20, ducking? MAROON : GRAY);
+            DrawText(TextFormat("[3] SOUND EFFECTS REVERB: %s", reverb? "ON" : "OFF"), 190, 230, 20, reverb? MAROON : GRAY);
+
+            // Buses mixing and effects processing time, relative to audio duration
+            DrawText(TextFormat("SFX bus CPU: %.3f %%", GetAudioBusCpuUsage(AUDIO_BUS_SFX)*100.0f), 190, 300, 20, DARKGRAY);
+            DrawText(TextFormat("MUSIC bus CPU: %.3f %%", GetAudioBusCpuUsage(AUDIO_BUS_MUSIC)*100.0f), 190, 330, 20, DARKGRAY);
+            DrawText(TextFormat("VOICE bus CPU: %.3f %%", GetAudioBusCpuUsage(AUDIO_BUS_VOICE)*100.0f), 190, 360, 20, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMusicStream(music);   // Unload music stream buffers from RAM
+    UnloadSound(fxCoin);        // Unload sound data
+    UnloadSound(voice);         // Unload sound data
+
+    CloseAudioDevice();         // Close audio device (buses effects are released)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
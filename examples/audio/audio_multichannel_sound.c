@@ -28,6 +28,9 @@ int main(void)
     Sound fxOgg = LoadSound("resources/tanatana.ogg");      // Load OGG audio file
     
     SetSoundVolume(fxWav, 0.2);
+    SetSoundPriority(fxOgg, 1);     // Ogg instances are never replaced by wav instances
+
+    SetAudioVoicesBudget(8);        // Only 8 sounds mixed at the same time, others keep playing silently
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -52,6 +55,7 @@ int main(void)
             DrawText("Press ENTER to play new wav instance!", 200, 180, 20, LIGHTGRAY);
 
             DrawText(FormatText("CONCURRENT SOUNDS PLAYING: %02i", GetSoundsPlaying()), 220, 280, 20, RED);
+            DrawText(FormatText("MIXED: %02i / VIRTUAL: %02i", GetAudioVoicesMixed(), GetAudioVoicesVirtual()), 250, 320, 20, MAROON);
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -55,6 +55,16 @@ int main(void)
             else ResumeMusicStream(music);
         }
 
+        // Seek music backward/forward 5 seconds
+        if (IsKeyPressed(KEY_LEFT)) SeekMusicStream(music, GetMusicTimePlayed(music) - 5.0f);
+        else if (IsKeyPressed(KEY_RIGHT)) SeekMusicStream(music, GetMusicTimePlayed(music) + 5.0f);
+
+        // Seek music to clicked position on time bar
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(GetMousePosition(), (Rectangle){ 200, 200, 400, 12 }))
+        {
+            SeekMusicStream(music, (GetMouseX() - 200)/400.0f*GetMusicTimeLength(music));
+        }
+
         // Get timePlayed scaled to bar dimensions (400 pixels)
         timePlayed = GetMusicTimePlayed(music)/GetMusicTimeLength(music)*400;
 
@@ -75,6 +85,7 @@ int main(void)
 
             DrawText("PRESS SPACE TO RESTART MUSIC", 215, 250, 20, LIGHTGRAY);
             DrawText("PRESS P TO PAUSE/RESUME MUSIC", 208, 280, 20, LIGHTGRAY);
+            DrawText("PRESS LEFT/RIGHT OR CLICK THE BAR TO SEEK MUSIC", 115, 310, 20, LIGHTGRAY);
 
         EndDrawing();
         //----------------------------------------------------------------------------------
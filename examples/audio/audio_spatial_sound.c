@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Spatial 3d sound
+*
+*   Music is played by an emitter orbiting the scene, sound effects are played from the cube
+*   positions: listener follows camera, emitters are panned, attenuated by distance and
+*   pitched by doppler effect on every UpdateAudioListener() call
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>       // Required for: sinf(), cosf()
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - spatial 3d sound");
+
+    InitAudioDevice();              // Initialize audio device
+
+    Music music = LoadMusicStream("resources/guitar_noodling.ogg");
+    Sound fxCoin = LoadSound("resources/coin.wav");
+
+    // Define the camera to look into our 3d world, audio listener follows it
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 0.0f, 2.0f, 10.0f };
+    camera.target = (Vector3){ 0.0f, 2.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 60.0f;
+    camera.type = CAMERA_PERSPECTIVE;
+
+    SetCameraMode(camera, CAMERA_FIRST_PERSON);
+
+    // Emitters get quieter from 2 to 40 units away from listener
+    SetAudioAttenuation(AUDIO_ATTENUATION_INVERSE, 2.0f, 40.0f, 1.0f);
+
+    Vector3 cubes[3] = { { -8.0f, 1.0f, -4.0f }, { 0.0f, 1.0f, -12.0f }, { 8.0f, 1.0f, -4.0f } };
+    int currentCube = 0;
+
+    float angle = 0.0f;
+    Vector3 musicPosition = { 0 };
+
+    PlayMusicStream(music);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera);      // Update camera
+        UpdateMusicStream(music);   // Update music buffer with new stream data
+
+        // Music emitter orbits the scene fast enough to notice doppler effect
+        angle += 1.5f*GetFrameTime();
+        musicPosition = (Vector3){ 12.0f*cosf(angle), 2.0f, 12.0f*sinf(angle) };
+        SetMusicPosition(music, musicPosition);
+
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            SetSoundPosition(fxCoin, cubes[currentCube]);
+            PlaySoundMulti(fxCoin);
+
+            currentCube = (currentCube + 1)%3;
+        }
+
+        // All emitters 3d audio parameters are sent to mixer at once
+        UpdateAudioListener(camera);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawPlane((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector2){ 32.0f, 32.0f }, LIGHTGRAY);
+
+                for (int i = 0; i < 3; i++)
+                {
+                    DrawCube(cubes[i], 2.0f, 2.0f, 2.0f, (i == currentCube)? GOLD : GRAY);
+                    DrawCubeWires(cubes[i], 2.0f, 2.0f, 2.0f, DARKGRAY);
+                }
+
+                DrawSphere(musicPosition, 0.5f, MAROON);
+
+            EndMode3D();
+
+            DrawText("MOVE AROUND WITH WASD AND MOUSE TO HEAR EMITTERS", 10, 10, 20, DARKGRAY);
+            DrawText("PRESS SPACE TO PLAY SOUND ON NEXT CUBE", 10, 40, 20, DARKGRAY);
+
+            DrawFPS(10, 420);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMusicStream(music);   // Unload music stream buffers from RAM
+    UnloadSound(fxCoin);        // Unload sound data
+
+    CloseAudioDevice();         // Close audio device
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Ray picking benchmark (mesh BVH and batched rays)
+*
+*   This example has been created using raylib 3.0 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   NOTE: Model meshes bounding volume hierarchy (BVH) is generated once, rays are checked
+*   in mesh local space, brute force check (all triangles) is timed for comparison
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include <stdlib.h>
+#include "raylib.h"
+#include "raymath.h"
+
+#define RAYS_GRID_SIZE      48      // Batched rays grid size (RAYS_GRID_SIZE*RAYS_GRID_SIZE rays)
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - ray picking benchmark");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 50.0f, 50.0f, 50.0f }; // Camera position
+    camera.target = (Vector3){ 0.0f, 10.0f, 0.0f };     // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.type = CAMERA_PERSPECTIVE;                   // Camera mode type
+
+    Model model = LoadModel("resources/models/castle.obj");                 // Load OBJ model
+    Texture2D texture = LoadTexture("resources/models/castle_diffuse.png"); // Load model texture
+    model.materials[0].maps[MAP_DIFFUSE].texture = texture;                 // Set model diffuse texture
+
+    int triangleCount = 0;
+    for (int i = 0; i < model.meshCount; i++) triangleCount += (model.meshes[i].indices != NULL)? model.meshes[i].triangleCount : model.meshes[i].vertexCount/3;
+
+    // Generate meshes BVH (required to speed-up ray checks, otherwise all triangles are checked)
+    double time = GetTime();
+    for (int i = 0; i < model.meshCount; i++) GenMeshBVH(&model.meshes[i]);
+    double bvhTime = (GetTime() - time)*1000.0;
+
+    const int rayCount = RAYS_GRID_SIZE*RAYS_GRID_SIZE;
+    Ray *rays = (Ray *)RL_MALLOC(rayCount*sizeof(Ray));
+    RayHitInfo *hits = (RayHitInfo *)RL_MALLOC(rayCount*sizeof(RayHitInfo));
+
+    double singleTime = 0.0;        // Single ray check time (BVH)
+    double bruteTime = 0.0;         // Single ray check time (brute force)
+    double batchTime = 0.0;         // Batched rays check time
+    int hitCount = 0;
+
+    SetCameraMode(camera, CAMERA_FREE); // Set a free camera mode
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera);
+
+        // Single ray picking (mouse)
+        Ray ray = GetMouseRay(GetMousePosition(), camera);
+
+        time = GetTime();
+        RayHitInfo mouseHit = GetCollisionRayModel(ray, model);
+        singleTime = (GetTime() - time)*1000.0;
+
+        // Brute force check, using mesh copies without BVH
+        time = GetTime();
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            Mesh mesh = model.meshes[i];
+            mesh.bvh = NULL;
+            GetCollisionRayMesh(ray, mesh, model.transform);
+        }
+        bruteTime = (GetTime() - time)*1000.0;
+
+        // Batched rays, grid of rays covering the screen
+        for (int y = 0; y < RAYS_GRID_SIZE; y++)
+        {
+            for (int x = 0; x < RAYS_GRID_SIZE; x++)
+            {
+                Vector2 position = { (x + 0.5f)*screenWidth/RAYS_GRID_SIZE, (y + 0.5f)*screenHeight/RAYS_GRID_SIZE };
+                rays[y*RAYS_GRID_SIZE + x] = GetMouseRay(position, camera);
+            }
+        }
+
+        time = GetTime();
+        GetCollisionRaysModel(rays, rayCount, model, hits);
+        batchTime = (GetTime() - time)*1000.0;
+
+        hitCount = 0;
+        for (int i = 0; i < rayCount; i++) if (hits[i].hit) hitCount++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawModel(model, (Vector3){ 0.0f, 0.0f, 0.0f }, 1.0f, WHITE);
+
+                for (int i = 0; i < rayCount; i++)
+                {
+                    if (hits[i].hit) DrawCube(hits[i].position, 0.3f, 0.3f, 0.3f, Fade(RED, 0.6f));
+                }
+
+                if (mouseHit.hit)
+                {
+                    DrawCube(mouseHit.position, 0.6f, 0.6f, 0.6f, GREEN);
+                    DrawLine3D(mouseHit.position, Vector3Add(mouseHit.position, Vector3Scale(mouseHit.normal, 4.0f)), DARKGREEN);
+                }
+
+                DrawGrid(10, 10.0f);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 360, 100, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 360, 100, BLUE);
+
+            DrawText(FormatText("MODEL TRIANGLES: %i (BVH generated in %.2f ms)", triangleCount, bvhTime), 20, 20, 10, BLACK);
+            DrawText(FormatText("SINGLE RAY (BVH): %.4f ms", singleTime), 20, 40, 10, BLACK);
+            DrawText(FormatText("SINGLE RAY (BRUTE FORCE): %.4f ms", bruteTime), 20, 55, 10, BLACK);
+            DrawText(FormatText("BATCHED RAYS: %i rays in %.3f ms (%i hits)", rayCount, batchTime, hitCount), 20, 75, 10, MAROON);
+            DrawText(FormatText("RAYS PER MS: %.0f", (batchTime > 0.0)? rayCount/batchTime : 0.0), 20, 90, 10, MAROON);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RL_FREE(rays);
+    RL_FREE(hits);
+
+    UnloadTexture(texture);     // Unload texture
+    UnloadModel(model);         // Unload model (and meshes BVH)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
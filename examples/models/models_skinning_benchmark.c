@@ -0,0 +1,319 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Skinning benchmark (CPU vs GPU skinning)
+*
+*   This example has been created using raylib 3.0 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   NOTE: CPU skinning is used when model material shader does not support skinning,
+*   a custom shader (without bones attributes) is used to force it
+*
+*   NOTE: Model mesh is too small to be split between worker threads (less vertices than
+*   skinning chunk size), on CPU skinning all instances are merged in a single crowd mesh
+*   (one skeleton per instance) so vertex ranges are processed in parallel
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define MAX_INSTANCES              64       // Max animated model instances
+#define MAX_THREADS                16       // Max threads selectable (including main thread)
+
+#define MESH_VBO_COUNT              9       // Mesh vertex buffers ids (same as raylib MAX_MESH_VBO)
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static Vector3 GetInstanceOffset(int instance);             // Get instance position offset (model space)
+static Model LoadModelCrowd(Model model, int instances);    // Load crowd model merging model instances (one skeleton per instance)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - skinning benchmark");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 20.0f, 20.0f, 20.0f }; // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };      // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.type = CAMERA_PERSPECTIVE;                   // Camera mode type
+
+    Model model = LoadModel("resources/guy/guy.iqm");               // Load the animated model mesh and basic data
+    Texture2D texture = LoadTexture("resources/guy/guytex.png");    // Load model texture and set material
+    SetMaterialTexture(&model.materials[0], MAP_DIFFUSE, texture);  // Set model material map texture
+
+    // Load animation data
+    int animsCount = 0;
+    ModelAnimation *anims = LoadModelAnimations("resources/guy/guyanim.iqm", &animsCount);
+
+    // Default shader supports GPU skinning (if available), custom shader forces CPU skinning
+    Shader cpuShader = LoadShader(FormatText("resources/shaders/glsl%i/base.vs", GLSL_VERSION),
+                                  FormatText("resources/shaders/glsl%i/base.fs", GLSL_VERSION));
+
+    int vertexCount = 0;
+    for (int i = 0; i < model.meshCount; i++) vertexCount += model.meshes[i].vertexCount;
+
+    int instances = 16;                 // Number of model instances animated (and drawn) per frame
+    int threads = GetWorkerThreadCount();
+    int frameCounter = 0;
+
+    // CPU skinning: all instances are skinned at once (crowd mesh), every instance with its own pose
+    Model crowd = LoadModelCrowd(model, instances);
+    crowd.materials[0].shader = cpuShader;
+    SetMaterialTexture(&crowd.materials[0], MAP_DIFFUSE, texture);
+
+    Transform *crowdPose = (Transform *)RL_MALLOC(MAX_INSTANCES*model.boneCount*sizeof(Transform));
+
+    bool cpuSkinning = true;
+
+    double skinningTime = 0.0;          // Accumulated skinning time (in seconds)
+    int skinningSamples = 0;            // Accumulated skinned instances
+    float verticesPerMs = 0.0f;         // Skinned vertices per millisecond (averaged)
+
+    SetCameraMode(camera, CAMERA_ORBITAL);  // Set orbital camera mode
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera);
+
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            cpuSkinning = !cpuSkinning;
+            skinningTime = 0.0;
+            skinningSamples = 0;
+        }
+
+        int previousInstances = instances;
+
+        if (IsKeyPressed(KEY_UP) && (instances < MAX_INSTANCES)) instances *= 2;
+        else if (IsKeyPressed(KEY_DOWN) && (instances > 1)) instances /= 2;
+
+        if (instances != previousInstances)
+        {
+            UnloadModel(crowd);
+            crowd = LoadModelCrowd(model, instances);
+            crowd.materials[0].shader = cpuShader;
+            SetMaterialTexture(&crowd.materials[0], MAP_DIFFUSE, texture);
+        }
+
+        if (IsKeyPressed(KEY_RIGHT) && (threads < MAX_THREADS)) threads++;
+        else if (IsKeyPressed(KEY_LEFT) && (threads > 1)) threads--;
+
+        if (threads != GetWorkerThreadCount())
+        {
+            SetWorkerThreadCount(threads);
+            threads = GetWorkerThreadCount();   // Could be limited by system
+            skinningTime = 0.0;
+            skinningSamples = 0;
+        }
+
+        frameCounter++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                // Every instance is animated with a different frame, measuring only animation update time
+                if (cpuSkinning)
+                {
+                    double time = GetTime();
+
+                    for (int i = 0; i < instances; i++)
+                    {
+                        Transform *pose = crowdPose + i*model.boneCount;
+                        Vector3 offset = GetInstanceOffset(i);
+
+                        GetModelAnimationPose(anims[0], (float)(frameCounter + i*7), pose);
+                        for (int b = 0; b < model.boneCount; b++) pose[b].translation = Vector3Add(pose[b].translation, offset);
+                    }
+
+                    UpdateModelAnimationPose(crowd, crowdPose);
+                    skinningTime += (GetTime() - time);
+                    skinningSamples += instances;
+
+                    DrawModelEx(crowd, (Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, -90.0f, (Vector3){ 1.0f, 1.0f, 1.0f }, WHITE);
+                }
+                else
+                {
+                    for (int i = 0; i < instances; i++)
+                    {
+                        double time = GetTime();
+                        UpdateModelAnimation(model, anims[0], frameCounter + i*7);
+                        skinningTime += (GetTime() - time);
+                        skinningSamples++;
+
+                        Vector3 position = { (float)(i%8)*4.0f - 14.0f, 0.0f, (float)(i/8)*4.0f - 14.0f };
+                        DrawModelEx(model, position, (Vector3){ 1.0f, 0.0f, 0.0f }, -90.0f, (Vector3){ 1.0f, 1.0f, 1.0f }, WHITE);
+                    }
+                }
+
+                DrawGrid(32, 1.0f);         // Draw a grid
+
+            EndMode3D();
+
+            if (skinningTime > 0.0) verticesPerMs = (float)((double)vertexCount*skinningSamples/(skinningTime*1000.0));
+
+            DrawRectangle(10, 10, 330, 113, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 330, 113, BLUE);
+
+            DrawText(FormatText("SKINNING: %s", cpuSkinning? "CPU (crowd mesh)" : "GPU"), 20, 20, 10, BLACK);
+            DrawText(FormatText("INSTANCES: %i (%i vertices each)", instances, vertexCount), 20, 35, 10, BLACK);
+            DrawText(FormatText("THREADS: %i", threads), 20, 50, 10, BLACK);
+            DrawText(FormatText("VERTICES SKINNED PER MS: %.0f", verticesPerMs), 20, 65, 10, MAROON);
+            DrawText("- SPACE to toggle CPU/GPU skinning", 20, 85, 10, DARKGRAY);
+            DrawText("- UP/DOWN instances, LEFT/RIGHT threads", 20, 100, 10, DARKGRAY);
+
+            DrawText("(c) Guy IQM 3D model by @culacant", screenWidth - 200, screenHeight - 20, 10, GRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RL_FREE(crowdPose);
+    UnloadModel(crowd);         // Unload crowd model (shader and texture are shared)
+
+    UnloadShader(cpuShader);    // Unload custom shader
+    UnloadTexture(texture);     // Unload texture
+
+    // Unload model animations data
+    for (int i = 0; i < animsCount; i++) UnloadModelAnimation(anims[i]);
+    RL_FREE(anims);
+
+    UnloadModel(model);         // Unload model
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+
+// Get instance position offset in model space
+// NOTE: Model is drawn rotated -90 degrees on X axis (Z-up), world Z axis is model -Y axis
+static Vector3 GetInstanceOffset(int instance)
+{
+    return (Vector3){ (float)(instance%8)*4.0f - 14.0f, 14.0f - (float)(instance/8)*4.0f, 0.0f };
+}
+
+// Load crowd model merging model meshes instances in a single mesh
+// NOTE: Every instance uses its own copy of the skeleton (bind pose moved to instance position),
+// so instance bones poses must be moved by the same offset
+static Model LoadModelCrowd(Model model, int instances)
+{
+    Mesh mesh = { 0 };
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        mesh.vertexCount += model.meshes[m].vertexCount*instances;
+        mesh.triangleCount += model.meshes[m].triangleCount*instances;
+    }
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.boneIds = (int *)RL_MALLOC(mesh.vertexCount*4*sizeof(int));
+    mesh.boneWeights = (float *)RL_MALLOC(mesh.vertexCount*4*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+    mesh.vboId = (unsigned int *)RL_CALLOC(MESH_VBO_COUNT, sizeof(unsigned int));
+
+    int vertexOffset = 0;
+    int indexOffset = 0;
+
+    for (int i = 0; i < instances; i++)
+    {
+        Vector3 offset = GetInstanceOffset(i);
+
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            Mesh source = model.meshes[m];
+
+            for (int v = 0; v < source.vertexCount; v++)
+            {
+                mesh.vertices[(vertexOffset + v)*3] = source.vertices[v*3] + offset.x;
+                mesh.vertices[(vertexOffset + v)*3 + 1] = source.vertices[v*3 + 1] + offset.y;
+                mesh.vertices[(vertexOffset + v)*3 + 2] = source.vertices[v*3 + 2] + offset.z;
+
+                for (int k = 0; k < 4; k++) mesh.boneIds[(vertexOffset + v)*4 + k] = source.boneIds[v*4 + k] + i*model.boneCount;
+            }
+
+            memcpy(mesh.normals + vertexOffset*3, source.normals, source.vertexCount*3*sizeof(float));
+            memcpy(mesh.texcoords + vertexOffset*2, source.texcoords, source.vertexCount*2*sizeof(float));
+            memcpy(mesh.boneWeights + vertexOffset*4, source.boneWeights, source.vertexCount*4*sizeof(float));
+
+            for (int k = 0; k < source.triangleCount*3; k++) mesh.indices[indexOffset + k] = source.indices[k] + vertexOffset;
+
+            vertexOffset += source.vertexCount;
+            indexOffset += source.triangleCount*3;
+        }
+    }
+
+    // Animated vertex data, updated on every animation update
+    mesh.animVertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.animNormals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    memcpy(mesh.animVertices, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+    memcpy(mesh.animNormals, mesh.normals, mesh.vertexCount*3*sizeof(float));
+
+    rlLoadMesh(&mesh, true);    // Upload vertex data to GPU (dynamic, updated on CPU skinning)
+
+    Model crowd = LoadModelFromMesh(mesh);
+
+    crowd.boneCount = model.boneCount*instances;
+    crowd.bones = (BoneInfo *)RL_MALLOC(crowd.boneCount*sizeof(BoneInfo));
+    crowd.bindPose = (Transform *)RL_MALLOC(crowd.boneCount*sizeof(Transform));
+
+    for (int i = 0; i < instances; i++)
+    {
+        Vector3 offset = GetInstanceOffset(i);
+
+        for (int b = 0; b < model.boneCount; b++)
+        {
+            BoneInfo bone = model.bones[b];
+            if (bone.parent >= 0) bone.parent += i*model.boneCount;
+
+            crowd.bones[i*model.boneCount + b] = bone;
+            crowd.bindPose[i*model.boneCount + b] = model.bindPose[b];
+            crowd.bindPose[i*model.boneCount + b].translation = Vector3Add(model.bindPose[b].translation, offset);
+        }
+    }
+
+    return crowd;
+}
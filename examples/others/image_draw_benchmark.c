@@ -0,0 +1,122 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - ImageDraw() sprites compositing benchmark (headless)
+*
+*   NOTE: This example does not require any graphic device, it can run directly on console.
+*
+*   Sprites from a generated spritesheet are composited into an atlas image with ImageDraw(),
+*   as done when building atlas or HUD images at load time: sprites are drawn at original size,
+*   scaled, downscaled and tinted, results are reported in sprites per second
+*
+*   Downscaling quality is also checked: a 1 pixel checkerboard drawn at a smaller size must
+*   average to flat gray (no aliasing patterns)
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: rand(), free()
+#include <time.h>               // Required for: clock()
+
+#define BENCHMARK_ATLAS_SIZE        4096    // Atlas image width and height
+#define BENCHMARK_SPRITE_SIZE         32    // Spritesheet sprites width and height
+#define BENCHMARK_SPRITES_COUNT    10000    // Sprites drawn per test
+#define BENCHMARK_TESTS_COUNT          4    // Original size, scaled, downscaled, scaled + tint
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    // Generate 8x8 sprites spritesheet: opaque sprites on first half, circles with transparent
+    // background (alpha blended borders) on second half
+    Image spritesheet = GenImageColor(BENCHMARK_SPRITE_SIZE*8, BENCHMARK_SPRITE_SIZE*8, BLANK);
+
+    for (int i = 0; i < 64; i++)
+    {
+        Rectangle rec = { (float)(i%8)*BENCHMARK_SPRITE_SIZE, (float)(i/8)*BENCHMARK_SPRITE_SIZE, BENCHMARK_SPRITE_SIZE, BENCHMARK_SPRITE_SIZE };
+        Color color = { (unsigned char)(rand()%256), (unsigned char)(rand()%256), (unsigned char)(rand()%256), 255 };
+
+        if (i < 32) ImageDrawRectangle(&spritesheet, rec, color);
+        else
+        {
+            for (int r = BENCHMARK_SPRITE_SIZE/2; r > 0; r--)
+            {
+                color.a = (unsigned char)((r > (BENCHMARK_SPRITE_SIZE/2 - 4))? 64*(BENCHMARK_SPRITE_SIZE/2 - r + 1) - 1 : 255);
+                ImageDrawRectangle(&spritesheet, (Rectangle){ rec.x + BENCHMARK_SPRITE_SIZE/2 - r, rec.y + BENCHMARK_SPRITE_SIZE/2 - r, (float)r*2, (float)r*2 }, color);
+            }
+        }
+    }
+
+    const char *testNames[BENCHMARK_TESTS_COUNT] = { "original size", "scaled", "downscaled", "scaled + tint" };
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("ImageDraw() benchmark: %i sprites (%ix%i) into %ix%i atlas\n\n", BENCHMARK_SPRITES_COUNT,
+           BENCHMARK_SPRITE_SIZE, BENCHMARK_SPRITE_SIZE, BENCHMARK_ATLAS_SIZE, BENCHMARK_ATLAS_SIZE);
+
+    for (int test = 0; test < BENCHMARK_TESTS_COUNT; test++)
+    {
+        Image atlas = GenImageColor(BENCHMARK_ATLAS_SIZE, BENCHMARK_ATLAS_SIZE, DARKGRAY);
+
+        srand(test);
+        clock_t start = clock();
+
+        for (int i = 0; i < BENCHMARK_SPRITES_COUNT; i++)
+        {
+            int sprite = rand()%64;
+            float size = (float)BENCHMARK_SPRITE_SIZE;
+            if (test == 2) size = (float)(BENCHMARK_SPRITE_SIZE/4 + rand()%(BENCHMARK_SPRITE_SIZE*3/4));
+            else if (test != 0) size = (float)(BENCHMARK_SPRITE_SIZE/2 + rand()%(BENCHMARK_SPRITE_SIZE*2));
+
+            Rectangle srcRec = { (float)(sprite%8)*BENCHMARK_SPRITE_SIZE, (float)(sprite/8)*BENCHMARK_SPRITE_SIZE, BENCHMARK_SPRITE_SIZE, BENCHMARK_SPRITE_SIZE };
+            Rectangle dstRec = { (float)(rand()%BENCHMARK_ATLAS_SIZE) - size/2, (float)(rand()%BENCHMARK_ATLAS_SIZE) - size/2, size, size };
+
+            ImageDraw(&atlas, spritesheet, srcRec, dstRec, (test == 3)? (Color){ 255, 200, 150, 200 } : WHITE);
+        }
+
+        double time = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+        printf("%-16s %8.1f ms %12.0f sprites/s\n", testNames[test], time*1000.0, BENCHMARK_SPRITES_COUNT/time);
+
+        UnloadImage(atlas);
+    }
+
+    // Downscaling check: 1 pixel checkerboard 256x256 drawn at 37x37
+    Image checked = GenImageChecked(256, 256, 1, 1, WHITE, BLACK);
+    Image downscaled = GenImageColor(37, 37, BLACK);
+
+    ImageDraw(&downscaled, checked, (Rectangle){ 0, 0, 256, 256 }, (Rectangle){ 0, 0, 37, 37 }, WHITE);
+
+    Color *pixels = GetImageData(downscaled);
+    int minValue = 255;
+    int maxValue = 0;
+
+    for (int i = 0; i < 37*37; i++)
+    {
+        if (pixels[i].r < minValue) minValue = pixels[i].r;
+        if (pixels[i].r > maxValue) maxValue = pixels[i].r;
+    }
+
+    bool noAliasing = ((maxValue - minValue) <= 16);
+
+    printf("\nDownscaled 1px checkerboard values: %i - %i (%s)\n", minValue, maxValue, noAliasing? "OK" : "ALIASING");
+
+    free(pixels);
+    UnloadImage(downscaled);
+    UnloadImage(checked);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadImage(spritesheet);
+    //--------------------------------------------------------------------------------------
+
+    return noAliasing? 0 : 1;
+}
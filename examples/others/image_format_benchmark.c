@@ -0,0 +1,106 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - ImageFormat() conversion benchmark (headless)
+*
+*   NOTE: This example does not require any graphic device, it can run directly on console.
+*
+*   Every pair of uncompressed pixel formats is converted with ImageFormat(), results are
+*   reported in megapixels per second (converted image includes mipmaps)
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: rand()
+#include <time.h>               // Required for: clock()
+
+#define BENCHMARK_IMAGE_SIZE        1024    // Benchmark image width and height
+#define BENCHMARK_IMAGE_MIPMAPS        4    // Benchmark image mipmap levels
+#define BENCHMARK_CONVERSIONS          8    // Conversions measured per formats pair
+
+#define UNCOMPRESSED_FORMATS_COUNT    10    // UNCOMPRESSED_GRAYSCALE to UNCOMPRESSED_R32G32B32A32
+
+static const char *formatNames[UNCOMPRESSED_FORMATS_COUNT] = {
+    "GRAY", "GRAY_A", "R5G6B5", "R8G8B8", "R5G5B5A1", "R4G4B4A4", "R8G8B8A8", "R32", "R32G32B32", "R32G32B32A32"
+};
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    // Generate random RGBA image with mipmaps (mipmaps levels stored after base level)
+    Image source = { 0 };
+    source.width = BENCHMARK_IMAGE_SIZE;
+    source.height = BENCHMARK_IMAGE_SIZE;
+    source.mipmaps = BENCHMARK_IMAGE_MIPMAPS;
+    source.format = UNCOMPRESSED_R8G8B8A8;
+
+    int pixelCount = 0;
+    for (int i = 0, size = BENCHMARK_IMAGE_SIZE; i < BENCHMARK_IMAGE_MIPMAPS; i++, size /= 2) pixelCount += size*size;
+
+    source.data = RL_MALLOC(pixelCount*4);
+    for (int i = 0; i < pixelCount*4; i++) ((unsigned char *)source.data)[i] = (unsigned char)(rand()%256);
+
+    // Source images for every format
+    Image images[UNCOMPRESSED_FORMATS_COUNT] = { 0 };
+
+    for (int i = 0; i < UNCOMPRESSED_FORMATS_COUNT; i++)
+    {
+        images[i] = ImageCopy(source);
+        ImageFormat(&images[i], UNCOMPRESSED_GRAYSCALE + i);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("ImageFormat() benchmark: %ix%i image, %i mipmaps (Mpixels/s)\n\n", BENCHMARK_IMAGE_SIZE, BENCHMARK_IMAGE_SIZE, BENCHMARK_IMAGE_MIPMAPS);
+    printf("%-14s", "from \\ to");
+    for (int i = 0; i < UNCOMPRESSED_FORMATS_COUNT; i++) printf("%13s", formatNames[i]);
+    printf("\n");
+
+    for (int from = 0; from < UNCOMPRESSED_FORMATS_COUNT; from++)
+    {
+        printf("%-14s", formatNames[from]);
+
+        for (int to = 0; to < UNCOMPRESSED_FORMATS_COUNT; to++)
+        {
+            if (from == to)
+            {
+                printf("%13s", "-");
+                continue;
+            }
+
+            double time = 0.0;
+
+            for (int i = 0; i < BENCHMARK_CONVERSIONS; i++)
+            {
+                Image image = ImageCopy(images[from]);      // Copy is not measured
+
+                clock_t start = clock();
+                ImageFormat(&image, UNCOMPRESSED_GRAYSCALE + to);
+                time += (double)(clock() - start)/CLOCKS_PER_SEC;
+
+                UnloadImage(image);
+            }
+
+            printf("%13.1f", (double)pixelCount*BENCHMARK_CONVERSIONS/time/1000000.0);
+        }
+
+        printf("\n");
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < UNCOMPRESSED_FORMATS_COUNT; i++) UnloadImage(images[i]);
+    UnloadImage(source);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
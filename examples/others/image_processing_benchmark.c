@@ -0,0 +1,164 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Multithreaded image processing benchmark (headless)
+*
+*   NOTE: This example does not require any graphic device, it can run directly on console.
+*
+*   Image processing functions are measured on a 4K image, first on calling thread only
+*   (SetWorkerThreadCount(1)) and then split between all available worker threads,
+*   results must be bit-exact between both runs
+*
+*   NOTE: Elapsed wall clock time is measured with a monotonic timer, clock() can not be used
+*   because on most platforms it measures process CPU time (all threads added)
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L     // Required for: clock_gettime(), CLOCK_MONOTONIC
+#endif
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: srand()
+#include <string.h>             // Required for: memcmp()
+#include <time.h>               // Required for: clock(), clock_gettime()
+
+#define BENCHMARK_IMAGE_WIDTH       3840    // Benchmark image width (4K)
+#define BENCHMARK_IMAGE_HEIGHT      2160    // Benchmark image height (4K)
+
+#define BENCHMARK_TESTS_COUNT         10    // Image processing functions measured
+
+static const char *testNames[BENCHMARK_TESTS_COUNT] = {
+    "ImageResize() down", "ImageResize() up", "ImageMipmaps()", "ImageDither()", "ImageColorTint()",
+    "ImageColorContrast()", "ImageColorBrightness()", "ImageAlphaPremultiply()", "GenImagePerlinNoise()", "GenImageCellular()"
+};
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static Image RunTest(int test, Image source, double *time);    // Run image processing test on a copy of source image
+static double GetWallTime(void);                               // Get monotonic wall clock time in seconds (clock() measures CPU time)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    // Generate source image: perlin noise with some color and alpha variation
+    SetWorkerThreadCount(1);
+
+    Image source = GenImagePerlinNoise(BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT, 0, 0, 8.0f);
+    Image gradient = GenImageGradientH(BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT, (Color){ 255, 80, 20, 255 }, (Color){ 20, 120, 255, 100 });
+    ImageDraw(&source, gradient, (Rectangle){ 0, 0, BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT },
+              (Rectangle){ 0, 0, BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT }, (Color){ 255, 255, 255, 160 });
+    UnloadImage(gradient);
+
+    SetWorkerThreadCount(0);        // Use hardware concurrency
+    int threads = GetWorkerThreadCount();
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("Image processing benchmark: %ix%i image, 1 thread vs %i threads\n\n", BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT, threads);
+    printf("%-24s %12s %12s %10s %12s\n", "function", "1 thread", "N threads", "speedup", "result");
+
+    for (int test = 0; test < BENCHMARK_TESTS_COUNT; test++)
+    {
+        double singleTime = 0.0;
+        double multiTime = 0.0;
+
+        SetWorkerThreadCount(1);
+        Image single = RunTest(test, source, &singleTime);
+
+        SetWorkerThreadCount(threads);
+        Image multi = RunTest(test, source, &multiTime);
+
+        // Multithreaded result must be exactly the same as single threaded one
+        int size = GetPixelDataSize(single.width, single.height, single.format);
+        bool exact = (single.width == multi.width) && (single.height == multi.height) && (single.format == multi.format) &&
+                     (single.mipmaps == multi.mipmaps) && (memcmp(single.data, multi.data, size) == 0);
+
+        // Mipmap levels data is stored after base level
+        for (int i = 1, width = single.width/2, height = single.height/2; exact && (i < single.mipmaps); i++, width /= 2, height /= 2)
+        {
+            int mipSize = GetPixelDataSize((width < 1)? 1 : width, (height < 1)? 1 : height, single.format);
+            exact = (memcmp((unsigned char *)single.data + size, (unsigned char *)multi.data + size, mipSize) == 0);
+            size += mipSize;
+        }
+
+        printf("%-24s %9.1f ms %9.1f ms %9.2fx %12s\n", testNames[test], singleTime*1000.0, multiTime*1000.0, singleTime/multiTime, exact? "bit-exact" : "DIFFERENT");
+
+        UnloadImage(single);
+        UnloadImage(multi);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadImage(source);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Run image processing test on a copy of source image, copy is not measured
+static Image RunTest(int test, Image source, double *time)
+{
+    Image image = { 0 };
+
+    if (test < 8)
+    {
+        image = ImageCopy(source);
+        if (test == 1) ImageResize(&image, BENCHMARK_IMAGE_WIDTH/2, BENCHMARK_IMAGE_HEIGHT/2);
+    }
+
+    double start = GetWallTime();
+
+    switch (test)
+    {
+        case 0: ImageResize(&image, BENCHMARK_IMAGE_WIDTH/2, BENCHMARK_IMAGE_HEIGHT/2); break;
+        case 1: ImageResize(&image, BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT); break;
+        case 2: ImageMipmaps(&image); break;
+        case 3: ImageDither(&image, 5, 6, 5, 0); break;
+        case 4: ImageColorTint(&image, (Color){ 255, 200, 150, 200 }); break;
+        case 5: ImageColorContrast(&image, 40.0f); break;
+        case 6: ImageColorBrightness(&image, -60); break;
+        case 7: ImageAlphaPremultiply(&image); break;
+        case 8: image = GenImagePerlinNoise(BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT, 50, 50, 4.0f); break;
+        case 9:
+        {
+            srand(1);       // Same cells seeds on every run
+            image = GenImageCellular(BENCHMARK_IMAGE_WIDTH, BENCHMARK_IMAGE_HEIGHT, 64);
+        } break;
+        default: break;
+    }
+
+    *time = GetWallTime() - start;
+
+    return image;
+}
+
+// Get monotonic wall clock time in seconds
+// NOTE: On Windows clock() measures wall clock time
+static double GetWallTime(void)
+{
+#if defined(_WIN32)
+    return (double)clock()/CLOCKS_PER_SEC;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec/1000000000.0;
+#endif
+}
@@ -0,0 +1,146 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - raudio mixer benchmark (headless)
+*
+*   NOTE: This example does not require any audio or graphic device, it can run directly on console.
+*         Mixer is driven by RenderAudioFrames() (offline rendering), raudio module is included
+*         directly to report the SIMD mixing path used
+*
+*   Three scenarios are measured for an increasing number of voices:
+*       - Same pitch: voices in device format, mixed without data conversion
+*       - 4 pitches: voices resampled in groups sharing the same pitch
+*       - Unique pitch: every voice resampled by its own converter (groups exhausted)
+*
+*   COMPILATION:
+*       gcc -o raudio_mixer_benchmark.exe raudio_mixer_benchmark.c -I..\..\src /
+*           -O2 -Wall -std=c99 -DRAUDIO_STANDALONE [-mavx]
+*
+*   LICENSE: zlib/libpng
+*
+*   This example is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software:
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+********************************************************************************************/
+
+#if !defined(RAUDIO_STANDALONE)
+    #define RAUDIO_STANDALONE
+#endif
+#include "raudio.c"             // NOTE: Module implementation included to access mixing configuration
+
+#include <stdio.h>              // Required for: printf()
+#include <math.h>               // Required for: sinf()
+
+#define MAX_BENCHMARK_VOICES    64      // Voices mixed on last test (mixer voices limit)
+#define MIXER_PERIOD_FRAMES     512     // Frames requested per mixer callback
+#define MIXER_PERIODS_COUNT     2000    // Mixer callbacks measured per test
+
+// Mix periods with current voices, returns average time per period in microseconds
+static double MeasureMixing(float *output)
+{
+    // Warm up: first period applies play requests and initializes resample groups
+    RenderAudioFrames(output, MIXER_PERIOD_FRAMES);
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    for (int i = 0; i < MIXER_PERIODS_COUNT; i++) RenderAudioFrames(output, MIXER_PERIOD_FRAMES);
+
+    return ma_timer_get_time_in_seconds(&timer)*1000000.0/MIXER_PERIODS_COUNT;
+}
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    InitAudioDeviceOffline();       // No audio device required, mixer is driven by the benchmark
+
+    SetAudioVoicesBudget(MAX_BENCHMARK_VOICES);     // All voices are mixed, no virtual voices
+
+    // Generate one second of stereo sine wave to be played by all voices
+    Wave wave = { 0 };
+    wave.sampleCount = AUDIO_DEVICE_SAMPLE_RATE*2;
+    wave.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = 2;
+    wave.data = RL_MALLOC(wave.sampleCount*sizeof(float));
+
+    for (unsigned int i = 0; i < wave.sampleCount; i++) ((float *)wave.data)[i] = 0.25f*sinf((float)(i/2)*440.0f*6.2831853f/AUDIO_DEVICE_SAMPLE_RATE);
+
+    Sound sounds[MAX_BENCHMARK_VOICES] = { 0 };
+
+    for (int i = 0; i < MAX_BENCHMARK_VOICES; i++)
+    {
+        sounds[i] = LoadSoundFromWave(wave);
+        sounds[i].stream.buffer->looping = true;    // Keep voices playing during the whole test
+    }
+
+    static float output[MIXER_PERIOD_FRAMES*AUDIO_DEVICE_CHANNELS] = { 0 };
+    double periodTime = (double)MIXER_PERIOD_FRAMES*1000000.0/AUDIO_DEVICE_SAMPLE_RATE;
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+#if defined(MIXING_SIMD_AVX)
+    printf("raudio mixer benchmark: AVX mixing, %i frames per period (%.1f us of audio)\n\n", MIXER_PERIOD_FRAMES, periodTime);
+#elif defined(MIXING_SIMD_SSE)
+    printf("raudio mixer benchmark: SSE mixing, %i frames per period (%.1f us of audio)\n\n", MIXER_PERIOD_FRAMES, periodTime);
+#elif defined(MIXING_SIMD_NEON)
+    printf("raudio mixer benchmark: NEON mixing, %i frames per period (%.1f us of audio)\n\n", MIXER_PERIOD_FRAMES, periodTime);
+#else
+    printf("raudio mixer benchmark: scalar mixing, %i frames per period (%.1f us of audio)\n\n", MIXER_PERIOD_FRAMES, periodTime);
+#endif
+    printf("%8s | %22s | %22s | %22s\n", "voices", "same pitch", "4 pitches", "unique pitch");
+
+    for (int voices = 8; voices <= MAX_BENCHMARK_VOICES; voices *= 2)
+    {
+        double times[3] = { 0 };
+
+        for (int test = 0; test < 3; test++)
+        {
+            for (int i = 0; i < voices; i++)
+            {
+                float pitch = 1.0f;
+                if (test == 1) pitch = 0.8f + 0.1f*(i%4);
+                else if (test == 2) pitch = 0.5f + (float)i/MAX_BENCHMARK_VOICES;
+
+                SetSoundPitch(sounds[i], pitch);
+                PlaySound(sounds[i]);
+            }
+
+            times[test] = MeasureMixing(output);
+
+            for (int i = 0; i < voices; i++) StopSound(sounds[i]);
+        }
+
+        printf("%8i | %9.1f us (%5.1f%%) | %9.1f us (%5.1f%%) | %9.1f us (%5.1f%%)\n", voices,
+               times[0], times[0]*100.0/periodTime, times[1], times[1]*100.0/periodTime, times[2], times[2]*100.0/periodTime);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_BENCHMARK_VOICES; i++) UnloadSound(sounds[i]);
+    UnloadWave(wave);
+
+    CloseAudioDevice();
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - raudio offline rendering (headless)
+*
+*   NOTE: This example does not require any audio or graphic device, it can run directly on console.
+*         Mixer is driven by RenderAudioFrames(), audio is rendered as fast as the CPU allows
+*
+*   Music and sounds are rendered twice into memory, from a newly initialized offline device:
+*   output must be identical on both renders (mixing is deterministic), it's exported as a
+*   WAV file (32 bit float, stereo)
+*
+*   Commands queue overflow is also checked: more requests than the queue can hold are sent
+*   between two rendered blocks, none of them can be lost (every sound must be stopped)
+*
+*   NOTE: raudio module is included directly with required file formats support, program fails
+*   (returns 1) if audio files can not be loaded or any check fails
+*
+*   COMPILATION (run from examples/others directory):
+*       gcc -o raudio_offline_render.exe raudio_offline_render.c -I..\..\src /
+*           -O2 -Wall -std=c99
+*
+*   LICENSE: zlib/libpng
+*
+*   This example is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software:
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+********************************************************************************************/
+
+#if !defined(RAUDIO_STANDALONE)
+    #define RAUDIO_STANDALONE
+#endif
+#define SUPPORT_FILEFORMAT_WAV
+#define SUPPORT_FILEFORMAT_OGG
+#include "raudio.c"             // raylib audio library (module implementation, with required file formats)
+
+#include <stdlib.h>             // Required for: calloc(), free()
+#include <stdio.h>              // Required for: printf()
+#include <string.h>             // Required for: memcmp()
+#include <time.h>               // Required for: clock()
+
+#define RENDER_SAMPLE_RATE      44100   // Offline rendering output: 32 bit float, stereo
+#define RENDER_CHANNELS         2
+#define RENDER_SECONDS          10      // Seconds of audio rendered
+#define RENDER_BLOCK_FRAMES     1024    // Frames rendered between music stream updates
+#define OVERFLOW_SOUNDS         300     // Sounds played/stopped/unloaded at once (more than mixer commands queue size)
+
+// Render music with a sound played every half second, returns false if audio files can not be loaded
+static bool RenderAudio(float *frames, int frameCount, double *renderTime)
+{
+    InitAudioDeviceOffline();       // No audio device required, audio is rendered on demand
+
+    Music music = LoadMusicStream("../audio/resources/guitar_noodling.ogg");
+    Sound fx = LoadSound("../audio/resources/coin.wav");
+
+    if ((music.sampleCount == 0) || (fx.sampleCount == 0))
+    {
+        printf("ERROR: Audio files could not be loaded (run from examples/others directory)\n");
+
+        UnloadSound(fx);
+        UnloadMusicStream(music);
+        CloseAudioDevice();
+
+        return false;
+    }
+
+    clock_t start = clock();
+
+    PlayMusicStream(music);
+
+    for (int framesRendered = 0; framesRendered < frameCount; framesRendered += RENDER_BLOCK_FRAMES)
+    {
+        // Game logic runs between rendered blocks, as it would run between frames
+        UpdateMusicStream(music);
+
+        if ((framesRendered%(RENDER_SAMPLE_RATE/2)) < RENDER_BLOCK_FRAMES)
+        {
+            SetSoundPitch(fx, 0.5f + (float)(framesRendered%(RENDER_SAMPLE_RATE*2))/RENDER_SAMPLE_RATE);
+            PlaySoundMulti(fx);
+        }
+
+        int framesToRender = frameCount - framesRendered;
+        if (framesToRender > RENDER_BLOCK_FRAMES) framesToRender = RENDER_BLOCK_FRAMES;
+
+        RenderAudioFrames(frames + framesRendered*RENDER_CHANNELS, framesToRender);
+    }
+
+    *renderTime = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    UnloadSound(fx);
+    UnloadMusicStream(music);
+
+    CloseAudioDevice();
+
+    return true;
+}
+
+// Play, stop and unload more sounds than mixer commands queue can hold, returns true if no request was lost
+static bool CheckCommandsOverflow(void)
+{
+    InitAudioDeviceOffline();
+
+    Wave wave = LoadWave("../audio/resources/coin.wav");
+
+    if (wave.sampleCount == 0)
+    {
+        printf("ERROR: Commands queue overflow: audio file could not be loaded\n");
+        CloseAudioDevice();
+
+        return false;
+    }
+
+    Sound *sounds = (Sound *)RL_CALLOC(OVERFLOW_SOUNDS, sizeof(Sound));
+    float *frames = (float *)RL_CALLOC(RENDER_BLOCK_FRAMES*RENDER_CHANNELS, sizeof(float));
+
+    for (int i = 0; i < OVERFLOW_SOUNDS; i++) sounds[i] = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    for (int i = 0; i < OVERFLOW_SOUNDS; i++) PlaySound(sounds[i]);
+    RenderAudioFrames(frames, RENDER_BLOCK_FRAMES);
+
+    int voicesPlaying = GetAudioVoicesMixed() + GetAudioVoicesVirtual();
+
+    // NOTE: Sounds are stopped in reverse order, sounds played first (the ones with a voice) are stopped last,
+    // after the volume requests of all sounds have already filled the commands queue
+    for (int i = OVERFLOW_SOUNDS - 1; i >= 0; i--)
+    {
+        SetSoundVolume(sounds[i], 0.5f);
+        StopSound(sounds[i]);
+    }
+    RenderAudioFrames(frames, RENDER_BLOCK_FRAMES);
+
+    int voicesStopped = GetAudioVoicesMixed() + GetAudioVoicesVirtual();
+
+    bool silent = true;
+    for (int i = 0; i < RENDER_BLOCK_FRAMES*RENDER_CHANNELS; i++) if (frames[i] != 0.0f) silent = false;
+
+    for (int i = OVERFLOW_SOUNDS - 1; i >= 0; i--) UnloadSound(sounds[i]);
+    RenderAudioFrames(frames, RENDER_BLOCK_FRAMES);
+
+    RL_FREE(frames);
+    RL_FREE(sounds);
+
+    CloseAudioDevice();
+
+    bool success = ((voicesPlaying > 0) && (voicesStopped == 0) && silent);
+
+    printf("Commands queue overflow: %i voices playing, %i voices after stop, output %s\n", voicesPlaying, voicesStopped, silent? "silent" : "NOT silent");
+    if (!success) printf("ERROR: Commands queue overflow: mixer requests were lost\n");
+
+    return success;
+}
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int frameCount = RENDER_SAMPLE_RATE*RENDER_SECONDS;
+
+    float *frames = (float *)RL_CALLOC(frameCount*RENDER_CHANNELS, sizeof(float));
+    float *framesCheck = (float *)RL_CALLOC(frameCount*RENDER_CHANNELS, sizeof(float));
+    //--------------------------------------------------------------------------------------
+
+    // Offline rendering
+    //--------------------------------------------------------------------------------------
+    double renderTime = 0.0;
+    double renderTimeCheck = 0.0;
+
+    if (!RenderAudio(frames, frameCount, &renderTime) || !RenderAudio(framesCheck, frameCount, &renderTimeCheck))
+    {
+        RL_FREE(frames);
+        RL_FREE(framesCheck);
+
+        return 1;
+    }
+
+    bool deterministic = (memcmp(frames, framesCheck, frameCount*RENDER_CHANNELS*sizeof(float)) == 0);
+    bool noCommandsLost = CheckCommandsOverflow();
+
+    printf("Rendered %i seconds of audio in %.3f seconds (%.1fx real-time)\n", RENDER_SECONDS, renderTime, RENDER_SECONDS/renderTime);
+    printf("Deterministic output: %s\n", deterministic? "YES" : "NO");
+    if (!deterministic) printf("ERROR: Rendered output is not deterministic\n");
+
+    // Export rendered audio as a WAV file
+    // NOTE: WAV export expects samples count per channel
+    Wave wave = { 0 };
+    wave.sampleCount = frameCount;
+    wave.sampleRate = RENDER_SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = RENDER_CHANNELS;
+    wave.data = frames;
+
+    ExportWave(wave, "offline_render.wav");
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RL_FREE(frames);
+    RL_FREE(framesCheck);
+    //--------------------------------------------------------------------------------------
+
+    return (deterministic && noCommandsLost)? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - raudio sound bank benchmark (headless)
+*
+*   NOTE: This example does not require any audio or graphic device, it can run directly on console.
+*         raudio module is included directly to measure sounds memory, no real device is initialized
+*
+*   A bank of sounds is loaded with every sound storage mode:
+*       - SOUND_STORAGE_DEVICE: sounds converted to device format (32 bit float, stereo, 44100 Hz)
+*       - SOUND_STORAGE_NATIVE: sounds kept in wave format, converted while mixing
+*       - SOUND_STORAGE_COMPRESSED: OGG/FLAC sounds kept compressed, decoded on play into sounds cache
+*
+*   COMPILATION (run from examples/others directory):
+*       gcc -o raudio_sound_bank_benchmark.exe raudio_sound_bank_benchmark.c -I..\..\src /
+*           -O2 -Wall -std=c99 -DRAUDIO_STANDALONE
+*
+*   LICENSE: zlib/libpng
+*
+*   This example is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software:
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+********************************************************************************************/
+
+#if !defined(RAUDIO_STANDALONE)
+    #define RAUDIO_STANDALONE
+#endif
+#define SUPPORT_FILEFORMAT_WAV
+#define SUPPORT_FILEFORMAT_OGG
+#define SUPPORT_FILEFORMAT_FLAC
+#include "raudio.c"             // NOTE: Module implementation included to access sounds data
+
+#include <stdio.h>              // Required for: printf()
+
+#define BANK_FILES_COUNT        6       // Sound files on the bank
+#define BANK_FILE_COPIES       50       // Times every sound file is loaded (bank sounds count)
+
+// Get sounds data memory: sound data, compressed file data and decoded data in sounds cache
+static unsigned int GetSoundsMemory(void)
+{
+    unsigned int size = 0;
+
+    for (rAudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (buffer->compressed != NULL) size += buffer->compressed->fileDataSize;
+        if (buffer->data != NULL) size += buffer->sizeInFrames*ma_get_bytes_per_frame(buffer->converter.config.formatIn, buffer->converter.config.channelsIn);
+    }
+
+    return size;
+}
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const char *files[BANK_FILES_COUNT] = {
+        "../audio/resources/coin.wav",
+        "../audio/resources/sound.wav",
+        "../audio/resources/spring.wav",
+        "../audio/resources/weird.wav",
+        "../audio/resources/tanatana.ogg",
+        "../audio/resources/tanatana.flac"
+    };
+
+    const char *modes[3] = { "device format", "native format", "compressed" };
+
+    static Sound sounds[BANK_FILES_COUNT*BANK_FILE_COPIES] = { 0 };
+    const int soundsCount = BANK_FILES_COUNT*BANK_FILE_COPIES;
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("raudio sound bank benchmark: %i sounds (%i files loaded %i times)\n\n", soundsCount, BANK_FILES_COUNT, BANK_FILE_COPIES);
+    printf("%14s | %12s | %12s | %16s | %12s\n", "storage mode", "load time", "memory", "play (decoding)", "memory played");
+
+    for (int mode = SOUND_STORAGE_DEVICE; mode <= SOUND_STORAGE_COMPRESSED; mode++)
+    {
+        SetSoundStorageMode(mode);
+
+        ma_timer timer = { 0 };
+        ma_timer_init(&timer);
+
+        for (int i = 0; i < soundsCount; i++) sounds[i] = LoadSound(files[i%BANK_FILES_COUNT]);
+
+        double loadTime = ma_timer_get_time_in_seconds(&timer)*1000.0;
+        unsigned int memory = GetSoundsMemory();
+
+        // Play every sound once, compressed sounds are decoded into sounds cache
+        // NOTE: No mixer is running, sounds are stopped to be released from cache
+        double playTime = ma_timer_get_time_in_seconds(&timer);
+
+        for (int i = 0; i < soundsCount; i++)
+        {
+            PlaySound(sounds[i]);
+            StopSound(sounds[i]);
+        }
+
+        playTime = (ma_timer_get_time_in_seconds(&timer) - playTime)*1000000.0/soundsCount;
+
+        printf("%14s | %9.1f ms | %9.2f MB | %10.1f us/sound | %9.2f MB\n", modes[mode], loadTime, memory/1048576.0f, playTime, GetSoundsMemory()/1048576.0f);
+
+        for (int i = 0; i < soundsCount; i++) UnloadSound(sounds[i]);
+    }
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
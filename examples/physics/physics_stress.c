@@ -0,0 +1,174 @@
+/*******************************************************************************************
+*
+*   Physac - Physics stress test (broad phase)
+*
+*   NOTE 1: PHYSAC_NO_THREADS is defined, no physics thread is created, physics steps are run
+*           on main thread by RunPhysicsStep() every frame, so physics time per frame can be measured
+*   NOTE 2: Physac requires static C library linkage to avoid dependency on MinGW DLL (-static -lpthread)
+*   NOTE 3: Physics step only solves pairs of bodies with overlapping bounds (sweep and prune),
+*           bodies limit is increased defining PHYSAC_MAX_BODIES before including physac
+*   NOTE 4: Sleeping is disabled by default, enabled here defining PHYSAC_TIME_TO_SLEEP before
+*           including physac: resting piles of bodies are put to sleep (drawn in gray)
+*
+*   Use the following line to compile:
+*
+*   gcc -o $(NAME_PART).exe $(FILE_NAME) -s -static  /
+*       -lraylib -lpthread -lglfw3 -lopengl32 -lgdi32 -lopenal32 -lwinmm /
+*       -std=c99 -Wl,--subsystem,windows -Wl,-allow-multiple-definition
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define PHYSAC_IMPLEMENTATION
+#define PHYSAC_NO_THREADS
+#define PHYSAC_MAX_BODIES       1024
+#define PHYSAC_MAX_MANIFOLDS    8192
+#define PHYSAC_TIME_TO_SLEEP    500.0f
+#include "physac.h"
+
+#define BODIES_PER_SPAWN          50    // Number of bodies created every spawn
+#define MAX_STEP_SAMPLES          60    // Number of frames averaged for physics time
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    SetConfigFlags(FLAG_MSAA_4X_HINT);
+    InitWindow(screenWidth, screenHeight, "Physac [raylib] - Physics stress test");
+
+    // Physac logo drawing position
+    int logoX = screenWidth - MeasureText("Physac", 30) - 10;
+    int logoY = 15;
+    bool needsReset = false;
+
+    // Initialize physics and default physics bodies
+    InitPhysics();
+
+    // Create floor and walls rectangle physics bodies
+    PhysicsBody floor = CreatePhysicsBodyRectangle((Vector2){ screenWidth/2, screenHeight }, screenWidth, 100, 10);
+    PhysicsBody wallLeft = CreatePhysicsBodyRectangle((Vector2){ -25, screenHeight/2 }, 50, screenHeight, 10);
+    PhysicsBody wallRight = CreatePhysicsBodyRectangle((Vector2){ screenWidth + 25, screenHeight/2 }, 50, screenHeight, 10);
+    floor->enabled = false;         // Disable body state to convert it to static (no dynamics, but collisions)
+    wallLeft->enabled = false;
+    wallRight->enabled = false;
+
+    double stepTimes[MAX_STEP_SAMPLES] = { 0 };
+    int stepIndex = 0;
+    double stepTime = 0.0;          // Average physics time per frame (milliseconds)
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        double time = GetTime();
+        RunPhysicsStep();
+        stepTimes[stepIndex] = (GetTime() - time)*1000.0;
+        stepIndex = (stepIndex + 1)%MAX_STEP_SAMPLES;
+
+        stepTime = 0.0;
+        for (int i = 0; i < MAX_STEP_SAMPLES; i++) stepTime += stepTimes[i];
+        stepTime /= MAX_STEP_SAMPLES;
+
+        // Delay initialization of variables due to physics reset async
+        if (needsReset)
+        {
+            floor = CreatePhysicsBodyRectangle((Vector2){ screenWidth/2, screenHeight }, screenWidth, 100, 10);
+            wallLeft = CreatePhysicsBodyRectangle((Vector2){ -25, screenHeight/2 }, 50, screenHeight, 10);
+            wallRight = CreatePhysicsBodyRectangle((Vector2){ screenWidth + 25, screenHeight/2 }, 50, screenHeight, 10);
+            floor->enabled = false;
+            wallLeft->enabled = false;
+            wallRight->enabled = false;
+
+            needsReset = false;
+        }
+
+        // Reset physics input
+        if (IsKeyPressed('R'))
+        {
+            ResetPhysics();
+            needsReset = true;
+        }
+
+        // Spawn a group of random physics bodies over the screen
+        if (IsKeyPressed(KEY_SPACE) || IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+        {
+            for (int i = 0; (i < BODIES_PER_SPAWN) && (GetPhysicsBodiesCount() < PHYSAC_MAX_BODIES); i++)
+            {
+                Vector2 position = { (float)GetRandomValue(20, screenWidth - 20), (float)GetRandomValue(-200, 0) };
+
+                if (GetRandomValue(0, 1) == 0) CreatePhysicsBodyCircle(position, (float)GetRandomValue(4, 8), 10);
+                else CreatePhysicsBodyPolygon(position, (float)GetRandomValue(5, 10), GetRandomValue(3, 6), 10);
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(BLACK);
+
+            DrawFPS(screenWidth - 90, screenHeight - 30);
+
+            // Draw created physics bodies
+            int bodiesCount = GetPhysicsBodiesCount();
+            int sleepingCount = 0;
+            for (int i = 0; i < bodiesCount; i++)
+            {
+                PhysicsBody body = GetPhysicsBody(i);
+
+                if (body != NULL)
+                {
+                    if (body->isSleeping) sleepingCount++;
+
+                    int vertexCount = GetPhysicsShapeVerticesCount(i);
+                    for (int j = 0; j < vertexCount; j++)
+                    {
+                        // Get physics bodies shape vertices to draw lines
+                        // Note: GetPhysicsShapeVertex() already calculates rotation transformations
+                        Vector2 vertexA = GetPhysicsShapeVertex(body, j);
+
+                        int jj = (((j + 1) < vertexCount) ? (j + 1) : 0);   // Get next vertex or first to close the shape
+                        Vector2 vertexB = GetPhysicsShapeVertex(body, jj);
+
+                        DrawLineV(vertexA, vertexB, body->isSleeping? GRAY : GREEN);     // Draw a line between two vertex positions
+                    }
+                }
+            }
+
+            DrawRectangle(5, 5, 250, 100, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(5, 5, 250, 100, BLUE);
+
+            DrawText("Hold left mouse button to spawn bodies", 10, 10, 10, WHITE);
+            DrawText("Press 'R' to reset example", 10, 25, 10, WHITE);
+            DrawText(FormatText("Bodies: %i / %i", bodiesCount, PHYSAC_MAX_BODIES), 10, 45, 10, WHITE);
+            DrawText(FormatText("Sleeping bodies: %i", sleepingCount), 10, 60, 10, WHITE);
+            DrawText(FormatText("Physics time per frame: %.3f ms", stepTime), 10, 75, 10, WHITE);
+            DrawText(FormatText("Frame time budget: %.3f ms", 1000.0/60.0), 10, 90, 10, (stepTime > 1000.0/60.0)? RED : WHITE);
+
+            DrawText("Physac", logoX, logoY, 30, WHITE);
+            DrawText("Powered by", logoX + 50, logoY - 7, 10, WHITE);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    ClosePhysics();       // Unitialize physics
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Asynchronous assets loading
+*
+*   NOTE: Assets files are decoded on background threads, GPU uploads are done on main thread
+*   by PollAssetLoads(), limited to a time budget per frame to keep the loading screen responsive
+*
+*   This example has been created using raylib 3.1 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define NUM_TEXTURES    6
+
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - asynchronous assets loading");
+
+    InitAudioDevice();              // Initialize audio device
+
+    const char *fileNames[NUM_TEXTURES] = {
+        "resources/cyberpunk_street_background.png", "resources/cyberpunk_street_midground.png",
+        "resources/cyberpunk_street_foreground.png", "resources/parrots.png", "resources/fudesumi.png", "resources/scarfy.png"
+    };
+
+    // Request all assets at once, handles are used to retrieve them when loaded
+    unsigned int textureAssets[NUM_TEXTURES] = { 0 };
+    for (int i = 0; i < NUM_TEXTURES; i++) textureAssets[i] = LoadTextureAsync(fileNames[i]);
+
+    unsigned int fontAsset = LoadFontAsync("resources/KAISG.ttf");
+    unsigned int soundAsset = LoadSoundAsync("resources/boom.wav");
+
+    Texture2D textures[NUM_TEXTURES] = { 0 };
+    Font font = { 0 };
+    Sound fxBoom = { 0 };
+
+    bool loaded = false;
+    int loadedCount = 0;
+    int requestedCount = 0;
+    int currentTexture = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (!loaded)
+        {
+            // Finalize decoded assets for up to 4 ms per frame
+            if (PollAssetLoads(0.004f) == 0)
+            {
+                for (int i = 0; i < NUM_TEXTURES; i++) textures[i] = GetAssetTexture(textureAssets[i]);
+
+                font = GetAssetFont(fontAsset);
+                fxBoom = GetAssetSound(soundAsset);
+
+                loaded = true;
+            }
+
+            GetAssetLoadProgress(&loadedCount, &requestedCount);
+        }
+        else if (IsKeyPressed(KEY_SPACE))
+        {
+            currentTexture = (currentTexture + 1)%NUM_TEXTURES;
+            PlaySound(fxBoom);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (!loaded)
+            {
+                DrawText("LOADING ASSETS...", 240, 170, 40, DARKBLUE);
+                DrawRectangle(150, 240, 500*loadedCount/requestedCount, 60, SKYBLUE);
+                DrawRectangleLines(150, 240, 500, 60, DARKGRAY);
+                DrawText(TextFormat("%i / %i", loadedCount, requestedCount), 370, 320, 20, DARKGRAY);
+            }
+            else
+            {
+                Texture2D texture = textures[currentTexture];
+                float scale = (float)screenHeight/texture.height;
+                if (texture.width*scale > screenWidth) scale = (float)screenWidth/texture.width;
+
+                DrawTextureEx(texture, (Vector2){ (screenWidth - texture.width*scale)/2, (screenHeight - texture.height*scale)/2 }, 0.0f, scale, WHITE);
+
+                DrawTextEx(font, "PRESS SPACE TO SHOW NEXT TEXTURE", (Vector2){ 20, 20 }, (float)font.baseSize, 2, MAROON);
+            }
+
+            DrawFPS(10, 420);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    // NOTE: Assets not retrieved yet are unloaded by CloseWindow()
+    if (loaded)
+    {
+        for (int i = 0; i < NUM_TEXTURES; i++) UnloadTexture(textures[i]);
+        UnloadFont(font);
+        UnloadSound(fxBoom);
+    }
+
+    CloseAudioDevice();             // Close audio device
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -144,5 +144,8 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG            1
 //#define SUPPORT_TRACELOG_DEBUG      1
+// Use a pool of worker threads to split heavy CPU processing (i.e. CPU skinning, image processing)
+// NOTE: Not available on PLATFORM_WEB, processing is done on calling thread
+#define SUPPORT_WORKER_THREADS      1
 
 #endif  //defined(RAYLIB_CMAKE)
@@ -158,6 +158,7 @@
 #include <string.h>             // Required for: strrchr(), strcmp(), strlen()
 #include <time.h>               // Required for: time() [Used in InitTimer()]
 #include <math.h>               // Required for: tan() [Used in BeginMode3D()]
+#include <ctype.h>              // Required for: tolower() [Used in IsFileExtension()]
 
 #include <sys/stat.h>           // Required for: stat() [Used in GetFileModTime()]
 
@@ -741,12 +742,16 @@ void CloseWindow(void)
     }
 #endif
 
+    CloseAssetLoader();         // Close asset loader threads, assets not retrieved are unloaded
+
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
 #endif
 
     rlglClose();                // De-init rlgl
 
+    CloseWorkerThreads();       // Close worker threads pool (if initialized)
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwDestroyWindow(CORE.Window.handle);
     glfwTerminate();
@@ -1292,6 +1297,7 @@ void EndDrawing(void)
     }
 #endif
 
+    rlglEndFrame();                 // Update internal rlgl frame statistics
     SwapBuffers();                  // Copy back buffer to front buffer
     PollInputEvents();              // Poll user events
 
@@ -1889,7 +1895,8 @@ bool FileExists(const char *fileName)
 }
 
 // Check file extension
-// NOTE: Extensions checking is not case-sensitive
+// NOTE: Extensions checking is not case-sensitive, extensions list is compared in place
+// (no static buffers used), so it can be called from asset loader threads
 bool IsFileExtension(const char *fileName, const char *ext)
 {
     bool result = false;
@@ -1897,19 +1904,21 @@ bool IsFileExtension(const char *fileName, const char *ext)
 
     if (fileExt != NULL)
     {
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount);
+        const char *checkExt = ext;
 
-        char fileExtLower[16] = { 0 };
-        strcpy(fileExtLower, TextToLower(fileExt));
-
-        for (int i = 0; i < extCount; i++)
+        while (!result && (*checkExt != '\0'))
         {
-            if (TextIsEqual(fileExtLower, TextToLower(checkExts[i] + 1)))
-            {
-                result = true;
-                break;
-            }
+            if (*checkExt == '.') checkExt++;
+
+            int i = 0;
+            while ((fileExt[i] != '\0') && (checkExt[i] != ';') &&
+                   (tolower((unsigned char)fileExt[i]) == tolower((unsigned char)checkExt[i]))) i++;
+
+            if ((fileExt[i] == '\0') && ((checkExt[i] == '\0') || (checkExt[i] == ';'))) result = true;
+
+            // Move to next extension on list (separated by ';')
+            while ((*checkExt != '\0') && (*checkExt != ';')) checkExt++;
+            if (*checkExt == ';') checkExt++;
         }
     }
 
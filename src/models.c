@@ -46,9 +46,9 @@
 #include "utils.h"          // Required for: fopen() Android mapping
 
 #include <stdlib.h>         // Required for: malloc(), free()
-#include <stdio.h>          // Required for: FILE, fopen(), fclose()
+#include <stdio.h>          // Required for: FILE, fopen(), fclose(), snprintf() [Used in LoadGLTF()]
 #include <string.h>         // Required for: strncmp() [Used in LoadModelAnimations()], strlen() [Used in LoadTextureFromCgltfImage()]
-#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf(), fmodf(), acosf()
 
 #include "rlgl.h"           // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
@@ -68,34 +68,108 @@
     #include "external/par_shapes.h"    // Shapes 3d parametric generation
 #endif
 
+// SIMD instruction sets used for CPU skinning (if available)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>                  // SSE intrinsics: _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps()...
+    #define SKINNING_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>                   // NEON intrinsics: vld1q_f32(), vmlaq_n_f32()...
+    #define SKINNING_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define MAX_MESH_VBO    7               // Maximum number of vbo per mesh
+#define MAX_MESH_VBO    9               // Maximum number of vbo per mesh
+
+#define SKINNING_GRAIN_SIZE     2048    // Vertices processed per worker thread chunk on CPU skinning
+
+#define BVH_MAX_LEAF_TRIANGLES     4    // Max triangles stored by a mesh BVH leaf node
+#define BVH_MAX_DEPTH             64    // Max mesh BVH depth (traversal stack size)
+#define RAYS_GRAIN_SIZE           64    // Rays processed per worker thread chunk on batched ray collisions
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+
+// CPU skinning data, shared by all threads processing a mesh
+typedef struct SkinningData {
+    const float16 *palette;         // Bones transformation matrices for current pose (column-major)
+    int boneCount;                  // Number of bones in palette
+    const float *vertices;          // Mesh default vertex position
+    const float *normals;           // Mesh default vertex normals (optional)
+    const int *boneIds;             // Mesh vertex bone ids (4 per vertex)
+    const float *boneWeights;       // Mesh vertex bone weights (4 per vertex)
+    float *animVertices;            // Animated vertex position (output)
+    float *animNormals;             // Animated vertex normals (output, optional)
+} SkinningData;
+
+// Mesh BVH node
+// NOTE: Internal nodes children are stored consecutively (left = first, right = first + 1)
+typedef struct BVHNode {
+    Vector3 min;                    // Node bounds minimum point
+    Vector3 max;                    // Node bounds maximum point
+    int first;                      // First triangle (leaf node) or left child node index (internal node)
+    int count;                      // Number of triangles (leaf node), 0 for internal nodes
+} BVHNode;
+
+// Mesh bounding volume hierarchy, built in mesh local space
+struct MeshBVH {
+    BVHNode *nodes;                 // Tree nodes (root is first node)
+    int nodeCount;                  // Number of nodes
+    int *triangles;                 // Triangles indices, sorted by leaf node
+    int triangleCount;              // Number of triangles
+};
+
+// Batched ray collisions data, shared by all threads processing rays
+typedef struct RaysCollisionData {
+    Ray *rays;                      // Rays to check
+    Model model;                    // Model to check against
+    RayHitInfo *hits;               // Collisions info (output)
+} RaysCollisionData;
+
+// Model asynchronous loading data, model decoded on a loader thread is uploaded on main thread
+typedef struct ModelAsset {
+    Model model;                    // Model data (meshes and material maps uploaded on main thread)
+    Image *mapImages;               // Material maps images to be uploaded (MAX_MATERIAL_MAPS per material)
+} ModelAsset;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static Matrix *instanceTransforms = NULL;   // Instance transforms staging array (combined with model transform), it only grows
+static int instanceCapacity = 0;            // Instance transforms staging array size
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_OBJ)
-static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
+static Model LoadOBJ(const char *fileName, Image **mapImages);     // Load OBJ mesh data
 #endif
 #if defined(SUPPORT_FILEFORMAT_IQM)
 static Model LoadIQM(const char *fileName);     // Load IQM mesh data
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
-static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
+static Model LoadGLTF(const char *fileName, Image **mapImages);    // Load GLTF mesh data
 #endif
 
+static Model LoadModelData(const char *fileName, Image **mapImages);       // Load model data from file (CPU only), material maps images kept if mapImages provided
+static Model UploadModel(const char *fileName, Model model, Image *mapImages);  // Upload model meshes and material maps images into GPU memory (default mesh and material if required)
+static void SetMaterialMapImage(Model *model, int material, int mapType, Image image, Image *mapImages);   // Set material map texture from image (kept in mapImages if provided)
+static bool DecodeModelAsset(void *asset, const char *fileName);   // Load model asset data (loader thread)
+static bool UploadModelAsset(void *asset, const char *fileName);   // Upload model asset into GPU memory (main thread)
+static void UnloadModelAsset(void *asset);                         // Unload model asset not retrieved
+
+static Matrix GetBoneMatrix(Transform bindPose, Transform pose);    // Get bone transformation matrix from bind pose to animated pose
+static Transform LerpTransform(Transform start, Transform end, float amount);  // Interpolate bone transforms (lerp translation and scale, slerp rotation)
+static float GetTransformError(Transform a, Transform b);            // Get max error between bone transforms (distance and rotation angle)
+static void SkinMeshVertices(void *data, int start, int end);       // Skin mesh vertex range on CPU (blending up to 4 bones per vertex)
+static int GetMeshTriangleCount(Mesh mesh);                         // Get mesh triangles count (indexed or not)
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c);  // Get mesh triangle vertices (local space)
+static void BuildBVHNode(MeshBVH *bvh, int nodeIndex, int first, int count, Vector3 *centroids, Mesh mesh);     // Build BVH node (recursive)
+static bool CheckCollisionRayBVHNode(Ray ray, Vector3 invDir, BVHNode node, float maxDistance);       // Check ray against BVH node bounds
+static void GetCollisionRaysRange(void *data, int start, int end);  // Check rays range collisions against model
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -647,50 +721,27 @@ void DrawGizmo(Vector3 position)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
-    Model model = { 0 };
-
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
-#endif
-
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    Model model = LoadModelData(fileName, NULL);
 
-    if (model.meshCount == 0)
-    {
-        model.meshCount = 1;
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-#if defined(SUPPORT_MESH_GENERATION)
-        TRACELOG(LOG_WARNING, "[%s] No meshes can be loaded, default to cube mesh", fileName);
-        model.meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
-#else
-        TRACELOG(LOG_WARNING, "[%s] No meshes can be loaded, and can't create a default mesh. The raylib mesh generation is not supported (SUPPORT_MESH_GENERATION).", fileName);
-#endif
-    }
-    else
-    {
-        // Upload vertex data to GPU (static mesh)
-        for (int i = 0; i < model.meshCount; i++) rlLoadMesh(&model.meshes[i], false);
-    }
+    return UploadModel(fileName, model, NULL);
+}
 
-    if (model.materialCount == 0)
-    {
-        TRACELOG(LOG_WARNING, "[%s] No materials can be loaded, default to white material", fileName);
+// Request model loading on background, returns asset handle
+// NOTE: Model data and material maps images are loaded on a loader thread, uploaded by PollAssetLoads()
+unsigned int LoadModelAsync(const char *fileName)
+{
+    return RequestAssetLoad(fileName, ASSET_TYPE_MODEL, NULL, sizeof(ModelAsset), DecodeModelAsset, UploadModelAsset, UnloadModelAsset);
+}
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+// Get loaded model and release asset handle
+// NOTE: Returns an empty model if asset is not loaded yet (handle is kept)
+Model GetAssetModel(unsigned int asset)
+{
+    ModelAsset data = { 0 };
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-    }
+    TakeAssetData(asset, ASSET_TYPE_MODEL, &data, sizeof(ModelAsset));
 
-    return model;
+    return data.model;
 }
 
 // Load model from generated mesh
@@ -753,6 +804,13 @@ Mesh *LoadMeshes(const char *fileName, int *meshCount)
 // Unload mesh from memory (RAM and/or VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    if (mesh.bvh != NULL)
+    {
+        RL_FREE(mesh.bvh->nodes);
+        RL_FREE(mesh.bvh->triangles);
+        RL_FREE(mesh.bvh);
+    }
+
     rlUnloadMesh(mesh);
     RL_FREE(mesh.vboId);
 }
@@ -969,7 +1027,7 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
     IQMAnim *anim = RL_MALLOC(iqm.num_anims*sizeof(IQMAnim));
     fseek(iqmFile, iqm.ofs_anims, SEEK_SET);
     fread(anim, iqm.num_anims*sizeof(IQMAnim), 1, iqmFile);
-    ModelAnimation *animations = RL_MALLOC(iqm.num_anims*sizeof(ModelAnimation));
+    ModelAnimation *animations = RL_CALLOC(iqm.num_anims, sizeof(ModelAnimation));
 
     // frameposes
     unsigned short *framedata = RL_MALLOC(iqm.num_frames*iqm.num_framechannels*sizeof(unsigned short));
@@ -1108,77 +1166,298 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
 }
 
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    if ((anim.frameCount > 0) && (anim.bones != NULL))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
+        if (anim.framePoses != NULL) UpdateModelAnimationPose(model, anim.framePoses[frame]);
+        else UpdateModelAnimationEx(model, anim, (float)frame);
+    }
+}
+
+// Update model animated vertex data for a fractional frame
+// NOTE: Bones transforms are interpolated between the two closest (key)frames, animation loops
+void UpdateModelAnimationEx(Model model, ModelAnimation anim, float frame)
+{
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.boneCount == model.boneCount))
+    {
+        Transform *pose = (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform));
+
+        GetModelAnimationPose(anim, frame, pose);
+        UpdateModelAnimationPose(model, pose);
+
+        RL_FREE(pose);
+    }
+}
+
+// Update model animated vertex data cross-fading multiple animations
+// NOTE: Every animation is sampled at its own (fractional) frame and poses are blended by weight,
+// weights do not need to be normalized and animations not matching model skeleton are skipped
+void UpdateModelAnimationBlend(Model model, ModelAnimation *anims, float *frames, float *weights, int count)
+{
+    if ((anims == NULL) || (frames == NULL) || (weights == NULL) || (model.boneCount <= 0)) return;
+
+    Transform *pose = (Transform *)RL_CALLOC(model.boneCount, sizeof(Transform));
+    Transform *sample = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+    float totalWeight = 0.0f;
+
+    for (int a = 0; a < count; a++)
+    {
+        if ((weights[a] <= 0.0f) || (anims[a].frameCount <= 0) || (anims[a].boneCount != model.boneCount)) continue;
+
+        GetModelAnimationPose(anims[a], frames[a], sample);
+        totalWeight += weights[a];
+
+        for (int b = 0; b < model.boneCount; b++)
+        {
+            pose[b].translation = Vector3Add(pose[b].translation, Vector3Scale(sample[b].translation, weights[a]));
+            pose[b].scale = Vector3Add(pose[b].scale, Vector3Scale(sample[b].scale, weights[a]));
+
+            // Rotations are accumulated on the same hemisphere (q and -q represent the same rotation)
+            Quaternion rotation = sample[b].rotation;
+            float dot = pose[b].rotation.x*rotation.x + pose[b].rotation.y*rotation.y + pose[b].rotation.z*rotation.z + pose[b].rotation.w*rotation.w;
+            float weight = (dot < 0.0f)? -weights[a] : weights[a];
+
+            pose[b].rotation.x += rotation.x*weight;
+            pose[b].rotation.y += rotation.y*weight;
+            pose[b].rotation.z += rotation.z*weight;
+            pose[b].rotation.w += rotation.w*weight;
+        }
+    }
+
+    if (totalWeight > 0.0f)
+    {
+        for (int b = 0; b < model.boneCount; b++)
+        {
+            pose[b].translation = Vector3Scale(pose[b].translation, 1.0f/totalWeight);
+            pose[b].scale = Vector3Scale(pose[b].scale, 1.0f/totalWeight);
+            pose[b].rotation = QuaternionNormalize(pose[b].rotation);
+        }
+
+        UpdateModelAnimationPose(model, pose);
+    }
+
+    RL_FREE(sample);
+    RL_FREE(pose);
+}
+
+// Update model animated vertex data from custom pose (one transform per model bone)
+// NOTE: If GPU skinning is supported by mesh material shader, only bones transformation matrices
+// are updated (computed once per model), otherwise vertex data is animated on CPU and uploaded to GPU,
+// blending up to 4 bones per vertex, using SIMD instructions (if available) and worker threads for big meshes
+void UpdateModelAnimationPose(Model model, Transform *pose)
+{
+    if ((pose != NULL) && (model.boneCount > 0) && (model.bindPose != NULL))
+    {
+        Matrix *boneMatrices = NULL;    // Bones transformation matrices for current frame (shared by all meshes)
+        float16 *palette = NULL;        // Bones transformation matrices for current frame (column-major, CPU skinning)
+
         for (int m = 0; m < model.meshCount; m++)
         {
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+            // Check GPU skinning support: bones data uploaded and material shader supports it (with model bones count)
+            // NOTE: Skinning path is decided on every update, material shader could have changed since last one
+            if ((model.meshes[m].boneIds != NULL) && (model.meshes[m].vboId[7] != 0) &&
+                rlCheckSkinningSupport(model.materials[model.meshMaterial[m]].shader, model.boneCount))
+            {
+                if (model.meshes[m].boneMatrices == NULL)
+                {
+                    model.meshes[m].boneMatrices = (Matrix *)RL_CALLOC(model.boneCount, sizeof(Matrix));
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            Vector3 inScale = { 0 };
+                    // Vertex buffers could contain CPU skinned data from previous updates, bind pose is restored
+                    if (model.meshes[m].animVertices != NULL) rlUpdateBuffer(model.meshes[m].vboId[0], model.meshes[m].vertices, model.meshes[m].vertexCount*3*sizeof(float));
+                    if ((model.meshes[m].animNormals != NULL) && (model.meshes[m].normals != NULL)) rlUpdateBuffer(model.meshes[m].vboId[2], model.meshes[m].normals, model.meshes[m].vertexCount*3*sizeof(float));
+                }
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+                model.meshes[m].boneCount = model.boneCount;
 
-            int vCounter = 0;
-            int boneCounter = 0;
-            int boneId = 0;
+                if (boneMatrices == NULL)
+                {
+                    for (int b = 0; b < model.boneCount; b++) model.meshes[m].boneMatrices[b] = GetBoneMatrix(model.bindPose[b], pose[b]);
+                    boneMatrices = model.meshes[m].boneMatrices;
+                }
+                else memcpy(model.meshes[m].boneMatrices, boneMatrices, model.boneCount*sizeof(Matrix));
 
-            for (int i = 0; i < model.meshes[m].vertexCount; i++)
+                continue;
+            }
+
+            // CPU skinning, bones matrices from previous GPU skinning updates are released,
+            // so mesh is not drawn with skinning shader on top of CPU skinned vertex data
+            if (model.meshes[m].boneMatrices != NULL)
+            {
+                RL_FREE(model.meshes[m].boneMatrices);
+                model.meshes[m].boneMatrices = NULL;
+                model.meshes[m].boneCount = 0;
+            }
+
+            // CPU skinning, vertex ranges are processed in parallel by worker threads
+            if ((model.meshes[m].boneIds == NULL) || (model.meshes[m].boneWeights == NULL) || (model.meshes[m].animVertices == NULL)) continue;
+
+            if (palette == NULL)
             {
-                boneId = model.meshes[m].boneIds[boneCounter];
-                inTranslation = model.bindPose[boneId].translation;
-                inRotation = model.bindPose[boneId].rotation;
-                inScale = model.bindPose[boneId].scale;
-                outTranslation = anim.framePoses[frame][boneId].translation;
-                outRotation = anim.framePoses[frame][boneId].rotation;
-                outScale = anim.framePoses[frame][boneId].scale;
-
-                // Vertices processing
-                // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                animVertex = (Vector3){ model.meshes[m].vertices[vCounter], model.meshes[m].vertices[vCounter + 1], model.meshes[m].vertices[vCounter + 2] };
-                animVertex = Vector3Multiply(animVertex, outScale);
-                animVertex = Vector3Subtract(animVertex, inTranslation);
-                animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                animVertex = Vector3Add(animVertex, outTranslation);
-                model.meshes[m].animVertices[vCounter] = animVertex.x;
-                model.meshes[m].animVertices[vCounter + 1] = animVertex.y;
-                model.meshes[m].animVertices[vCounter + 2] = animVertex.z;
-
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                animNormal = (Vector3){ model.meshes[m].normals[vCounter], model.meshes[m].normals[vCounter + 1], model.meshes[m].normals[vCounter + 2] };
-                animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                model.meshes[m].animNormals[vCounter] = animNormal.x;
-                model.meshes[m].animNormals[vCounter + 1] = animNormal.y;
-                model.meshes[m].animNormals[vCounter + 2] = animNormal.z;
-                vCounter += 3;
-
-                boneCounter += 4;
+                palette = (float16 *)RL_MALLOC(model.boneCount*sizeof(float16));
+
+                for (int b = 0; b < model.boneCount; b++)
+                {
+                    palette[b] = MatrixToFloatV((boneMatrices != NULL)? boneMatrices[b] : GetBoneMatrix(model.bindPose[b], pose[b]));
+                }
             }
 
+            SkinningData skinning = { 0 };
+            skinning.palette = palette;
+            skinning.boneCount = model.boneCount;
+            skinning.vertices = model.meshes[m].vertices;
+            skinning.normals = (model.meshes[m].animNormals != NULL)? model.meshes[m].normals : NULL;    // Normals are optional (could be NULL)
+            skinning.boneIds = model.meshes[m].boneIds;
+            skinning.boneWeights = model.meshes[m].boneWeights;
+            skinning.animVertices = model.meshes[m].animVertices;
+            skinning.animNormals = model.meshes[m].animNormals;
+
+            ProcessParallel(model.meshes[m].vertexCount, SKINNING_GRAIN_SIZE, SkinMeshVertices, &skinning);
+
             // Upload new vertex data to GPU for model drawing
             rlUpdateBuffer(model.meshes[m].vboId[0], model.meshes[m].animVertices, model.meshes[m].vertexCount*3*sizeof(float));    // Update vertex position
-            rlUpdateBuffer(model.meshes[m].vboId[2], model.meshes[m].animNormals, model.meshes[m].vertexCount*3*sizeof(float));     // Update vertex normals
+            if (skinning.normals != NULL) rlUpdateBuffer(model.meshes[m].vboId[2], model.meshes[m].animNormals, model.meshes[m].vertexCount*3*sizeof(float));     // Update vertex normals
         }
+
+        RL_FREE(palette);
     }
 }
 
+// Get animation pose (bones transforms) for a fractional frame, pose must hold anim.boneCount transforms
+// NOTE: Animation loops, frames between last and first frame are interpolated between them
+void GetModelAnimationPose(ModelAnimation anim, float frame, Transform *pose)
+{
+    if ((anim.frameCount <= 0) || (pose == NULL)) return;
+
+    frame = fmodf(frame, (float)anim.frameCount);
+    if (frame < 0.0f) frame += (float)anim.frameCount;
+
+    int frame0 = (int)frame;
+    if (frame0 >= anim.frameCount) frame0 = anim.frameCount - 1;    // Float rounding on negative frames wrapping
+
+    if (anim.framePoses != NULL)
+    {
+        int frame1 = (frame0 + 1)%anim.frameCount;
+        float amount = frame - (float)frame0;
+
+        for (int b = 0; b < anim.boneCount; b++)
+        {
+            if (amount > 0.0f) pose[b] = LerpTransform(anim.framePoses[frame0][b], anim.framePoses[frame1][b], amount);
+            else pose[b] = anim.framePoses[frame0][b];
+        }
+    }
+    else if ((anim.keyPoses != NULL) && (anim.boneKeys != NULL))
+    {
+        for (int b = 0; b < anim.boneCount; b++)
+        {
+            int first = anim.boneKeys[b];
+            int last = anim.boneKeys[b + 1] - 1;
+
+            // Binary search last keyframe before required frame
+            int low = first;
+            int high = last;
+
+            while (low < high)
+            {
+                int mid = (low + high + 1)/2;
+
+                if (anim.keyFrames[mid] <= frame0) low = mid;
+                else high = mid - 1;
+            }
+
+            int next = (low < last)? low + 1 : first;
+            int span = (low < last)? (anim.keyFrames[next] - anim.keyFrames[low]) : (anim.frameCount - anim.keyFrames[low]);
+            float amount = (frame - (float)anim.keyFrames[low])/(float)span;
+
+            if ((amount > 0.0f) && (next != low)) pose[b] = LerpTransform(anim.keyPoses[low], anim.keyPoses[next], amount);
+            else pose[b] = anim.keyPoses[low];
+        }
+    }
+}
+
+// Compress animation keyframes, dropping the ones that can be interpolated within tolerance
+// NOTE: Every bone keeps its own keyframes (first and last frames always kept), tolerance is the max error allowed
+// for translation and scale (distance) and rotation (angle in radians). Once compressed, anim.framePoses is freed
+// and set to NULL, animation must be sampled with GetModelAnimationPose()
+void CompressModelAnimation(ModelAnimation *anim, float tolerance)
+{
+    if ((anim == NULL) || (anim->framePoses == NULL) || (anim->frameCount <= 0) || (anim->boneCount <= 0)) return;
+
+    if (tolerance < 0.0f) tolerance = 0.0f;
+
+    int *boneKeys = (int *)RL_MALLOC((anim->boneCount + 1)*sizeof(int));
+    int *keyFrames = (int *)RL_MALLOC(anim->frameCount*anim->boneCount*sizeof(int));
+    Transform *keyPoses = (Transform *)RL_MALLOC(anim->frameCount*anim->boneCount*sizeof(Transform));
+    int keyCount = 0;
+
+    for (int b = 0; b < anim->boneCount; b++)
+    {
+        boneKeys[b] = keyCount;
+
+        keyFrames[keyCount] = 0;
+        keyPoses[keyCount] = anim->framePoses[0][b];
+        keyCount++;
+
+        int key = 0;
+
+        while (key < (anim->frameCount - 1))
+        {
+            // Extend interpolated range while all in-between frames are within tolerance
+            int end = key + 1;
+
+            while ((end + 1) < anim->frameCount)
+            {
+                bool valid = true;
+
+                for (int i = key + 1; i <= end; i++)
+                {
+                    Transform interpolated = LerpTransform(anim->framePoses[key][b], anim->framePoses[end + 1][b], (float)(i - key)/(float)(end + 1 - key));
+
+                    if (GetTransformError(interpolated, anim->framePoses[i][b]) > tolerance) { valid = false; break; }
+                }
+
+                if (valid) end++;
+                else break;
+            }
+
+            keyFrames[keyCount] = end;
+            keyPoses[keyCount] = anim->framePoses[end][b];
+            keyCount++;
+
+            key = end;
+        }
+    }
+
+    boneKeys[anim->boneCount] = keyCount;
+
+    TRACELOG(LOG_INFO, "Animation compressed: %i keyframes from %i poses (%i frames, %i bones)", keyCount, anim->frameCount*anim->boneCount, anim->frameCount, anim->boneCount);
+
+    for (int i = 0; i < anim->frameCount; i++) RL_FREE(anim->framePoses[i]);
+    RL_FREE(anim->framePoses);
+    anim->framePoses = NULL;
+
+    anim->keyCount = keyCount;
+    anim->boneKeys = boneKeys;
+    anim->keyFrames = (int *)RL_REALLOC(keyFrames, keyCount*sizeof(int));
+    anim->keyPoses = (Transform *)RL_REALLOC(keyPoses, keyCount*sizeof(Transform));
+}
+
 // Unload animation data
 void UnloadModelAnimation(ModelAnimation anim)
 {
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    }
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
+
+    RL_FREE(anim.boneKeys);
+    RL_FREE(anim.keyFrames);
+    RL_FREE(anim.keyPoses);
 }
 
 // Check model animation skeleton match
@@ -2382,6 +2661,50 @@ void MeshBinormals(Mesh *mesh)
     }
 }
 
+// Generate mesh bounding volume hierarchy (local space), used to speed-up ray collisions
+// NOTE: BVH is built from mesh.vertices (default pose), it must be re-generated if vertex data changes
+void GenMeshBVH(Mesh *mesh)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL)) return;
+
+    if (mesh->bvh != NULL)
+    {
+        RL_FREE(mesh->bvh->nodes);
+        RL_FREE(mesh->bvh->triangles);
+        RL_FREE(mesh->bvh);
+        mesh->bvh = NULL;
+    }
+
+    int triangleCount = GetMeshTriangleCount(*mesh);
+    if (triangleCount <= 0) return;
+
+    MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+    bvh->triangleCount = triangleCount;
+    bvh->triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    bvh->nodes = (BVHNode *)RL_MALLOC(2*triangleCount*sizeof(BVHNode));     // Max nodes: 2*leafs - 1
+    bvh->nodeCount = 1;
+
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(*mesh, i, &a, &b, &c);
+
+        bvh->triangles[i] = i;
+        centroids[i] = Vector3Scale(Vector3Add(Vector3Add(a, b), c), 1.0f/3.0f);
+    }
+
+    BuildBVHNode(bvh, 0, 0, triangleCount, centroids, *mesh);
+
+    RL_FREE(centroids);
+
+    bvh->nodes = (BVHNode *)RL_REALLOC(bvh->nodes, bvh->nodeCount*sizeof(BVHNode));
+    mesh->bvh = bvh;
+
+    TRACELOGD("Mesh BVH generated: %i triangles, %i nodes", triangleCount, bvh->nodeCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -2402,26 +2725,47 @@ void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rota
 
     Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+    DrawModelInstanced(model, &matTransform, &tint, 1);
+}
+
+// Draw a model multiple times with transforms
+// NOTE: Every mesh is drawn once for all the instances (GPU instancing if supported),
+// tints (optional) are multiplied by materials diffuse color
+void DrawModelInstanced(Model model, Matrix *transforms, Color *tints, int count)
+{
+    if (count <= 0) return;
+
+    // Combine model transformation matrix (model.transform) with instances transforms
+    // NOTE: Staging array is reused between draws, no combination required for identity model transform
+    Matrix identity = MatrixIdentity();
+    Matrix *matTransforms = transforms;
 
-    for (int i = 0; i < model.meshCount; i++)
+    if (memcmp(&model.transform, &identity, sizeof(Matrix)) != 0)
     {
-        // TODO: Review color + tint premultiplication mechanism
-        Color color = model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color;
+        if (instanceCapacity < count)
+        {
+            RL_FREE(instanceTransforms);
+            instanceTransforms = (Matrix *)RL_MALLOC(count*sizeof(Matrix));
+            instanceCapacity = count;
+        }
+
+        for (int i = 0; i < count; i++) instanceTransforms[i] = MatrixMultiply(model.transform, transforms[i]);
 
-        Color colorTint = WHITE;
-        colorTint.r = (((float)color.r/255.0)*((float)tint.r/255.0))*255;
-        colorTint.g = (((float)color.g/255.0)*((float)tint.g/255.0))*255;
-        colorTint.b = (((float)color.b/255.0)*((float)tint.b/255.0))*255;
-        colorTint.a = (((float)color.a/255.0)*((float)tint.a/255.0))*255;
+        matTransforms = instanceTransforms;
+    }
 
-        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = colorTint;
-        rlDrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = color;
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        rlDrawMeshInstanced(model.meshes[i], model.materials[model.meshMaterial[i]], matTransforms, tints, count);
     }
 }
 
+// Draw a 3d mesh multiple times with material and transforms
+void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int count)
+{
+    rlDrawMeshInstanced(mesh, material, transforms, NULL, count);
+}
+
 // Draw a model wires (with texture if set)
 void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
 {
@@ -2646,55 +2990,158 @@ bool CheckCollisionRayBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and model
+// NOTE: Meshes BVH are only used if generated by user (see GenMeshBVH()), otherwise all triangles are checked
 RayHitInfo GetCollisionRayModel(Ray ray, Model model)
 {
     RayHitInfo result = { 0 };
 
     for (int m = 0; m < model.meshCount; m++)
     {
-        // Check if meshhas vertex data on CPU for testing
+        // Check if mesh has vertex data on CPU for testing
         if (model.meshes[m].vertices != NULL)
         {
-            // model->mesh.triangleCount may not be set, vertexCount is more reliable
-            int triangleCount = model.meshes[m].vertexCount/3;
+            RayHitInfo meshHitInfo = GetCollisionRayMesh(ray, model.meshes[m], model.transform);
 
-            // Test against all triangles in mesh
-            for (int i = 0; i < triangleCount; i++)
+            if (meshHitInfo.hit)
             {
-                Vector3 a, b, c;
-                Vector3 *vertdata = (Vector3 *)model.meshes[m].vertices;
+                // Save the closest hit mesh
+                if ((!result.hit) || (result.distance > meshHitInfo.distance)) result = meshHitInfo;
+            }
+        }
+    }
+
+    return result;
+}
+
+// Get collision info between ray and mesh (transformed)
+// NOTE: Ray is transformed into mesh local space, mesh BVH is used if available (see GenMeshBVH()),
+// BVH is not validated against current vertices, it must be re-generated after editing mesh.vertices
+RayHitInfo GetCollisionRayMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayHitInfo result = { 0 };
 
-                if (model.meshes[m].indices)
+    if (mesh.vertices == NULL) return result;
+
+    // Transform ray into mesh local space, direction is not normalized
+    // so distance along the ray is the same in both spaces
+    Matrix invTransform = MatrixInvert(transform);
+    Ray localRay = { 0 };
+    localRay.position = Vector3Transform(ray.position, invTransform);
+    localRay.direction = Vector3Subtract(Vector3Transform(Vector3Add(ray.position, ray.direction), invTransform), localRay.position);
+
+    int hitTriangle = -1;
+    float hitDistance = 0.0f;
+
+    if (mesh.bvh != NULL)
+    {
+        Vector3 invDir = { 1.0f/localRay.direction.x, 1.0f/localRay.direction.y, 1.0f/localRay.direction.z };
+
+        int stack[BVH_MAX_DEPTH*2] = { 0 };
+        int stackCount = 0;
+
+        if (CheckCollisionRayBVHNode(localRay, invDir, mesh.bvh->nodes[0], -1.0f)) stack[stackCount++] = 0;
+
+        while (stackCount > 0)
+        {
+            BVHNode node = mesh.bvh->nodes[stack[--stackCount]];
+
+            // Skip nodes farther than closest hit (node was pushed before hit was found)
+            if ((hitTriangle >= 0) && !CheckCollisionRayBVHNode(localRay, invDir, node, hitDistance)) continue;
+
+            if (node.count > 0)
+            {
+                for (int i = node.first; i < (node.first + node.count); i++)
                 {
-                    a = vertdata[model.meshes[m].indices[i*3 + 0]];
-                    b = vertdata[model.meshes[m].indices[i*3 + 1]];
-                    c = vertdata[model.meshes[m].indices[i*3 + 2]];
+                    Vector3 a, b, c;
+                    GetMeshTriangle(mesh, mesh.bvh->triangles[i], &a, &b, &c);
+
+                    RayHitInfo triHitInfo = GetCollisionRayTriangle(localRay, a, b, c);
+
+                    if (triHitInfo.hit && ((hitTriangle < 0) || (triHitInfo.distance < hitDistance)))
+                    {
+                        hitTriangle = mesh.bvh->triangles[i];
+                        hitDistance = triHitInfo.distance;
+                    }
                 }
-                else
+            }
+            else
+            {
+                // Push children (closest child pushed last to be processed first)
+                float maxDistance = (hitTriangle >= 0)? hitDistance : -1.0f;
+                bool hitLeft = CheckCollisionRayBVHNode(localRay, invDir, mesh.bvh->nodes[node.first], maxDistance);
+                bool hitRight = CheckCollisionRayBVHNode(localRay, invDir, mesh.bvh->nodes[node.first + 1], maxDistance);
+
+                if (hitLeft && hitRight)
                 {
-                    a = vertdata[i*3 + 0];
-                    b = vertdata[i*3 + 1];
-                    c = vertdata[i*3 + 2];
+                    Vector3 leftCenter = Vector3Scale(Vector3Add(mesh.bvh->nodes[node.first].min, mesh.bvh->nodes[node.first].max), 0.5f);
+                    Vector3 rightCenter = Vector3Scale(Vector3Add(mesh.bvh->nodes[node.first + 1].min, mesh.bvh->nodes[node.first + 1].max), 0.5f);
+
+                    if (Vector3DotProduct(Vector3Subtract(leftCenter, rightCenter), localRay.direction) > 0.0f)
+                    {
+                        stack[stackCount++] = node.first;
+                        stack[stackCount++] = node.first + 1;
+                    }
+                    else
+                    {
+                        stack[stackCount++] = node.first + 1;
+                        stack[stackCount++] = node.first;
+                    }
                 }
+                else if (hitLeft) stack[stackCount++] = node.first;
+                else if (hitRight) stack[stackCount++] = node.first + 1;
+            }
+        }
+    }
+    else
+    {
+        // Test against all triangles in mesh
+        int triangleCount = GetMeshTriangleCount(mesh);
 
-                a = Vector3Transform(a, model.transform);
-                b = Vector3Transform(b, model.transform);
-                c = Vector3Transform(c, model.transform);
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            GetMeshTriangle(mesh, i, &a, &b, &c);
 
-                RayHitInfo triHitInfo = GetCollisionRayTriangle(ray, a, b, c);
+            RayHitInfo triHitInfo = GetCollisionRayTriangle(localRay, a, b, c);
 
-                if (triHitInfo.hit)
-                {
-                    // Save the closest hit triangle
-                    if ((!result.hit) || (result.distance > triHitInfo.distance)) result = triHitInfo;
-                }
+            if (triHitInfo.hit && ((hitTriangle < 0) || (triHitInfo.distance < hitDistance)))
+            {
+                hitTriangle = i;
+                hitDistance = triHitInfo.distance;
             }
         }
     }
 
+    if (hitTriangle >= 0)
+    {
+        // Hit normal is computed from transformed triangle (only once)
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, hitTriangle, &a, &b, &c);
+
+        a = Vector3Transform(a, transform);
+        b = Vector3Transform(b, transform);
+        c = Vector3Transform(c, transform);
+
+        result.hit = true;
+        result.distance = hitDistance;
+        result.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+        result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, hitDistance));
+    }
+
     return result;
 }
 
+// Get collision info between multiple rays and model, hits must hold count elements
+// NOTE: Meshes BVH are only used if generated by user (see GenMeshBVH()), rays are split between worker threads
+void GetCollisionRaysModel(Ray *rays, int count, Model model, RayHitInfo *hits)
+{
+    if ((rays == NULL) || (hits == NULL) || (count <= 0)) return;
+
+    RaysCollisionData data = { rays, model, hits };
+
+    ProcessParallel(count, RAYS_GRAIN_SIZE, GetCollisionRaysRange, &data);
+}
+
 // Get collision info between ray and triangle
 // NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
 RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
@@ -2781,11 +3228,373 @@ RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Get bone transformation matrix from bind pose to animated pose
+// NOTE: Matrix is built transforming the basis vectors, so it matches Vector3RotateByQuaternion() convention
+static Matrix GetBoneMatrix(Transform bindPose, Transform pose)
+{
+    Matrix result = MatrixIdentity();
+
+    // Bind pose scale could be zero on degenerated bones
+    Vector3 scale = pose.scale;
+    if (bindPose.scale.x != 0.0f) scale.x /= bindPose.scale.x;
+    if (bindPose.scale.y != 0.0f) scale.y /= bindPose.scale.y;
+    if (bindPose.scale.z != 0.0f) scale.z /= bindPose.scale.z;
+
+    Quaternion invRotation = QuaternionInvert(bindPose.rotation);
+
+    // Vertex transformation: bind space -> bone local space -> animated pose space
+    Vector3 basis[4] = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        Vector3 v = Vector3RotateByQuaternion(Vector3Subtract(basis[i], bindPose.translation), invRotation);
+        basis[i] = Vector3Add(Vector3RotateByQuaternion(Vector3Multiply(v, scale), pose.rotation), pose.translation);
+    }
+
+    // Matrix columns are the transformed basis vectors (relative to transformed origin)
+    result.m0 = basis[1].x - basis[0].x; result.m4 = basis[2].x - basis[0].x; result.m8 = basis[3].x - basis[0].x; result.m12 = basis[0].x;
+    result.m1 = basis[1].y - basis[0].y; result.m5 = basis[2].y - basis[0].y; result.m9 = basis[3].y - basis[0].y; result.m13 = basis[0].y;
+    result.m2 = basis[1].z - basis[0].z; result.m6 = basis[2].z - basis[0].z; result.m10 = basis[3].z - basis[0].z; result.m14 = basis[0].z;
+
+    return result;
+}
+
+// Get mesh triangles count (indexed or not)
+// NOTE: mesh.triangleCount may not be set for non-indexed meshes, vertexCount is more reliable
+static int GetMeshTriangleCount(Mesh mesh)
+{
+    return (mesh.indices != NULL)? mesh.triangleCount : mesh.vertexCount/3;
+}
+
+// Get mesh triangle vertices (local space)
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c)
+{
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    if (mesh.indices != NULL)
+    {
+        *a = vertdata[mesh.indices[index*3 + 0]];
+        *b = vertdata[mesh.indices[index*3 + 1]];
+        *c = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        *a = vertdata[index*3 + 0];
+        *b = vertdata[index*3 + 1];
+        *c = vertdata[index*3 + 2];
+    }
+}
+
+// Build BVH node (recursive)
+// NOTE: Triangles are split at the median centroid along the longest centroids extent axis, tree is
+// balanced so depth is always log2(triangleCount/BVH_MAX_LEAF_TRIANGLES). Centroids are stored (and swapped)
+// by triangle slot for sequential memory access and node bounds are computed bottom-up
+static void BuildBVHNode(MeshBVH *bvh, int nodeIndex, int first, int count, Vector3 *centroids, Mesh mesh)
+{
+    BVHNode *node = &bvh->nodes[nodeIndex];
+
+    if (count <= BVH_MAX_LEAF_TRIANGLES)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, bvh->triangles[first], &a, &b, &c);
+        node->min = a;
+        node->max = a;
+
+        for (int i = first; i < (first + count); i++)
+        {
+            GetMeshTriangle(mesh, bvh->triangles[i], &a, &b, &c);
+
+            node->min = Vector3Min(node->min, Vector3Min(a, Vector3Min(b, c)));
+            node->max = Vector3Max(node->max, Vector3Max(a, Vector3Max(b, c)));
+        }
+
+        node->first = first;
+        node->count = count;
+        return;
+    }
+
+    // Select split axis (longest centroids extent)
+    Vector3 centroidMin = centroids[first];
+    Vector3 centroidMax = centroids[first];
+
+    for (int i = first + 1; i < (first + count); i++)
+    {
+        centroidMin = Vector3Min(centroidMin, centroids[i]);
+        centroidMax = Vector3Max(centroidMax, centroids[i]);
+    }
+
+    Vector3 extent = Vector3Subtract(centroidMax, centroidMin);
+    int axis = 0;
+    if (extent.y > extent.x) axis = 1;
+    if ((extent.z > extent.x) && (extent.z > extent.y)) axis = 2;
+
+    // Partition triangles at median centroid (quickselect)
+    int *triangles = &bvh->triangles[first];
+    Vector3 *slots = &centroids[first];
+    int median = count/2;
+    int left = 0;
+    int right = count - 1;
+
+    while (left < right)
+    {
+        float pivot = ((float *)&slots[(left + right)/2])[axis];
+        int i = left;
+        int j = right;
+
+        while (i <= j)
+        {
+            while (((float *)&slots[i])[axis] < pivot) i++;
+            while (((float *)&slots[j])[axis] > pivot) j--;
+
+            if (i <= j)
+            {
+                int triangle = triangles[i];
+                triangles[i] = triangles[j];
+                triangles[j] = triangle;
+
+                Vector3 centroid = slots[i];
+                slots[i] = slots[j];
+                slots[j] = centroid;
+
+                i++;
+                j--;
+            }
+        }
+
+        if (median <= j) right = j;
+        else if (median >= i) left = i;
+        else break;
+    }
+
+    // Children nodes are allocated consecutively
+    int leftChild = bvh->nodeCount;
+    bvh->nodeCount += 2;
+
+    BuildBVHNode(bvh, leftChild, first, median, centroids, mesh);
+    BuildBVHNode(bvh, leftChild + 1, first + median, count - median, centroids, mesh);
+
+    // NOTE: Nodes array is not reallocated while building, node pointer is still valid
+    node->min = Vector3Min(bvh->nodes[leftChild].min, bvh->nodes[leftChild + 1].min);
+    node->max = Vector3Max(bvh->nodes[leftChild].max, bvh->nodes[leftChild + 1].max);
+    node->first = leftChild;
+    node->count = 0;
+}
+
+// Check ray against BVH node bounds (slabs method), maxDistance < 0 means no distance limit
+static bool CheckCollisionRayBVHNode(Ray ray, Vector3 invDir, BVHNode node, float maxDistance)
+{
+    float t1 = (node.min.x - ray.position.x)*invDir.x;
+    float t2 = (node.max.x - ray.position.x)*invDir.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (node.min.y - ray.position.y)*invDir.y;
+    t2 = (node.max.y - ray.position.y)*invDir.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (node.min.z - ray.position.z)*invDir.z;
+    t2 = (node.max.z - ray.position.z)*invDir.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    if ((tmax < 0.0f) || (tmin > tmax)) return false;
+    if ((maxDistance >= 0.0f) && (tmin > maxDistance)) return false;
+
+    return true;
+}
+
+// Check rays range collisions against model
+static void GetCollisionRaysRange(void *data, int start, int end)
+{
+    RaysCollisionData *collision = (RaysCollisionData *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        RayHitInfo result = { 0 };
+
+        for (int m = 0; m < collision->model.meshCount; m++)
+        {
+            RayHitInfo meshHitInfo = GetCollisionRayMesh(collision->rays[i], collision->model.meshes[m], collision->model.transform);
+
+            if (meshHitInfo.hit && ((!result.hit) || (result.distance > meshHitInfo.distance))) result = meshHitInfo;
+        }
+
+        collision->hits[i] = result;
+    }
+}
+
+// Interpolate bone transforms (lerp translation and scale, slerp rotation)
+static Transform LerpTransform(Transform start, Transform end, float amount)
+{
+    Transform result = { 0 };
+
+    result.translation = Vector3Lerp(start.translation, end.translation, amount);
+    result.scale = Vector3Lerp(start.scale, end.scale, amount);
+
+    // Interpolate through shortest path, q and -q represent the same rotation
+    Quaternion rotation = end.rotation;
+    if ((start.rotation.x*rotation.x + start.rotation.y*rotation.y + start.rotation.z*rotation.z + start.rotation.w*rotation.w) < 0.0f)
+    {
+        rotation = (Quaternion){ -rotation.x, -rotation.y, -rotation.z, -rotation.w };
+    }
+
+    result.rotation = QuaternionNormalize(QuaternionSlerp(start.rotation, rotation, amount));
+
+    return result;
+}
+
+// Get max error between bone transforms (translation and scale distance, rotation angle in radians)
+static float GetTransformError(Transform a, Transform b)
+{
+    float error = Vector3Distance(a.translation, b.translation);
+
+    float scaleError = Vector3Distance(a.scale, b.scale);
+    if (scaleError > error) error = scaleError;
+
+    float dot = fabsf(a.rotation.x*b.rotation.x + a.rotation.y*b.rotation.y + a.rotation.z*b.rotation.z + a.rotation.w*b.rotation.w);
+    float angleError = 2.0f*acosf((dot > 1.0f)? 1.0f : dot);
+    if (angleError > error) error = angleError;
+
+    return error;
+}
+
+// Skin mesh vertex range on CPU (blending up to 4 bones per vertex)
+// NOTE: Vertex weights are not normalized (same as GPU skinning), but unweighted vertex uses its first bone
+static void SkinMeshVertices(void *data, int start, int end)
+{
+    const SkinningData *skinning = (const SkinningData *)data;
+    const float *palette = (const float *)skinning->palette;
+
+    for (int i = start; i < end; i++)
+    {
+        const float *vertex = &skinning->vertices[i*3];
+        int boneIds[4] = { 0 };
+        float weights[4] = { 0 };
+        float totalWeight = 0.0f;
+
+        for (int k = 0; k < 4; k++)
+        {
+            boneIds[k] = skinning->boneIds[i*4 + k];
+            weights[k] = skinning->boneWeights[i*4 + k];
+
+            if ((boneIds[k] < 0) || (boneIds[k] >= skinning->boneCount)) { boneIds[k] = 0; weights[k] = 0.0f; }
+            totalWeight += weights[k];
+        }
+
+        if (totalWeight == 0.0f) weights[0] = 1.0f;
+
+        float position[4] = { 0 };
+        float normal[4] = { 0 };
+
+#if defined(SKINNING_SIMD_SSE)
+        // Blend bones matrices columns
+        __m128 col0 = _mm_setzero_ps();
+        __m128 col1 = _mm_setzero_ps();
+        __m128 col2 = _mm_setzero_ps();
+        __m128 col3 = _mm_setzero_ps();
+
+        for (int k = 0; k < 4; k++)
+        {
+            if (weights[k] == 0.0f) continue;
+
+            const float *matrix = &palette[boneIds[k]*16];
+            __m128 weight = _mm_set1_ps(weights[k]);
+
+            col0 = _mm_add_ps(col0, _mm_mul_ps(weight, _mm_loadu_ps(matrix)));
+            col1 = _mm_add_ps(col1, _mm_mul_ps(weight, _mm_loadu_ps(matrix + 4)));
+            col2 = _mm_add_ps(col2, _mm_mul_ps(weight, _mm_loadu_ps(matrix + 8)));
+            col3 = _mm_add_ps(col3, _mm_mul_ps(weight, _mm_loadu_ps(matrix + 12)));
+        }
+
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(vertex[0])), _mm_mul_ps(col1, _mm_set1_ps(vertex[1]))),
+                                   _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(vertex[2])), col3));
+        _mm_storeu_ps(position, result);
+
+        if (skinning->normals != NULL)
+        {
+            const float *n = &skinning->normals[i*3];
+            result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(n[0])), _mm_mul_ps(col1, _mm_set1_ps(n[1]))), _mm_mul_ps(col2, _mm_set1_ps(n[2])));
+            _mm_storeu_ps(normal, result);
+        }
+#elif defined(SKINNING_SIMD_NEON)
+        // Blend bones matrices columns
+        float32x4_t col0 = vdupq_n_f32(0.0f);
+        float32x4_t col1 = vdupq_n_f32(0.0f);
+        float32x4_t col2 = vdupq_n_f32(0.0f);
+        float32x4_t col3 = vdupq_n_f32(0.0f);
+
+        for (int k = 0; k < 4; k++)
+        {
+            if (weights[k] == 0.0f) continue;
+
+            const float *matrix = &palette[boneIds[k]*16];
+
+            col0 = vmlaq_n_f32(col0, vld1q_f32(matrix), weights[k]);
+            col1 = vmlaq_n_f32(col1, vld1q_f32(matrix + 4), weights[k]);
+            col2 = vmlaq_n_f32(col2, vld1q_f32(matrix + 8), weights[k]);
+            col3 = vmlaq_n_f32(col3, vld1q_f32(matrix + 12), weights[k]);
+        }
+
+        float32x4_t result = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, vertex[0]), col1, vertex[1]), col2, vertex[2]);
+        vst1q_f32(position, result);
+
+        if (skinning->normals != NULL)
+        {
+            const float *n = &skinning->normals[i*3];
+            result = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(col0, n[0]), col1, n[1]), col2, n[2]);
+            vst1q_f32(normal, result);
+        }
+#else
+        // Blend bones matrices (only first three rows required)
+        float matrix[12] = { 0 };
+
+        for (int k = 0; k < 4; k++)
+        {
+            if (weights[k] == 0.0f) continue;
+
+            const float *bone = &palette[boneIds[k]*16];
+
+            for (int c = 0; c < 4; c++)
+            {
+                matrix[c*3] += weights[k]*bone[c*4];
+                matrix[c*3 + 1] += weights[k]*bone[c*4 + 1];
+                matrix[c*3 + 2] += weights[k]*bone[c*4 + 2];
+            }
+        }
+
+        for (int r = 0; r < 3; r++) position[r] = matrix[r]*vertex[0] + matrix[3 + r]*vertex[1] + matrix[6 + r]*vertex[2] + matrix[9 + r];
+
+        if (skinning->normals != NULL)
+        {
+            const float *n = &skinning->normals[i*3];
+            for (int r = 0; r < 3; r++) normal[r] = matrix[r]*n[0] + matrix[3 + r]*n[1] + matrix[6 + r]*n[2];
+        }
+#endif
+        skinning->animVertices[i*3] = position[0];
+        skinning->animVertices[i*3 + 1] = position[1];
+        skinning->animVertices[i*3 + 2] = position[2];
+
+        if (skinning->normals != NULL)
+        {
+            // Blended matrices could include scaling, normal requires normalization
+            float length = sqrtf(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+            if (length > 0.0f) length = 1.0f/length;
+
+            skinning->animNormals[i*3] = normal[0]*length;
+            skinning->animNormals[i*3 + 1] = normal[1]*length;
+            skinning->animNormals[i*3 + 2] = normal[2]*length;
+        }
+    }
+}
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
-static Model LoadOBJ(const char *fileName)
+// NOTE: Material maps images are kept in mapImages to be uploaded later (if provided)
+static Model LoadOBJ(const char *fileName, Image **mapImages)
 {
     Model model = { 0 };
+    Image *maps = NULL;
 
     tinyobj_attrib_t attrib;
     tinyobj_shape_t *meshes = NULL;
@@ -2832,6 +3641,12 @@ static Model LoadOBJ(const char *fileName)
         {
             model.materialCount = materialCount;
             model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+            if (mapImages != NULL)
+            {
+                maps = (Image *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS, sizeof(Image));
+                *mapImages = maps;
+            }
         }
 
         model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
@@ -2936,21 +3751,21 @@ static Model LoadOBJ(const char *fileName)
 
             model.materials[m].maps[MAP_DIFFUSE].texture = GetTextureDefault();     // Get default texture, in case no texture is defined
 
-            if (materials[m].diffuse_texname != NULL) model.materials[m].maps[MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+            if (materials[m].diffuse_texname != NULL) SetMaterialMapImage(&model, m, MAP_DIFFUSE, LoadImage(materials[m].diffuse_texname), maps);  //char *diffuse_texname; // map_Kd
             model.materials[m].maps[MAP_DIFFUSE].color = (Color){ (float)(materials[m].diffuse[0]*255.0f), (float)(materials[m].diffuse[1]*255.0f), (float)(materials[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
             model.materials[m].maps[MAP_DIFFUSE].value = 0.0f;
 
-            if (materials[m].specular_texname != NULL) model.materials[m].maps[MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
+            if (materials[m].specular_texname != NULL) SetMaterialMapImage(&model, m, MAP_SPECULAR, LoadImage(materials[m].specular_texname), maps);  //char *specular_texname; // map_Ks
             model.materials[m].maps[MAP_SPECULAR].color = (Color){ (float)(materials[m].specular[0]*255.0f), (float)(materials[m].specular[1]*255.0f), (float)(materials[m].specular[2]*255.0f), 255 }; //float specular[3];
             model.materials[m].maps[MAP_SPECULAR].value = 0.0f;
 
-            if (materials[m].bump_texname != NULL) model.materials[m].maps[MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
+            if (materials[m].bump_texname != NULL) SetMaterialMapImage(&model, m, MAP_NORMAL, LoadImage(materials[m].bump_texname), maps);  //char *bump_texname; // map_bump, bump
             model.materials[m].maps[MAP_NORMAL].color = WHITE;
             model.materials[m].maps[MAP_NORMAL].value = materials[m].shininess;
 
             model.materials[m].maps[MAP_EMISSION].color = (Color){ (float)(materials[m].emission[0]*255.0f), (float)(materials[m].emission[1]*255.0f), (float)(materials[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-            if (materials[m].displacement_texname != NULL) model.materials[m].maps[MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
+            if (materials[m].displacement_texname != NULL) SetMaterialMapImage(&model, m, MAP_HEIGHT, LoadImage(materials[m].displacement_texname), maps);  //char *displacement_texname; // disp
         }
 
         tinyobj_attrib_free(&attrib);
@@ -3414,7 +4229,11 @@ static Image LoadImageFromCgltfImage(cgltf_image *image, const char *texPath, Co
         }
         else
         {
-            rimage = LoadImage(TextFormat("%s/%s", texPath, image->uri));
+            // NOTE: Local path buffer used (no TextFormat() static buffers), model could be loaded on a loader thread
+            char imagePath[512] = { 0 };
+            snprintf(imagePath, 512, "%s/%s", texPath, image->uri);
+
+            rimage = LoadImage(imagePath);
 
             // TODO: Tint shouldn't be applied here!
             ImageColorTint(&rimage, tint);
@@ -3451,7 +4270,8 @@ static Image LoadImageFromCgltfImage(cgltf_image *image, const char *texPath, Co
 }
 
 // LoadGLTF loads in model data from given filename, supporting both .gltf and .glb
-static Model LoadGLTF(const char *fileName)
+// NOTE: Material maps images are kept in mapImages to be uploaded later (if provided)
+static Model LoadGLTF(const char *fileName, Image **mapImages)
 {
     /***********************************************************************************
 
@@ -3529,11 +4349,28 @@ static Model LoadGLTF(const char *fileName)
 
         for (int i = 0; i < model.meshCount; i++) model.meshes[i].vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
 
+        Image *maps = NULL;
+
+        if (mapImages != NULL)
+        {
+            maps = (Image *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS, sizeof(Image));
+            *mapImages = maps;
+        }
+
+        // Textures path is model directory path
+        // NOTE: Local path buffer used (no GetDirectoryPath() static buffer), model could be loaded on a loader thread
+        char texPath[512] = { 0 };
+        int texPathLength = -1;
+
+        for (int i = 0; fileName[i] != '\0'; i++) if ((fileName[i] == '/') || (fileName[i] == '\\')) texPathLength = i;
+
+        if (texPathLength >= 0) snprintf(texPath, 512, "%.*s", texPathLength, fileName);
+        else strcpy(texPath, ".");
+
         for (int i = 0; i < model.materialCount - 1; i++)
         {
             model.materials[i] = LoadMaterialDefault();
             Color tint = (Color){ 255, 255, 255, 255 };
-            const char *texPath = GetDirectoryPath(fileName);
 
             //Ensure material follows raylib support for PBR (metallic/roughness flow)
             if (data->materials[i].has_pbr_metallic_roughness)
@@ -3548,8 +4385,7 @@ static Model LoadGLTF(const char *fileName)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
                     Image albedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath, tint);
-                    model.materials[i].maps[MAP_ALBEDO].texture = LoadTextureFromImage(albedo);
-                    UnloadImage(albedo);
+                    SetMaterialMapImage(&model, i, MAP_ALBEDO, albedo, maps);
                 }
 
                 //Set tint to white after it's been used by Albedo
@@ -3558,15 +4394,13 @@ static Model LoadGLTF(const char *fileName)
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
                     Image metallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath, tint);
-                    model.materials[i].maps[MAP_ROUGHNESS].texture = LoadTextureFromImage(metallicRoughness);
+                    SetMaterialMapImage(&model, i, MAP_ROUGHNESS, metallicRoughness, maps);
 
                     float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
                     model.materials[i].maps[MAP_ROUGHNESS].value = roughness;
 
                     float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
                     model.materials[i].maps[MAP_METALNESS].value = metallic;
-
-                    UnloadImage(metallicRoughness);
                 }
 
 
@@ -3574,26 +4408,23 @@ static Model LoadGLTF(const char *fileName)
                 if (data->materials[i].normal_texture.texture)
                 {
                     Image normalImage = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath, tint);
-                    model.materials[i].maps[MAP_NORMAL].texture = LoadTextureFromImage(normalImage);
-                    UnloadImage(normalImage);
+                    SetMaterialMapImage(&model, i, MAP_NORMAL, normalImage, maps);
                 }
 
                 if (data->materials[i].occlusion_texture.texture)
                 {
                     Image occulsionImage = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath, tint);
-                    model.materials[i].maps[MAP_OCCLUSION].texture = LoadTextureFromImage(occulsionImage);
-                    UnloadImage(occulsionImage);
+                    SetMaterialMapImage(&model, i, MAP_OCCLUSION, occulsionImage, maps);
                 }
 
                 if (data->materials[i].emissive_texture.texture)
                 {
                     Image emissiveImage = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath, tint);
-                    model.materials[i].maps[MAP_EMISSION].texture = LoadTextureFromImage(emissiveImage);
+                    SetMaterialMapImage(&model, i, MAP_EMISSION, emissiveImage, maps);
                     tint.r = (unsigned char)(data->materials[i].emissive_factor[0] * 255);
                     tint.g = (unsigned char)(data->materials[i].emissive_factor[1] * 255);
                     tint.b = (unsigned char)(data->materials[i].emissive_factor[2] * 255);
                     model.materials[i].maps[MAP_EMISSION].color = tint;
-                    UnloadImage(emissiveImage);
                 }
             }
         }
@@ -3685,3 +4516,134 @@ static Model LoadGLTF(const char *fileName)
     return model;
 }
 #endif
+
+// Load model data from file (CPU only)
+// NOTE: Material maps images are kept in mapImages to be uploaded by UploadModel() (if provided)
+static Model LoadModelData(const char *fileName, Image **mapImages)
+{
+    Model model = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName, mapImages);
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName, mapImages);
+#endif
+
+    return model;
+}
+
+// Upload model meshes and material maps images into GPU memory
+// NOTE: Default mesh and material are set if they could not be loaded, mapImages are unloaded
+static Model UploadModel(const char *fileName, Model model, Image *mapImages)
+{
+    // Make sure model transform is set to identity matrix!
+    model.transform = MatrixIdentity();
+
+    if (model.meshCount == 0)
+    {
+        model.meshCount = 1;
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+#if defined(SUPPORT_MESH_GENERATION)
+        TRACELOG(LOG_WARNING, "[%s] No meshes can be loaded, default to cube mesh", fileName);
+        model.meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
+#else
+        TRACELOG(LOG_WARNING, "[%s] No meshes can be loaded, and can't create a default mesh. The raylib mesh generation is not supported (SUPPORT_MESH_GENERATION).", fileName);
+#endif
+    }
+    else
+    {
+        // Upload vertex data to GPU (static mesh)
+        for (int i = 0; i < model.meshCount; i++) rlLoadMesh(&model.meshes[i], false);
+    }
+
+    // Upload material maps images loaded on CPU
+    // NOTE: mapImages are only provided by loaders when materials are loaded
+    if (mapImages != NULL)
+    {
+        for (int i = 0; i < model.materialCount*MAX_MATERIAL_MAPS; i++)
+        {
+            if (mapImages[i].data != NULL)
+            {
+                model.materials[i/MAX_MATERIAL_MAPS].maps[i%MAX_MATERIAL_MAPS].texture = LoadTextureFromImage(mapImages[i]);
+                UnloadImage(mapImages[i]);
+                mapImages[i] = (Image){ 0 };
+            }
+        }
+    }
+
+    if (model.materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "[%s] No materials can be loaded, default to white material", fileName);
+
+        model.materialCount = 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();
+
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    }
+
+    return model;
+}
+
+// Set material map texture from image, image is unloaded once uploaded
+// NOTE: If mapImages is provided, image is kept there to be uploaded by UploadModel()
+static void SetMaterialMapImage(Model *model, int material, int mapType, Image image, Image *mapImages)
+{
+    if ((mapImages != NULL) && (image.data != NULL)) mapImages[material*MAX_MATERIAL_MAPS + mapType] = image;
+    else
+    {
+        model->materials[material].maps[mapType].texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+}
+
+// Load model asset data (loader thread)
+// NOTE: Like LoadModel(), default mesh and material are used if model can not be loaded
+static bool DecodeModelAsset(void *asset, const char *fileName)
+{
+    ModelAsset *data = (ModelAsset *)asset;
+
+    data->model = LoadModelData(fileName, &data->mapImages);
+
+    return true;
+}
+
+// Upload model asset into GPU memory (main thread)
+static bool UploadModelAsset(void *asset, const char *fileName)
+{
+    ModelAsset *data = (ModelAsset *)asset;
+
+    data->model = UploadModel(fileName, data->model, data->mapImages);
+
+    RL_FREE(data->mapImages);
+    data->mapImages = NULL;
+
+    return true;
+}
+
+// Unload model asset not retrieved, it could be decoded but not uploaded yet
+// NOTE: Material maps textures are also unloaded, UnloadModel() does not unload them
+static void UnloadModelAsset(void *asset)
+{
+    ModelAsset *data = (ModelAsset *)asset;
+
+    if (data->mapImages != NULL)
+    {
+        for (int i = 0; i < data->model.materialCount*MAX_MATERIAL_MAPS; i++) UnloadImage(data->mapImages[i]);
+        RL_FREE(data->mapImages);
+    }
+
+    for (int i = 0; i < data->model.materialCount; i++)
+    {
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
+        {
+            if (data->model.materials[i].maps[j].texture.id != GetTextureDefault().id) UnloadTexture(data->model.materials[i].maps[j].texture);
+        }
+    }
+
+    UnloadModel(data->model);
+}
@@ -33,10 +33,21 @@
 *       Traces log messages when creating and destroying physics bodies and detects errors in physics
 *       calculations and reference exceptions; it is useful for debug purposes
 *
+*   #define PHYSAC_MAX_BODIES
+*   #define PHYSAC_MAX_MANIFOLDS
+*       Maximum number of physics bodies and collision manifolds (64 and 4096 by default), can be
+*       defined before including the implementation to simulate bigger worlds.
+*
+*   #define PHYSAC_TIME_TO_SLEEP
+*       Time in milliseconds a group of touching bodies (contact island) must stay at rest before
+*       it is put to sleep and skipped by physics steps (0 by default, sleeping disabled).
+*       Sleeping bodies are woken up by awake bodies contacts or when user changes their state.
+*
 *   #define PHYSAC_MALLOC()
 *   #define PHYSAC_FREE()
 *       You can define your own malloc/free implementation replacing stdlib.h malloc()/free() functions.
 *       Otherwise it will include stdlib.h and use the C standard library malloc()/free() function.
+*       NOTE: Physics bodies and manifolds are stored in static pools, physics steps do not allocate memory.
 *
 *
 *   NOTE 1: Physac requires multi-threading, when InitPhysics() a second thread is created to manage physics calculations.
@@ -94,8 +105,12 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define PHYSAC_MAX_BODIES               64
-#define PHYSAC_MAX_MANIFOLDS            4096
+#ifndef PHYSAC_MAX_BODIES
+    #define PHYSAC_MAX_BODIES           64
+#endif
+#ifndef PHYSAC_MAX_MANIFOLDS
+    #define PHYSAC_MAX_MANIFOLDS        4096
+#endif
 #define PHYSAC_MAX_VERTICES             24
 #define PHYSAC_CIRCLE_VERTICES          24
 
@@ -103,6 +118,12 @@
 #define PHYSAC_PENETRATION_ALLOWANCE    0.05f
 #define PHYSAC_PENETRATION_CORRECTION   0.4f
 
+#ifndef PHYSAC_TIME_TO_SLEEP
+    #define PHYSAC_TIME_TO_SLEEP        0.0f
+#endif
+#define PHYSAC_SLEEP_LINEAR_TOLERANCE   0.5f
+#define PHYSAC_SLEEP_ANGULAR_TOLERANCE  0.02f
+
 #define PHYSAC_PI                       3.14159265358979323846
 #define PHYSAC_DEG2RAD                  (PHYSAC_PI/180.0f)
 
@@ -173,7 +194,7 @@ PHYSACDEF void ClosePhysics(void);
 #if defined(PHYSAC_IMPLEMENTATION)
 
 #if !defined(PHYSAC_NO_THREADS)
-    #include <pthread.h>            // Required for: pthread_t, pthread_create()
+    #include <pthread.h>            // Required for: pthread_t, pthread_create(), pthread_mutex_*(), pthread_cond_*()
 #endif
 
 #if defined(PHYSAC_DEBUG)
@@ -220,6 +241,7 @@ PHYSACDEF void ClosePhysics(void);
 #define PHYSAC_EPSILON      0.000001f
 #define PHYSAC_K            1.0f/3.0f
 #define PHYSAC_VECTOR_ZERO  (Vector2){ 0.0f, 0.0f }
+#define PHYSAC_NO_ISLAND    0xffffffff
 
 //----------------------------------------------------------------------------------
 // Data Types Structure Definition
@@ -266,6 +288,7 @@ typedef struct PhysicsBodyData {
     bool useGravity;                            // Apply gravity force to dynamics
     bool isGrounded;                            // Physics grounded on other body state
     bool freezeOrient;                          // Physics rotation constraint
+    bool isSleeping;                            // Physics body resting, not simulated until woken up
     PhysicsShape shape;                         // Physics body shape information (type, radius, vertices, normals)
 } PhysicsBodyData;
 
@@ -282,13 +305,33 @@ typedef struct PhysicsManifoldData {
     float staticFriction;                       // Mixed static friction during collision
 } PhysicsManifoldData, *PhysicsManifold;
 
+// Axis-aligned bounding box (used by collisions broad phase)
+typedef struct PhysicsBounds {
+    Vector2 min;                                // Bounds minimum position (top-left corner)
+    Vector2 max;                                // Bounds maximum position (bottom-right corner)
+} PhysicsBounds;
+
+// Contact island (bodies connected by contacts, solved and put to sleep together)
+typedef struct PhysicsIsland {
+    unsigned int bodiesStart;                   // Island first body in islandBodies array
+    unsigned int bodiesCount;                   // Island bodies count
+    unsigned int contactsStart;                 // Island first manifold in islandContacts array
+    unsigned int contactsCount;                 // Island manifolds count
+    bool awake;                                 // Island has any awake body (solved in current step)
+} PhysicsIsland;
+
+// Pair of bodies with overlapping bounds (used to defer sleeping bodies narrow phase)
+typedef struct PhysicsBodiesPair {
+    PhysicsBody bodyA;                          // Pair first physics body reference
+    PhysicsBody bodyB;                          // Pair second physics body reference
+} PhysicsBodiesPair;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if !defined(PHYSAC_NO_THREADS)
 static pthread_t physicsThreadId;                           // Physics thread id
 #endif
-static unsigned int usedMemory = 0;                         // Total allocated dynamic memory
 static bool physicsThreadEnabled = false;                   // Physics thread enabled state
 static double baseTime = 0.0;                               // Offset time for MONOTONIC clock
 static double startTime = 0.0;                              // Start time in milliseconds
@@ -301,9 +344,32 @@ static unsigned int stepsCount = 0;                         // Total physics ste
 static Vector2 gravityForce = { 0.0f, 9.81f };              // Physics world gravity force
 static PhysicsBody bodies[PHYSAC_MAX_BODIES];               // Physics bodies pointers array
 static unsigned int physicsBodiesCount = 0;                 // Physics world current bodies counter
-static PhysicsManifold contacts[PHYSAC_MAX_MANIFOLDS];      // Physics bodies pointers array
+static PhysicsManifoldData contacts[PHYSAC_MAX_MANIFOLDS];  // Physics manifolds array (per-step arena, reset every step)
 static unsigned int physicsManifoldsCount = 0;              // Physics world current manifolds counter
 
+static PhysicsBodyData bodiesPool[PHYSAC_MAX_BODIES];       // Physics bodies data pool (contiguous, body id is pool slot)
+static unsigned int bodiesFreeIds[PHYSAC_MAX_BODIES];       // Physics bodies pool released slots (free list)
+static unsigned int bodiesFreeCount = 0;                    // Physics bodies pool released slots counter
+static unsigned int bodiesPoolCount = 0;                    // Physics bodies pool slots used at least once
+
+static PhysicsBounds bodiesBounds[PHYSAC_MAX_BODIES];       // Physics bodies bounds, updated every step (broad phase)
+static unsigned int broadPhaseOrder[PHYSAC_MAX_BODIES];     // Physics bodies indices sorted by bounds minimum x (sweep and prune)
+static unsigned int broadPhaseCount = 0;                    // Physics bodies indices sorted in previous step
+
+static unsigned int islandParents[PHYSAC_MAX_BODIES];       // Physics bodies island parent body id (union-find, by body id)
+static unsigned int bodiesIsland[PHYSAC_MAX_BODIES];        // Physics bodies island index (by body id), PHYSAC_NO_ISLAND for static bodies
+static float bodiesSleepTime[PHYSAC_MAX_BODIES];            // Physics bodies resting time in milliseconds (by body id)
+static Vector2 restPositions[PHYSAC_MAX_BODIES];            // Physics bodies position when started resting (by body id)
+static float restOrients[PHYSAC_MAX_BODIES];                // Physics bodies orientation when started resting (by body id)
+static PhysicsIsland islands[PHYSAC_MAX_BODIES];            // Physics contact islands of current step
+static unsigned int physicsIslandsCount = 0;                // Physics contact islands counter
+static unsigned int islandBodies[PHYSAC_MAX_BODIES];        // Physics bodies indices sorted by island
+static unsigned int islandContacts[PHYSAC_MAX_MANIFOLDS];   // Physics manifolds indices sorted by island
+static unsigned int awakeIslands[PHYSAC_MAX_BODIES];        // Physics contact islands indices solved in current step
+static unsigned int awakeIslandsCount = 0;                  // Physics contact islands solved in current step
+static PhysicsBodiesPair sleepingPairs[PHYSAC_MAX_MANIFOLDS];   // Sleeping bodies pairs with deferred narrow phase
+static unsigned int sleepingPairsCount = 0;                 // Sleeping bodies pairs counter
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
@@ -312,9 +378,18 @@ static PolygonData CreateRandomPolygon(float radius, int sides);
 static PolygonData CreateRectanglePolygon(Vector2 pos, Vector2 size);                                       // Creates a rectangle polygon shape based on a min and max positions
 static void *PhysicsLoop(void *arg);                                                                        // Physics loop thread function
 static void PhysicsStep(void);                                                                              // Physics steps calculations (dynamics, collisions and position corrections)
+static PhysicsBounds GetPhysicsBodyBounds(PhysicsBody body);                                                // Calculates physics body shape axis-aligned bounding box
+static void UpdatePhysicsBroadPhase(void);                                                                  // Updates physics bodies bounds and sorts them along x axis
+static void GeneratePhysicsContacts(void);                                                                  // Generates collision manifolds for overlapping physics bodies
+static bool GeneratePhysicsManifold(PhysicsBody a, PhysicsBody b);                                          // Solves collision between two physics bodies, stores a manifold if colliding
+static void WakeUpPhysicsBody(PhysicsBody body);                                                            // Wakes up a sleeping physics body
+static unsigned int FindPhysicsIsland(unsigned int id);                                                     // Finds physics body island root body id
+static void MergePhysicsIslands(PhysicsBody a, PhysicsBody b);                                              // Merges two physics bodies islands
+static void UpdatePhysicsIslands(void);                                                                     // Builds contact islands and wakes up islands with awake bodies
+static void SolvePhysicsIsland(PhysicsIsland *island);                                                      // Solves island collisions and integrates its bodies
+static void SolvePhysicsIslands(void);                                                                      // Solves all awake islands
 static int FindAvailableManifoldIndex();                                                                    // Finds a valid index for a new manifold initialization
 static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b);                                 // Creates a new physics manifold to solve collision
-static void DestroyPhysicsManifold(PhysicsManifold manifold);                                               // Unitializes and destroys a physics manifold
 static void SolvePhysicsManifold(PhysicsManifold manifold);                                                 // Solves a created physics manifold between two physics bodies
 static void SolveCircleToCircle(PhysicsManifold manifold);                                                  // Solves collision between two circle shape physics bodies
 static void SolveCircleToPolygon(PhysicsManifold manifold);                                                 // Solves collision between a circle to a polygon shape physics bodies
@@ -397,13 +472,13 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float d
 // Creates a new rectangle physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
+    PhysicsBody newBody = NULL;
 
     int newId = FindAvailableBodyIndex();
     if (newId != -1)
     {
         // Initialize new body with generic values
+        newBody = &bodiesPool[newId];
         newBody->id = newId;
         newBody->enabled = true;
         newBody->position = pos;
@@ -465,6 +540,10 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
         newBody->useGravity = true;
         newBody->isGrounded = false;
         newBody->freezeOrient = false;
+        newBody->isSleeping = false;
+        bodiesSleepTime[newId] = 0.0f;
+        restPositions[newId] = pos;
+        restOrients[newId] = 0.0f;
 
         // Add new body to bodies pointers array and update bodies count
         bodies[physicsBodiesCount] = newBody;
@@ -484,13 +563,13 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
 // Creates a new polygon physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
+    PhysicsBody newBody = NULL;
 
     int newId = FindAvailableBodyIndex();
     if (newId != -1)
     {
         // Initialize new body with generic values
+        newBody = &bodiesPool[newId];
         newBody->id = newId;
         newBody->enabled = true;
         newBody->position = pos;
@@ -551,6 +630,10 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
         newBody->useGravity = true;
         newBody->isGrounded = false;
         newBody->freezeOrient = false;
+        newBody->isSleeping = false;
+        bodiesSleepTime[newId] = 0.0f;
+        restPositions[newId] = pos;
+        restOrients[newId] = 0.0f;
 
         // Add new body to bodies pointers array and update bodies count
         bodies[physicsBodiesCount] = newBody;
@@ -616,7 +699,7 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
             {
                 int count = vertexData.vertexCount;
                 Vector2 bodyPos = body->position;
-                Vector2 *vertices = (Vector2 *)PHYSAC_MALLOC(sizeof(Vector2)*count);
+                Vector2 vertices[PHYSAC_MAX_VERTICES] = { 0 };
                 Matrix2x2 trans = body->shape.transform;
                 for (int i = 0; i < count; i++) vertices[i] = vertexData.positions[i];
 
@@ -631,6 +714,7 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
                     Vector2 offset = Vector2Subtract(center, bodyPos);
 
                     PhysicsBody newBody = CreatePhysicsBodyPolygon(center, 10, 3, 10);     // Create polygon physics body with relevant values
+                    if (newBody == NULL) break;     // Physics bodies pool is full
 
                     PolygonData newData = { 0 };
                     newData.vertexCount = 3;
@@ -708,8 +792,6 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
                     // Apply force to new physics body
                     PhysicsAddForce(newBody, forceDirection);
                 }
-
-                PHYSAC_FREE(vertices);
             }
         }
     }
@@ -862,9 +944,24 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
             return;     // Prevent access to index -1
         }
 
-        // Free body allocated memory
-        PHYSAC_FREE(body);
-        usedMemory -= sizeof(PhysicsBodyData);
+        // Wake up sleeping bodies touching destroyed body (they could be resting on it)
+        PhysicsBounds bounds = GetPhysicsBodyBounds(body);
+        for (int i = 0; i < physicsBodiesCount; i++)
+        {
+            PhysicsBody other = bodies[i];
+
+            if (other->isSleeping)
+            {
+                PhysicsBounds otherBounds = GetPhysicsBodyBounds(other);
+
+                if ((otherBounds.min.x <= bounds.max.x) && (otherBounds.max.x >= bounds.min.x) &&
+                    (otherBounds.min.y <= bounds.max.y) && (otherBounds.max.y >= bounds.min.y)) WakeUpPhysicsBody(other);
+            }
+        }
+
+        // Release body pool slot
+        bodiesFreeIds[bodiesFreeCount] = id;
+        bodiesFreeCount++;
         bodies[index] = NULL;
 
         // Reorder physics bodies pointers array and its catched index
@@ -888,34 +985,14 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
 // Destroys created physics bodies and manifolds and resets global values
 PHYSACDEF void ResetPhysics(void)
 {
-    // Unitialize physics bodies dynamic memory allocations
-    for (int i = physicsBodiesCount - 1; i >= 0; i--)
-    {
-        PhysicsBody body = bodies[i];
-
-        if (body != NULL)
-        {
-            PHYSAC_FREE(body);
-            bodies[i] = NULL;
-            usedMemory -= sizeof(PhysicsBodyData);
-        }
-    }
+    // Release all physics bodies pool slots
+    for (int i = 0; i < physicsBodiesCount; i++) bodies[i] = NULL;
 
     physicsBodiesCount = 0;
+    bodiesFreeCount = 0;
+    bodiesPoolCount = 0;
 
-    // Unitialize physics manifolds dynamic memory allocations
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
-    {
-        PhysicsManifold manifold = contacts[i];
-
-        if (manifold != NULL)
-        {
-            PHYSAC_FREE(manifold);
-            contacts[i] = NULL;
-            usedMemory -= sizeof(PhysicsManifoldData);
-        }
-    }
-
+    // Reset physics manifolds arena
     physicsManifoldsCount = 0;
 
     #if defined(PHYSAC_DEBUG)
@@ -933,16 +1010,12 @@ PHYSACDEF void ClosePhysics(void)
         pthread_join(physicsThreadId, NULL);
     #endif
 
-    // Unitialize physics manifolds dynamic memory allocations
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--) DestroyPhysicsManifold(contacts[i]);
-
-    // Unitialize physics bodies dynamic memory allocations
-    for (int i = physicsBodiesCount - 1; i >= 0; i--) DestroyPhysicsBody(bodies[i]);
+    // Release physics manifolds and bodies pools
+    // NOTE: Physics data is stored in static pools, no dynamic memory to free
+    ResetPhysics();
 
     #if defined(PHYSAC_DEBUG)
-        if (physicsBodiesCount > 0 || usedMemory != 0) TRACELOG("[PHYSAC] physics module closed with %i still allocated bodies [MEMORY: %i bytes]\n", physicsBodiesCount, usedMemory);
-        else if (physicsManifoldsCount > 0 || usedMemory != 0) TRACELOG("[PHYSAC] physics module closed with %i still allocated manifolds [MEMORY: %i bytes]\n", physicsManifoldsCount, usedMemory);
-        else TRACELOG("[PHYSAC] physics module closed successfully\n");
+        TRACELOG("[PHYSAC] physics module closed successfully\n");
     #endif
 }
 
@@ -952,27 +1025,19 @@ PHYSACDEF void ClosePhysics(void)
 // Finds a valid index for a new physics body initialization
 static int FindAvailableBodyIndex()
 {
+    // NOTE: Released slots are reused first (last released, first reused),
+    // then never used slots of the pool are taken in order
     int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_BODIES; i++)
-    {
-        int currentId = i;
-
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsBodiesCount; k++)
-        {
-            if (bodies[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
 
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
+    if (bodiesFreeCount > 0)
+    {
+        bodiesFreeCount--;
+        index = bodiesFreeIds[bodiesFreeCount];
+    }
+    else if (bodiesPoolCount < PHYSAC_MAX_BODIES)
+    {
+        index = bodiesPoolCount;
+        bodiesPoolCount++;
     }
 
     return index;
@@ -1056,106 +1121,389 @@ static void PhysicsStep(void)
     // Update current steps count
     stepsCount++;
 
-    // Clear previous generated collisions information
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
+    // Clear previous generated collisions information (manifolds arena reset)
+    physicsManifoldsCount = 0;
+
+    // Wake up sleeping bodies changed by user since previous step (forces, velocities or transform)
+    for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) DestroyPhysicsManifold(manifold);
+        PhysicsBody body = bodies[i];
+
+        if (body->isSleeping &&
+            ((body->force.x != 0.0f) || (body->force.y != 0.0f) || (body->torque != 0.0f) ||
+             (body->velocity.x != 0.0f) || (body->velocity.y != 0.0f) || (body->angularVelocity != 0.0f) ||
+             (body->position.x != restPositions[body->id].x) || (body->position.y != restPositions[body->id].y) ||
+             (body->orient != restOrients[body->id]))) WakeUpPhysicsBody(body);
     }
 
-    // Reset physics bodies grounded state
+    // Reset physics bodies grounded state (sleeping bodies keep previous state)
     for (int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        body->isGrounded = false;
+        if (!body->isSleeping) body->isGrounded = false;
     }
 
-    // Generate new collision information
+    // Generate new collision information (broad phase and narrow phase)
+    UpdatePhysicsBroadPhase();
+    GeneratePhysicsContacts();
+
+    // Group bodies in contact islands and solve awake islands
+    // NOTE: Islands do not share dynamic bodies, every island is solved independently
+    UpdatePhysicsIslands();
+    SolvePhysicsIslands();
+
+    // Clear physics bodies forces
     for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsBody bodyA = bodies[i];
+        PhysicsBody body = bodies[i];
+        if (body != NULL)
+        {
+            body->force = PHYSAC_VECTOR_ZERO;
+            body->torque = 0.0f;
+        }
+    }
+}
 
-        if (bodyA != NULL)
+// Calculates physics body shape axis-aligned bounding box
+static PhysicsBounds GetPhysicsBodyBounds(PhysicsBody body)
+{
+    PhysicsBounds bounds = { body->position, body->position };
+
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        bounds.min.x -= body->shape.radius;
+        bounds.min.y -= body->shape.radius;
+        bounds.max.x += body->shape.radius;
+        bounds.max.y += body->shape.radius;
+    }
+    else
+    {
+        PolygonData vertexData = body->shape.vertexData;
+
+        for (int i = 0; i < vertexData.vertexCount; i++)
         {
-            for (int j = i + 1; j < physicsBodiesCount; j++)
+            Vector2 vertex = Vector2Add(body->position, Mat2MultiplyVector2(body->shape.transform, vertexData.positions[i]));
+
+            if (i == 0) bounds = (PhysicsBounds){ vertex, vertex };
+            else
             {
-                PhysicsBody bodyB = bodies[j];
+                bounds.min.x = min(bounds.min.x, vertex.x);
+                bounds.min.y = min(bounds.min.y, vertex.y);
+                bounds.max.x = max(bounds.max.x, vertex.x);
+                bounds.max.y = max(bounds.max.y, vertex.y);
+            }
+        }
+    }
 
-                if (bodyB != NULL)
-                {
-                    if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0)) continue;
+    return bounds;
+}
 
-                    PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
-                    SolvePhysicsManifold(manifold);
+// Updates physics bodies bounds and sorts them along x axis
+// NOTE: Bodies move little between steps, so previous step order is almost sorted and insertion sort is close to O(n)
+static void UpdatePhysicsBroadPhase(void)
+{
+    for (int i = 0; i < physicsBodiesCount; i++) bodiesBounds[i] = GetPhysicsBodyBounds(bodies[i]);
 
-                    if (manifold->contactsCount > 0)
-                    {
-                        // Create a new manifold with same information as previously solved manifold and add it to the manifolds pool last slot
-                        PhysicsManifold newManifold = CreatePhysicsManifold(bodyA, bodyB);
-                        newManifold->penetration = manifold->penetration;
-                        newManifold->normal = manifold->normal;
-                        newManifold->contacts[0] = manifold->contacts[0];
-                        newManifold->contacts[1] = manifold->contacts[1];
-                        newManifold->contactsCount = manifold->contactsCount;
-                        newManifold->restitution = manifold->restitution;
-                        newManifold->dynamicFriction = manifold->dynamicFriction;
-                        newManifold->staticFriction = manifold->staticFriction;
-                    }
+    // Bodies created or destroyed, indices are no longer valid
+    if (broadPhaseCount != physicsBodiesCount)
+    {
+        for (int i = 0; i < physicsBodiesCount; i++) broadPhaseOrder[i] = i;
+        broadPhaseCount = physicsBodiesCount;
+    }
+
+    for (int i = 1; i < broadPhaseCount; i++)
+    {
+        unsigned int index = broadPhaseOrder[i];
+        float minX = bodiesBounds[index].min.x;
+        int j = i - 1;
+
+        while ((j >= 0) && (bodiesBounds[broadPhaseOrder[j]].min.x > minX))
+        {
+            broadPhaseOrder[j + 1] = broadPhaseOrder[j];
+            j--;
+        }
+
+        broadPhaseOrder[j + 1] = index;
+    }
+}
+
+// Generates collision manifolds for overlapping physics bodies
+// NOTE: Sweep and prune, only pairs overlapping on both axis are solved by narrow phase,
+// pairs of sleeping (or static) bodies are deferred until islands are updated
+static void GeneratePhysicsContacts(void)
+{
+    // Reset contact islands, every body starts in its own island
+    for (int i = 0; i < physicsBodiesCount; i++) islandParents[bodies[i]->id] = bodies[i]->id;
+
+    sleepingPairsCount = 0;
+
+    for (int i = 0; i < broadPhaseCount; i++)
+    {
+        unsigned int indexA = broadPhaseOrder[i];
+        PhysicsBounds boundsA = bodiesBounds[indexA];
+
+        for (int j = i + 1; j < broadPhaseCount; j++)
+        {
+            unsigned int indexB = broadPhaseOrder[j];
+            PhysicsBounds boundsB = bodiesBounds[indexB];
+
+            // Next bodies start even further on x axis, no more overlaps possible
+            if (boundsB.min.x > boundsA.max.x) break;
+
+            if ((boundsB.min.y > boundsA.max.y) || (boundsB.max.y < boundsA.min.y)) continue;
+
+            // Keep bodies creation order in manifold (collision normal goes from 'a' to 'b')
+            PhysicsBody bodyA = bodies[min(indexA, indexB)];
+            PhysicsBody bodyB = bodies[max(indexA, indexB)];
+
+            if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0)) continue;
+
+            bool activeA = (bodyA->enabled && !bodyA->isSleeping);
+            bool activeB = (bodyB->enabled && !bodyB->isSleeping);
+
+            if (!activeA && !activeB)
+            {
+                // Sleeping bodies resting on each other stay in the same island, so they are woken up together
+                if (bodyA->enabled && bodyB->enabled) MergePhysicsIslands(bodyA, bodyB);
+
+                if (sleepingPairsCount < PHYSAC_MAX_MANIFOLDS)
+                {
+                    sleepingPairs[sleepingPairsCount] = (PhysicsBodiesPair){ bodyA, bodyB };
+                    sleepingPairsCount++;
                 }
             }
+            else if (GeneratePhysicsManifold(bodyA, bodyB) && bodyA->enabled && bodyB->enabled) MergePhysicsIslands(bodyA, bodyB);
         }
     }
+}
 
-    // Integrate forces to physics bodies
+// Solves collision between two physics bodies, stores a manifold if colliding
+static bool GeneratePhysicsManifold(PhysicsBody a, PhysicsBody b)
+{
+    bool colliding = false;
+
+    // Solve collision in a temporal manifold, just stored if bodies are colliding
+    PhysicsManifoldData manifold = { 0 };
+    manifold.bodyA = a;
+    manifold.bodyB = b;
+
+    SolvePhysicsManifold(&manifold);
+
+    if (manifold.contactsCount > 0)
+    {
+        PhysicsManifold newManifold = CreatePhysicsManifold(a, b);
+
+        if (newManifold != NULL)
+        {
+            manifold.id = newManifold->id;
+            *newManifold = manifold;
+        }
+
+        colliding = true;
+    }
+
+    return colliding;
+}
+
+// Wakes up a sleeping physics body
+static void WakeUpPhysicsBody(PhysicsBody body)
+{
+    body->isSleeping = false;
+    bodiesSleepTime[body->id] = 0.0f;
+    restPositions[body->id] = body->position;
+    restOrients[body->id] = body->orient;
+}
+
+// Finds physics body island root body id
+static unsigned int FindPhysicsIsland(unsigned int id)
+{
+    while (islandParents[id] != id)
+    {
+        islandParents[id] = islandParents[islandParents[id]];   // Path halving
+        id = islandParents[id];
+    }
+
+    return id;
+}
+
+// Merges two physics bodies islands
+static void MergePhysicsIslands(PhysicsBody a, PhysicsBody b)
+{
+    unsigned int rootA = FindPhysicsIsland(a->id);
+    unsigned int rootB = FindPhysicsIsland(b->id);
+
+    if (rootA != rootB) islandParents[max(rootA, rootB)] = min(rootA, rootB);
+}
+
+// Builds contact islands and wakes up islands with awake bodies
+// NOTE: Static bodies (not enabled) do not belong to any island, they are never modified by solver
+static void UpdatePhysicsIslands(void)
+{
+    physicsIslandsCount = 0;
+
+    // Create an island for every island root body
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+
+        if (body->enabled && (FindPhysicsIsland(body->id) == body->id))
+        {
+            islands[physicsIslandsCount] = (PhysicsIsland){ 0 };
+            bodiesIsland[body->id] = physicsIslandsCount;
+            physicsIslandsCount++;
+        }
+    }
+
+    // Assign bodies to its root island
     for (int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsForces(body);
+
+        if (body->enabled)
+        {
+            unsigned int island = bodiesIsland[FindPhysicsIsland(body->id)];
+            bodiesIsland[body->id] = island;
+            islands[island].bodiesCount++;
+            if (!body->isSleeping) islands[island].awake = true;
+        }
+        else bodiesIsland[body->id] = PHYSAC_NO_ISLAND;
     }
 
-    // Initialize physics manifolds to solve collisions
+    // Wake up sleeping bodies touched by awake bodies (whole island)
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        if (body->isSleeping && (bodiesIsland[body->id] != PHYSAC_NO_ISLAND) && islands[bodiesIsland[body->id]].awake) WakeUpPhysicsBody(body);
+    }
+
+    // Solve deferred narrow phase of woken up bodies
+    for (int i = 0; i < sleepingPairsCount; i++)
+    {
+        PhysicsBody bodyA = sleepingPairs[i].bodyA;
+        PhysicsBody bodyB = sleepingPairs[i].bodyB;
+
+        if ((bodyA->enabled && !bodyA->isSleeping) || (bodyB->enabled && !bodyB->isSleeping)) GeneratePhysicsManifold(bodyA, bodyB);
+    }
+
+    // Count islands manifolds, a manifold belongs to the island of its dynamic bodies
     for (int i = 0; i < physicsManifoldsCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) InitializePhysicsManifolds(manifold);
+        PhysicsBody body = (contacts[i].bodyA->enabled)? contacts[i].bodyA : contacts[i].bodyB;
+        islands[bodiesIsland[body->id]].contactsCount++;
     }
 
-    // Integrate physics collisions impulses to solve collisions
-    for (int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
+    // Sort bodies and manifolds by island (keeping creation order inside every island)
+    unsigned int bodiesOffset = 0;
+    unsigned int contactsOffset = 0;
+    awakeIslandsCount = 0;
+
+    for (int i = 0; i < physicsIslandsCount; i++)
     {
-        for (int j = 0; j < physicsManifoldsCount; j++)
+        islands[i].bodiesStart = bodiesOffset;
+        islands[i].contactsStart = contactsOffset;
+        bodiesOffset += islands[i].bodiesCount;
+        contactsOffset += islands[i].contactsCount;
+        islands[i].bodiesCount = 0;
+        islands[i].contactsCount = 0;
+
+        if (islands[i].awake)
         {
-            PhysicsManifold manifold = contacts[i];
-            if (manifold != NULL) IntegratePhysicsImpulses(manifold);
+            awakeIslands[awakeIslandsCount] = i;
+            awakeIslandsCount++;
         }
     }
 
-    // Integrate velocity to physics bodies
     for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsVelocity(body);
+        unsigned int island = bodiesIsland[bodies[i]->id];
+
+        if (island != PHYSAC_NO_ISLAND)
+        {
+            islandBodies[islands[island].bodiesStart + islands[island].bodiesCount] = i;
+            islands[island].bodiesCount++;
+        }
     }
 
-    // Correct physics bodies positions based on manifolds collision information
     for (int i = 0; i < physicsManifoldsCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) CorrectPhysicsPositions(manifold);
+        PhysicsBody body = (contacts[i].bodyA->enabled)? contacts[i].bodyA : contacts[i].bodyB;
+        unsigned int island = bodiesIsland[body->id];
+
+        islandContacts[islands[island].contactsStart + islands[island].contactsCount] = i;
+        islands[island].contactsCount++;
     }
+}
 
-    // Clear physics bodies forces
-    for (int i = 0; i < physicsBodiesCount; i++)
+// Solves island collisions and integrates its bodies
+// NOTE: Same phases than a whole physics step, just for island bodies and manifolds
+static void SolvePhysicsIsland(PhysicsIsland *island)
+{
+    unsigned int *bodiesIndices = &islandBodies[island->bodiesStart];
+    unsigned int *contactsIndices = &islandContacts[island->contactsStart];
+
+    // Integrate forces to physics bodies
+    for (int i = 0; i < island->bodiesCount; i++) IntegratePhysicsForces(bodies[bodiesIndices[i]]);
+
+    // Initialize physics manifolds to solve collisions
+    for (int i = 0; i < island->contactsCount; i++) InitializePhysicsManifolds(&contacts[contactsIndices[i]]);
+
+    // Integrate physics collisions impulses to solve collisions
+    for (int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
     {
-        PhysicsBody body = bodies[i];
-        if (body != NULL)
+        for (int j = 0; j < island->contactsCount; j++) IntegratePhysicsImpulses(&contacts[contactsIndices[j]]);
+    }
+
+    // Integrate velocity to physics bodies
+    for (int i = 0; i < island->bodiesCount; i++) IntegratePhysicsVelocity(bodies[bodiesIndices[i]]);
+
+    // Correct physics bodies positions based on manifolds collision information
+    for (int i = 0; i < island->contactsCount; i++) CorrectPhysicsPositions(&contacts[contactsIndices[i]]);
+
+    // Put island to sleep when all its bodies have been resting long enough
+    if (PHYSAC_TIME_TO_SLEEP > 0.0f)
+    {
+        // NOTE: Resting is checked by displacement instead of velocities, collision impulses
+        // make stacked bodies jitter around their resting position
+        float minSleepTime = PHYSAC_FLT_MAX;
+
+        for (int i = 0; i < island->bodiesCount; i++)
         {
-            body->force = PHYSAC_VECTOR_ZERO;
-            body->torque = 0.0f;
+            PhysicsBody body = bodies[bodiesIndices[i]];
+
+            if ((DistSqr(body->position, restPositions[body->id]) > PHYSAC_SLEEP_LINEAR_TOLERANCE*PHYSAC_SLEEP_LINEAR_TOLERANCE) ||
+                (fabs(body->orient - restOrients[body->id]) > PHYSAC_SLEEP_ANGULAR_TOLERANCE))
+            {
+                restPositions[body->id] = body->position;
+                restOrients[body->id] = body->orient;
+                bodiesSleepTime[body->id] = 0.0f;
+            }
+            else bodiesSleepTime[body->id] += deltaTime;
+
+            minSleepTime = min(minSleepTime, bodiesSleepTime[body->id]);
+        }
+
+        if (minSleepTime >= PHYSAC_TIME_TO_SLEEP)
+        {
+            for (int i = 0; i < island->bodiesCount; i++)
+            {
+                PhysicsBody body = bodies[bodiesIndices[i]];
+
+                body->isSleeping = true;
+                body->velocity = PHYSAC_VECTOR_ZERO;
+                body->angularVelocity = 0.0f;
+                restPositions[body->id] = body->position;       // Used to detect user changes while sleeping
+                restOrients[body->id] = body->orient;
+            }
         }
     }
 }
 
+// Solves all awake islands
+static void SolvePhysicsIslands(void)
+{
+    for (int i = 0; i < awakeIslandsCount; i++) SolvePhysicsIsland(&islands[awakeIslands[i]]);
+}
+
 // Wrapper to ensure PhysicsStep is run with at a fixed time step
 PHYSACDEF void RunPhysicsStep(void)
 {
@@ -1191,28 +1539,10 @@ PHYSACDEF void SetPhysicsTimeStep(double delta)
 // Finds a valid index for a new manifold initialization
 static int FindAvailableManifoldIndex()
 {
+    // NOTE: Manifolds are only created by PhysicsStep() after clearing all previous manifolds,
+    // so manifolds ids are always sequential and next available id is current manifolds count
     int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_MANIFOLDS; i++)
-    {
-        int currentId = i;
-
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsManifoldsCount; k++)
-        {
-            if (contacts[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
-
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
-    }
+    if (physicsManifoldsCount < PHYSAC_MAX_MANIFOLDS) index = physicsManifoldsCount;
 
     return index;
 }
@@ -1220,13 +1550,13 @@ static int FindAvailableManifoldIndex()
 // Creates a new physics manifold to solve collision
 static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
 {
-    PhysicsManifold newManifold = (PhysicsManifold)PHYSAC_MALLOC(sizeof(PhysicsManifoldData));
-    usedMemory += sizeof(PhysicsManifoldData);
+    PhysicsManifold newManifold = NULL;
 
     int newId = FindAvailableManifoldIndex();
     if (newId != -1)
     {
         // Initialize new manifold with generic values
+        newManifold = &contacts[newId];
         newManifold->id = newId;
         newManifold->bodyA = a;
         newManifold->bodyB = b;
@@ -1239,8 +1569,7 @@ static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
         newManifold->dynamicFriction = 0.0f;
         newManifold->staticFriction = 0.0f;
 
-        // Add new body to bodies pointers array and update bodies count
-        contacts[physicsManifoldsCount] = newManifold;
+        // Update manifolds count (manifold is already stored in manifolds arena)
         physicsManifoldsCount++;
     }
     #if defined(PHYSAC_DEBUG)
@@ -1250,50 +1579,6 @@ static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
     return newManifold;
 }
 
-// Unitializes and destroys a physics manifold
-static void DestroyPhysicsManifold(PhysicsManifold manifold)
-{
-    if (manifold != NULL)
-    {
-        int id = manifold->id;
-        int index = -1;
-
-        for (int i = 0; i < physicsManifoldsCount; i++)
-        {
-            if (contacts[i]->id == id)
-            {
-                index = i;
-                break;
-            }
-        }
-
-        if (index == -1)
-        {
-        #if defined(PHYSAC_DEBUG)
-            TRACELOG("[PHYSAC] Not possible to manifold id %i in pointers array\n", id);
-        #endif
-            return;     // Prevent access to index -1
-        }
-
-        // Free manifold allocated memory
-        PHYSAC_FREE(manifold);
-        usedMemory -= sizeof(PhysicsManifoldData);
-        contacts[index] = NULL;
-
-        // Reorder physics manifolds pointers array and its catched index
-        for (int i = index; i < physicsManifoldsCount; i++)
-        {
-            if ((i + 1) < physicsManifoldsCount) contacts[i] = contacts[i + 1];
-        }
-
-        // Update physics manifolds count
-        physicsManifoldsCount--;
-    }
-    #if defined(PHYSAC_DEBUG)
-        else TRACELOG("[PHYSAC] error trying to destroy a null referenced manifold\n");
-    #endif
-}
-
 // Solves a created physics manifold between two physics bodies
 static void SolvePhysicsManifold(PhysicsManifold manifold)
 {
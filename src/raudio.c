@@ -25,6 +25,18 @@
 *       Selected desired fileformats to be supported for loading. Some of those formats are
 *       supported by default, to remove support, just comment unrequired #define in this module
 *
+*   #define MAX_AUDIO_BUFFER_POOL_CHANNELS
+*       Number of sound instances that can be played at the same time with PlaySoundMulti(),
+*       only SetAudioVoicesBudget() voices are mixed, lower priority ones become virtual voices
+*
+*   #define MAX_AUDIO_VOICES
+*       Maximum number of voices mixed at the same time (SetAudioVoicesBudget() limit),
+*       number of audio buffers playing is not limited, voices over budget are virtual
+*
+*   #define MAX_SOUND_CACHE_SIZE
+*       Decoded data size (in bytes) kept in memory for sounds loaded with SOUND_STORAGE_COMPRESSED,
+*       least recently played sounds not playing are released when cache is full
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/dr-soft/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -162,6 +174,7 @@ typedef struct tagBITMAPINFOHEADER {
 
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
+#include <math.h>                       // Required for: sinf(), cosf(), expf(), powf(), fabsf(), sqrtf(), fmaxf() [Used in bus effects and 3d audio]
 
 #if defined(RAUDIO_STANDALONE)
     #include <string.h>                 // Required for: strcmp() [Used in IsFileExtension()]
@@ -201,6 +214,18 @@ typedef struct tagBITMAPINFOHEADER {
     #undef bool
 #endif
 
+// SIMD instruction sets used for audio mixing (if available)
+#if defined(__AVX__)
+    #include <immintrin.h>              // AVX intrinsics: _mm256_loadu_ps(), _mm256_mul_ps(), _mm256_add_ps()...
+    #define MIXING_SIMD_AVX
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>              // SSE intrinsics: _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps()...
+    #define MIXING_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>               // NEON intrinsics: vld1q_f32(), vmlaq_n_f32()...
+    #define MIXING_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -208,7 +233,55 @@ typedef struct tagBITMAPINFOHEADER {
 #define AUDIO_DEVICE_CHANNELS       2
 #define AUDIO_DEVICE_SAMPLE_RATE    44100
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS 16
+#ifndef PI
+    #define PI 3.14159265358979323846f
+#endif
+
+#if !defined(MAX_AUDIO_BUFFER_POOL_CHANNELS)
+    #define MAX_AUDIO_BUFFER_POOL_CHANNELS 32   // Multichannel pool voices (PlaySoundMulti), mixed or virtual
+#endif
+
+#if !defined(MAX_AUDIO_VOICES)
+    #define MAX_AUDIO_VOICES        64      // Maximum number of voices mixed at the same time (budget limit), playing buffers are not limited
+#endif
+#define DEFAULT_AUDIO_VOICES_BUDGET ((MAX_AUDIO_VOICES < 32)? MAX_AUDIO_VOICES : 32)    // Default maximum number of voices mixed, remaining voices are virtual
+#define MAX_AUDIO_CHANNEL_RELEASES  64      // Size of the mixer -> game thread released pool channels queue (power of 2)
+#define AUDIO_VOICE_INAUDIBLE_VOLUME 0.001f // Voices with lower volume are never mixed (virtual)
+#define MAX_AUDIO_COMMANDS          256     // Size of the game thread -> mixer commands queue (power of 2)
+#define MAX_AUDIO_RESAMPLE_GROUPS   8       // Maximum number of voices groups sharing a resampler (same pitch)
+#define MAX_AUDIO_BUSES             3       // Mixer buses: AUDIO_BUS_SFX, AUDIO_BUS_MUSIC, AUDIO_BUS_VOICE
+#define MAX_AUDIO_BUS_EFFECTS       4       // Maximum number of effects on a bus processing chain
+
+#define AUDIO_MIXER_CHUNK_FRAMES    1024    // Frames processed per chunk when mixing voices
+#define AUDIO_OFFLINE_PERIOD_FRAMES 512     // Frames mixed per mixer period when rendering offline
+
+#define AUDIO_REVERB_COMBS          4       // Reverb comb filters per channel
+#define AUDIO_REVERB_ALLPASSES      2       // Reverb allpass filters per channel
+#define AUDIO_REVERB_MAX_DELAY      1400    // Reverb delay lines maximum length (frames)
+#define AUDIO_REVERB_STEREO_SPREAD  23      // Reverb delay lines length difference between channels (frames)
+#define AUDIO_DUCKING_THRESHOLD     0.01f   // Sidechain bus level considered as playing when ducking (-40 dB)
+
+#if !defined(MAX_AUDIO_SPATIAL_EMITTERS)
+    #define MAX_AUDIO_SPATIAL_EMITTERS 256  // Maximum number of playing 3d audio emitters updated per listener update (loudest ones)
+#endif
+#define AUDIO_SPEED_OF_SOUND        343.0f  // Speed of sound for doppler effect (world units per second, meters)
+#define AUDIO_DOPPLER_MAX_SHIFT     2.0f    // Doppler pitch factor limit, from 1/shift to shift
+
+#if !defined(MAX_SOUND_CACHE_SIZE)
+    #define MAX_SOUND_CACHE_SIZE    4194304     // Compressed sounds decoded data kept in memory (4 MB)
+#endif
+
+#define MUSIC_DECODER_SLEEP_MS      10      // Music decoder thread sleep time between updates (milliseconds)
+#define MUSIC_SEEK_SKIP_FRAMES    1024      // Frames generated per step when seeking modules (XM, MOD) forward
+
+// Game thread <-> mixer synchronization, acquire/release ordered accesses
+#if defined(__GNUC__) || defined(__clang__)
+    #define AUDIO_LOAD_ACQUIRE(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+    #define AUDIO_STORE_RELEASE(x, v)   __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+    #define AUDIO_LOAD_ACQUIRE(x)       (x)     // NOTE: Requires volatile variables with acquire/release semantics (MSVC /volatile:ms)
+    #define AUDIO_STORE_RELEASE(x, v)   (ma_memory_barrier(), (x) = (v))
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -246,49 +319,279 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio mixer commands, requested by game thread and applied by mixer at callback start
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,
+    AUDIO_COMMAND_STOP,
+    AUDIO_COMMAND_PAUSE,
+    AUDIO_COMMAND_RESUME,
+    AUDIO_COMMAND_VOLUME,
+    AUDIO_COMMAND_PITCH,
+    AUDIO_COMMAND_PRIORITY,
+    AUDIO_COMMAND_UNLOAD,
+    AUDIO_COMMAND_BUS,
+    AUDIO_COMMAND_BUS_VOLUME,
+    AUDIO_COMMAND_BUS_EFFECT,
+    AUDIO_COMMAND_BUS_CLEAR,
+    AUDIO_COMMAND_SPATIAL,
+    AUDIO_COMMAND_SPATIAL_BATCH
+} AudioCommandType;
+
+typedef struct MusicDecoder MusicDecoder;
+typedef struct CompressedSound CompressedSound;
+
+// Audio mixer voice (audio buffer being mixed), stored in its audio buffer
+// NOTE: Playing voices are linked in mixer voices list, only modified by mixer between mixes
+typedef struct AudioVoice {
+    rAudioBuffer *buffer;           // Audio buffer mixed
+    unsigned int sequence;          // Play request sequence being played
+    float volume;                   // Voice volume
+    int priority;                   // Voice priority, higher priority voices are mixed first
+    float level;                    // Voice level on current mix (volume and 3d audio attenuation)
+    int group;                      // Resample group on current mix, -1 if mixed with its own converter
+    bool isActive;                  // Voice is linked in mixer voices list (playing or paused)
+    bool paused;                    // Voice paused state
+    bool ended;                     // Voice reached the end of a non-looping buffer
+    bool isVirtual;                 // Voice is not mixed on current mix, only its cursor is advanced
+    struct AudioVoice *next;        // Next voice on mixer voices list
+    struct AudioVoice *prev;        // Previous voice on mixer voices list
+} AudioVoice;
+
 // Audio buffer structure
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
+    int priority;                   // Audio buffer priority, higher priority voices are mixed first
+    int bus;                        // Mixer bus the buffer is mixed into (audio thread)
 
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, always true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    volatile bool isSubBufferProcessed[2];  // SubBuffer processed (virtual double buffer)
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int totalFramesProcessed;  // Total frames processed in this buffer (required for play timing)
+    volatile unsigned int totalFramesProcessed; // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    unsigned int playSequence;      // Play requests counter (game thread)
+    volatile unsigned int endSequence;  // Last play request finished by the mixer (audio thread)
+    unsigned int unloadSequence;    // Commands queue position of the unload request (game thread)
+    unsigned int stopSequence;      // Commands queue position of last stop request (game thread)
+    AudioVoice voice;               // Mixer voice, linked in mixer voices list while playing (audio thread)
+    ma_uint32 sampleRateOut;        // Converter output sample rate, changed by pitch (audio thread)
+    int poolIndex;                  // Multichannel pool channel, -1 if not a pool buffer
+    MusicDecoder *decoder;          // Music decoder feeding this stream, NULL if fed by game thread
+    volatile bool isStreamFinished; // Stream has no more data, voice ends once all sub-buffers are processed
+    CompressedSound *compressed;    // Compressed sound file data, decoded into data on play, NULL if not compressed
+
+    float spatialGains[2];          // 3d audio left and right channels gain, 1.0f if not spatialized (audio thread)
+    float doppler;                  // 3d audio doppler pitch factor, 1.0f if not spatialized (audio thread)
+    ma_uint32 pitchSampleRate;      // Converter output sample rate set by pitch, before doppler (audio thread)
+    rAudioBuffer *source;           // Sound played by multichannel pool buffer, its 3d audio is followed (audio thread)
+    bool isSpatial;                 // 3d audio emitter, spatialized on listener updates (game thread)
+    Vector3 position;               // 3d audio emitter position (game thread)
+    Vector3 previousPosition;       // 3d audio emitter position on previous listener update (game thread)
+    Vector3 velocity;               // 3d audio emitter velocity, measured on listener updates (game thread)
+
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer
+    AudioBuffer *source;            // Source audio buffer to copy data from on play (multichannel pool)
+    float value;                    // Command value: volume, output sample rate, bus, doppler factor or spatial batch
+    int priority;                   // Target audio buffer priority at request time
+    unsigned int sequence;          // Target audio buffer play sequence at request time
+    int bus;                        // Target mixer bus (bus commands)
+    int effect;                     // Target bus effect index (bus effect commands)
+    int effectType;                 // Bus effect type: AudioEffectType
+    float values[2];                // Bus effect parameters or 3d audio channels gain
+} AudioCommand;
+
+// Audio 3d emitter parameters, computed by game thread on listener updates
+typedef struct AudioSpatialParams {
+    AudioBuffer *buffer;            // Emitter audio buffer
+    float gains[2];                 // Left and right channels gain (distance attenuation and panning)
+    float doppler;                  // Doppler pitch factor
+} AudioSpatialParams;
+
+// Audio multichannel pool channel released by mixer
+typedef struct AudioChannelRelease {
+    int channel;                    // Multichannel pool channel
+    unsigned int sequence;          // Channel buffer play sequence finished
+} AudioChannelRelease;
+
+// Audio mixer resample group, voices in device format with same sample rates and bus are mixed and resampled together
+typedef struct AudioResampleGroup {
+    ma_data_converter converter;    // Group resampler (device format and channels)
+    ma_uint32 sampleRateIn;         // Group input sample rate
+    ma_uint32 sampleRateOut;        // Group output sample rate
+    int bus;                        // Mixer bus the group voices are mixed into
+    int voicesCount;                // Number of voices in the group on current mix
+} AudioResampleGroup;
+
+// Audio reverb delay lines, comb and allpass filters for every channel
+// NOTE: Allocated by game thread when reverb is added to a bus, mixer never allocates memory
+typedef struct AudioReverb {
+    float comb[AUDIO_DEVICE_CHANNELS][AUDIO_REVERB_COMBS][AUDIO_REVERB_MAX_DELAY];         // Comb filters delay lines
+    float allpass[AUDIO_DEVICE_CHANNELS][AUDIO_REVERB_ALLPASSES][AUDIO_REVERB_MAX_DELAY];  // Allpass filters delay lines
+    float combDamping[AUDIO_DEVICE_CHANNELS][AUDIO_REVERB_COMBS];   // Comb filters feedback low-pass state
+    int combIndex[AUDIO_DEVICE_CHANNELS][AUDIO_REVERB_COMBS];       // Comb filters delay lines position
+    int allpassIndex[AUDIO_DEVICE_CHANNELS][AUDIO_REVERB_ALLPASSES];    // Allpass filters delay lines position
+} AudioReverb;
+
+// Audio bus effect, processes bus frames in place
+typedef struct AudioEffect {
+    int type;                       // Effect type: AudioEffectType
+    float coeffs[5];                // Effect coefficients, computed from parameters when set (depend on effect type)
+    float state[AUDIO_DEVICE_CHANNELS*2];   // Effect state: filter delays per channel or gain reduction envelope
+    AudioReverb *reverb;            // Reverb delay lines, NULL for other effects
+} AudioEffect;
+
+// Audio mixer bus, voices are mixed into their bus and bus effects are processed before output
+typedef struct AudioBus {
+    float frames[AUDIO_MIXER_CHUNK_FRAMES*AUDIO_DEVICE_CHANNELS];  // Bus voices mix, processed by bus effects
+    AudioEffect effects[MAX_AUDIO_BUS_EFFECTS];     // Effects processing chain, processed in order
+    int effectsCount;               // Effects processing chain count
+    float volume;                   // Bus volume, applied after effects
+    float peak;                     // Bus voices mix peak level on current chunk (ducking sidechain)
+    volatile unsigned int usage;    // Bus mixing and effects time on last mix, relative to audio mixed (parts per million)
+} AudioBus;
+
+// Music background decoder, keeps a ring of decoded buffers ahead of playback
+// NOTE: Only accessed by decoder thread and by game thread holding the decoders lock
+struct MusicDecoder {
+    Music music;                    // Music decoded (context and audio stream)
+    unsigned char *data;            // Decoded buffers ring data
+    int *samplesCount;              // Decoded buffers samples count
+    int *loopSamples;               // Decoded buffers samples of a new music loop, -1 if no loop started
+    unsigned int bufferSize;        // Decoded buffer size in samples (audio stream sub-buffer size)
+    int buffersCount;               // Decoded buffers ring size
+    volatile unsigned int writeIndex;   // Buffers decoded
+    volatile unsigned int readIndex;    // Buffers sent to audio stream
+    int samplesLeft;                // Samples left to decode on current loop
+    unsigned int loopCount;         // Loops count (times music will play), 0 means infinite loop
+    unsigned int loopsLeft;         // Loops left to decode after current one
+    bool decoded;                   // All music loops decoded
+    unsigned int resetSequence;     // Commands queue position of last stop request, stream is not fed until applied
+    MusicDecoder *next;             // Next decoder on the list
+};
+
+// Compressed sound, file data is decoded into sounds cache when played
+// NOTE: Only accessed by game thread, mixer only reads decoded data through the sound audio buffer
+struct CompressedSound {
+    AudioBuffer *buffer;            // Sound audio buffer, its data is the decoded data (NULL if not cached)
+    unsigned char *fileData;        // Compressed file data
+    unsigned int fileDataSize;      // Compressed file data size in bytes
+    int ctxType;                    // Compressed file type: MUSIC_AUDIO_OGG or MUSIC_AUDIO_FLAC
+    bool isReleasing;               // Decoded data released from cache, freed once mixer applies the release
+    unsigned int releaseSequence;   // Commands queue position of the release request
+    CompressedSound *prev;          // Previous sound on the cache list (less recently played)
+    CompressedSound *next;          // Next sound on the cache list (more recently played)
+};
+
+#if !defined(RAUDIO_STANDALONE)
+// Sound asynchronous loading data, file is read and decoded on a loader thread
+typedef struct SoundAsset {
+    int mode;                       // Sound storage mode on request (SoundStorageMode)
+    int ctxType;                    // Compressed file type (SOUND_STORAGE_COMPRESSED), -1 if loaded from wave
+    unsigned char *fileData;        // Compressed file data, owned by sound once loaded
+    int fileDataSize;               // Compressed file data size in bytes
+    Wave wave;                      // Decoded wave (converted to device format for SOUND_STORAGE_DEVICE)
+    Sound sound;                    // Loaded sound
+} SoundAsset;
+#endif
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // No playback device, mixer is driven by RenderAudioFrames()
+        ma_uint64 framesRendered;   // Frames rendered on offline rendering, used as audio time
     } System;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioBuffer *unloaded;      // Pointer to first AudioBuffer waiting to be freed
         int defaultSize;            // Default audio buffer size for audio streams
+        void *pcm;                  // Music decoding buffer, reused by UpdateMusicStream()
+        unsigned int pcmSize;       // Music decoding buffer size in bytes
     } Buffer;
+    struct {
+        AudioCommand queue[MAX_AUDIO_COMMANDS];     // Commands queue (single producer, single consumer)
+        volatile unsigned int writeIndex;           // Commands pushed, only written by game thread
+        volatile unsigned int readIndex;            // Commands applied, only written by mixer
+    } Command;
+    struct {
+        AudioVoice *voices;                         // Voices list (playing audio buffers), only modified by mixer between mixes
+        AudioResampleGroup groups[MAX_AUDIO_RESAMPLE_GROUPS];   // Resample groups, assigned on every mix
+        float groupFrames[AUDIO_MIXER_CHUNK_FRAMES*AUDIO_DEVICE_CHANNELS];  // Resample group voices mix
+        float voiceFrames[AUDIO_MIXER_CHUNK_FRAMES*AUDIO_DEVICE_CHANNELS];  // Voice frames read or resampled
+        ma_timer timer;                             // Mixer timer, used to measure callback duration
+        volatile unsigned int xruns;                // Mixer callbacks taking longer than the audio they provide
+        volatile int budget;                        // Maximum number of voices mixed, set by game thread
+        volatile int voicesMixed;                   // Voices mixed on last mix
+        volatile int voicesVirtual;                 // Voices virtual on last mix (over budget or inaudible)
+        AudioBus buses[MAX_AUDIO_BUSES];            // Mixer buses, voices are mixed into their bus
+    } Mixer;
+    struct {
+        int effectsCount[MAX_AUDIO_BUSES];                          // Bus effects requested (game thread)
+        int effectTypes[MAX_AUDIO_BUSES][MAX_AUDIO_BUS_EFFECTS];    // Bus effects types requested (game thread)
+        AudioReverb *reverbs[MAX_AUDIO_BUSES][MAX_AUDIO_BUS_EFFECTS];   // Reverb delay lines, kept until device is closed
+    } Bus;
+    struct {
+        Camera3D listener;          // Listener camera on last listener update
+        Vector3 velocity;           // Listener velocity, measured on listener updates
+        double time;                // Audio time of last listener update (seconds)
+        bool isListenerSet;         // Listener updated at least once, velocities can be measured
+        int model;                  // Distance attenuation model: AudioAttenuationModel
+        float minDistance;          // Distance attenuation starts at this distance
+        float maxDistance;          // Distance attenuation stops at this distance
+        float rolloff;              // Distance attenuation roll-off factor
+        float dopplerFactor;        // Doppler effect strength, 0.0f disables it
+        AudioSpatialParams emitters[MAX_AUDIO_SPATIAL_EMITTERS];    // Playing emitters parameters selected on listener update (game thread)
+        AudioSpatialParams batches[2][MAX_AUDIO_SPATIAL_EMITTERS];  // Emitters parameters batches, sent to mixer once per update
+        int skippedCount;           // Playing emitters not updated on last listener update (over MAX_AUDIO_SPATIAL_EMITTERS)
+        int batchCount[2];          // Emitters on every batch
+        unsigned int batchSequence[2];  // Commands queue position of batch, batch is reused once applied
+        int batch;                  // Next batch to fill
+    } Spatial;
     struct {
         AudioBuffer *pool[MAX_AUDIO_BUFFER_POOL_CHANNELS];      // Multichannel AudioBuffer pointers pool
         unsigned int poolCounter;                               // AudioBuffer pointers pool counter
-        unsigned int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // AudioBuffer pool channels
+        unsigned int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // AudioBuffer pool channels (play age)
+        int freeChannels[MAX_AUDIO_BUFFER_POOL_CHANNELS];       // Free channels stack (game thread)
+        int freeCount;                                          // Free channels stack count
+        bool isChannelFree[MAX_AUDIO_BUFFER_POOL_CHANNELS];     // Channel is in free channels stack
+        AudioBuffer *sources[MAX_AUDIO_BUFFER_POOL_CHANNELS];   // Sound played on every channel (game thread)
+        AudioChannelRelease released[MAX_AUDIO_CHANNEL_RELEASES];         // Channels released by mixer (single producer, single consumer)
+        volatile unsigned int releasedWriteIndex;               // Channels released, only written by mixer
+        volatile unsigned int releasedReadIndex;                // Channels recovered, only written by game thread
     } MultiChannel;
+    struct {
+        MusicDecoder *first;        // Music decoders list
+        ma_thread thread;           // Decoder thread, decodes all music on the list
+        ma_mutex lock;              // Decoders lock, shared by game thread and decoder thread (never by mixer)
+        bool isLockReady;           // Decoders lock initialized
+        volatile bool running;      // Decoder thread running
+    } Decoder;
+    struct {
+        int mode;                   // Storage mode for sounds loaded next: SoundStorageMode
+        CompressedSound *first;     // Sounds cache list, least recently played first
+        CompressedSound *last;      // Sounds cache list, most recently played last
+    } Storage;
 } AudioData;
 
 //----------------------------------------------------------------------------------
@@ -300,18 +603,75 @@ static AudioData AUDIO = {          // Global AUDIO context
     // After some math, considering a sampleRate of 48000, a buffer refill rate of 1/60 seconds and a
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
-    .Buffer.defaultSize = 4096
+    .Buffer.defaultSize = 4096,
+    .Mixer.budget = DEFAULT_AUDIO_VOICES_BUDGET,
+    .Mixer.buses = { { .volume = 1.0f }, { .volume = 1.0f }, { .volume = 1.0f } },
+    .Spatial.model = AUDIO_ATTENUATION_INVERSE,
+    .Spatial.minDistance = 1.0f,
+    .Spatial.maxDistance = 100.0f,
+    .Spatial.rolloff = 1.0f,
+    .Spatial.dopplerFactor = 1.0f
 };
 
+// Reverb delay lines length (frames), tuned for 44100 Hz (Freeverb tuning)
+static const int reverbCombDelays[AUDIO_REVERB_COMBS] = { 1116, 1188, 1277, 1356 };
+static const int reverbAllpassDelays[AUDIO_REVERB_ALLPASSES] = { 556, 441 };
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void OnLog(ma_context *pContext, ma_device *pDevice, ma_uint32 logLevel, const char *message);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume);
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float localVolume);
+static void MixAudioFramesPanned(float *framesOut, const float *framesIn, ma_uint32 frameCount, float volumeLeft, float volumeRight);
+static void MixAudioVoice(AudioVoice *voice, float *framesOut, ma_uint32 frameCount, ma_uint32 channels);
+static void MixAudioResampleGroup(int group, float *framesOut, ma_uint32 frameCount, ma_uint32 channels);
+static void UpdateAudioResampleGroups(void);
+static void UpdateAudioVirtualVoices(void);             // Select voices mixed within budget, remaining voices are virtual
+static void AdvanceAudioVoice(AudioVoice *voice, ma_uint32 frameCount);    // Advance virtual voice cursor without mixing
+
+static void SetAudioEffectParams(AudioEffect *effect, float value1, float value2);  // Compute effect coefficients from parameters (audio thread)
+static void ProcessAudioBusEffects(AudioBus *bus, ma_uint32 frameCount);    // Process bus frames through bus effects chain
+static void ProcessAudioFilter(AudioEffect *effect, float *frames, ma_uint32 frameCount);   // Process biquad filter effect
+static void ProcessAudioDynamics(AudioEffect *effect, float *frames, ma_uint32 frameCount); // Process compressor, limiter or ducking effect
+static void ProcessAudioReverb(AudioEffect *effect, float *frames, ma_uint32 frameCount);   // Process reverb effect
+static void CloseAudioBuses(void);                      // Clear buses effects chains and free reverbs memory
+
+static double GetAudioTime(void);                       // Get audio time for 3d audio velocities (seconds)
+static void GetAudioSpatialParams(AudioBuffer *buffer, float *gains, float *doppler);  // Compute emitter gains and doppler factor from listener
+static void PushAudioSpatialParams(AudioBuffer *buffer);    // Send emitter 3d audio parameters to mixer (game thread)
+static void SetAudioBufferSpatial(AudioBuffer *buffer, const float *gains, float doppler); // Apply emitter 3d audio parameters (audio thread)
+static void UpdateAudioBufferRate(AudioBuffer *buffer); // Set converter output sample rate from pitch and doppler (audio thread)
 
 static void InitAudioBufferPool(void);                  // Initialise the multichannel buffer pool
 static void CloseAudioBufferPool(void);                 // Close the audio buffers pool
+static void UpdateAudioBufferPool(void);                // Recover multichannel pool channels released by mixer
+static void ReleaseAudioPoolChannel(AudioBuffer *buffer, unsigned int sequence);   // Release pool channel to game thread (audio thread)
+
+static int ReadMusicStreamSamples(Music music, void *pcm, int samplesCount);  // Decode music samples, returns samples consumed
+static void RewindMusicStream(Music music);             // Seek music decoding to start
+static bool SeekMusicStreamFrame(Music music, unsigned int frame);  // Seek music decoding to frame (sample-accurate)
+static void ResetMusicDecoder(MusicDecoder *decoder);   // Restart music decoder from music start
+static bool SeekMusicDecoder(MusicDecoder *decoder, unsigned int frame);    // Restart music decoder from frame
+static void UpdateMusicDecoder(MusicDecoder *decoder);  // Feed audio stream and decode ahead (decoder thread)
+#if !defined(MA_EMSCRIPTEN)
+static ma_thread_result MA_THREADCALL ProcessMusicDecoders(void *data); // Music decoder thread main loop
+#endif
+
+static void PushAudioCommand(int type, AudioBuffer *buffer, AudioBuffer *source, float value);  // Send command to mixer (game thread)
+static void QueueAudioCommand(AudioCommand command);    // Push command to commands queue, applied directly if mixer is not running
+static void ProcessAudioCommands(void);                 // Apply pending commands to mixer voices (audio thread)
+static void ApplyAudioCommand(AudioCommand command);    // Apply one command to mixer voices
+static void RemoveAudioVoice(AudioVoice *voice);        // Remove voice from mixer voices list
+static void FreeUnloadedAudioBuffers(void);             // Free unloaded audio buffers already released by mixer
+
+static int GetCompressedSoundType(const char *fileName);    // Get compressed sound file type (OGG, FLAC), -1 if not supported
+static Sound LoadCompressedSound(const char *fileName); // Load sound keeping compressed file data (OGG, FLAC)
+static Sound LoadCompressedSoundFromMemory(const char *fileName, int ctxType, unsigned char *fileData, int fileDataSize);  // Load sound keeping compressed file data, data is owned by sound
+static bool CacheCompressedSound(CompressedSound *sound);   // Decode compressed sound into sounds cache (if required)
+static bool IsCompressedSoundPlaying(CompressedSound *sound);   // Check if compressed sound decoded data is being played
+static bool IsAudioBufferActive(AudioBuffer *buffer);   // Check if audio buffer is being played (paused included), by itself or by multichannel pool channels
+static void UntrackCompressedSound(CompressedSound *sound); // Remove compressed sound from sounds cache list
 
 #if defined(SUPPORT_FILEFORMAT_WAV)
 static Wave LoadWAV(const char *fileName);              // Load WAV file
@@ -327,9 +687,17 @@ static Wave LoadFLAC(const char *fileName);             // Load FLAC file
 static Wave LoadMP3(const char *fileName);              // Load MP3 file
 #endif
 
+#if !defined(RAUDIO_STANDALONE)
+static bool DecodeSoundAsset(void *asset, const char *fileName);   // Load sound asset wave or compressed file data (loader thread)
+static bool FinalizeSoundAsset(void *asset, const char *fileName); // Load sound asset audio buffer (main thread)
+static void UnloadSoundAsset(void *asset);                         // Unload sound asset not retrieved
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 bool IsFileExtension(const char *fileName, const char *ext);// Check file extension
+unsigned char *LoadFileData(const char *fileName, int *bytesRead);      // Load file data as byte array (read)
 void TraceLog(int msgType, const char *text, ...);      // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
+void SaveFileData(const char *fileName, void *data, int bytesToWrite);  // Save data to file from byte array (write)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -346,6 +714,8 @@ void PauseAudioBuffer(AudioBuffer *buffer);
 void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
+void SetAudioBufferBus(AudioBuffer *buffer, int bus);
+void SetAudioBufferPosition(AudioBuffer *buffer, Vector3 position);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -381,6 +751,11 @@ void InitAudioDevice(void)
     config.dataCallback       = OnSendAudioDataToDevice;
     config.pUserData          = NULL;
 
+    // Mixing happens on a seperate thread, game thread requests are sent through a lock-free
+    // commands queue so the device callback never waits for the game thread
+    ma_timer_init(&AUDIO.Mixer.timer);
+    AUDIO.Mixer.xruns = 0;
+
     result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
     if (result != MA_SUCCESS)
     {
@@ -400,16 +775,6 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a seperate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&AUDIO.System.context, &AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_ERROR, "Failed to create mutex for audio mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
-
     TRACELOG(LOG_INFO, "Audio device initialized successfully");
     TRACELOG(LOG_INFO, "Audio backend: miniaudio / %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "Audio format: %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
@@ -420,6 +785,48 @@ void InitAudioDevice(void)
     InitAudioBufferPool();
     TRACELOG(LOG_INFO, "Audio multichannel pool size: %i", MAX_AUDIO_BUFFER_POOL_CHANNELS);
 
+    // NOTE: Music decoder thread is only started when required, see SetMusicStreamThreaded()
+    AUDIO.Decoder.isLockReady = (ma_mutex_init(&AUDIO.System.context, &AUDIO.Decoder.lock) == MA_SUCCESS);
+
+    AUDIO.System.isReady = true;
+}
+
+// Initialize audio context without playback device (offline rendering)
+// NOTE: Mixer runs on game thread when requested by RenderAudioFrames(), audio can be
+// rendered faster than real-time (or slower) and output is deterministic
+void InitAudioDeviceOffline(void)
+{
+    // NOTE: Null backend context only provides threading primitives, no device is opened
+    ma_backend backends[] = { ma_backend_null };
+    ma_context_config ctxConfig = ma_context_config_init();
+    ctxConfig.logCallback = OnLog;
+
+    ma_result result = ma_context_init(backends, 1, &ctxConfig, &AUDIO.System.context);
+    if (result != MA_SUCCESS)
+    {
+        TRACELOG(LOG_ERROR, "Failed to initialize audio context");
+        return;
+    }
+
+    // Mixer only requires device playback format
+    AUDIO.System.device.playback.format = AUDIO_DEVICE_FORMAT;
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    AUDIO.System.device.masterVolumeFactor = 1.0f;
+
+    ma_timer_init(&AUDIO.Mixer.timer);
+    AUDIO.Mixer.xruns = 0;
+    AUDIO.System.framesRendered = 0;
+
+    TRACELOG(LOG_INFO, "Audio device initialized successfully (offline rendering)");
+
+    InitAudioBufferPool();
+    TRACELOG(LOG_INFO, "Audio multichannel pool size: %i", MAX_AUDIO_BUFFER_POOL_CHANNELS);
+
+    // NOTE: Music decoded on background is decoded by RenderAudioFrames(), no decoder thread is started
+    AUDIO.Decoder.isLockReady = (ma_mutex_init(&AUDIO.System.context, &AUDIO.Decoder.lock) == MA_SUCCESS);
+
+    AUDIO.System.isOffline = true;
     AUDIO.System.isReady = true;
 }
 
@@ -428,12 +835,46 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
+#if !defined(MA_EMSCRIPTEN)
+        // Stop music decoder thread, music not unloaded is not decoded anymore
+        if (AUDIO.Decoder.running)
+        {
+            AUDIO_STORE_RELEASE(AUDIO.Decoder.running, false);
+            ma_thread_wait(&AUDIO.Decoder.thread);
+        }
+#endif
+        if (AUDIO.Decoder.isLockReady) ma_mutex_uninit(&AUDIO.Decoder.lock);
+        AUDIO.Decoder.isLockReady = false;
+
+        if (!AUDIO.System.isOffline) ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
+
+        // Mixer is not running anymore, apply pending commands and stop remaining voices
+        ProcessAudioCommands();
+        while (AUDIO.Mixer.voices != NULL)
+        {
+            AUDIO_STORE_RELEASE(AUDIO.Mixer.voices->buffer->endSequence, AUDIO.Mixer.voices->sequence);
+            RemoveAudioVoice(AUDIO.Mixer.voices);
+        }
+
+        // Resample groups are set up again on next mix, previous voices state is discarded
+        for (int i = 0; i < MAX_AUDIO_RESAMPLE_GROUPS; i++) AUDIO.Mixer.groups[i] = (AudioResampleGroup){ 0 };
+
+        CloseAudioBuses();
+
+        // Audio time is restarted with next device, listener velocity is measured again
+        AUDIO.Spatial.isListenerSet = false;
+
+        FreeUnloadedAudioBuffers();
         CloseAudioBufferPool();
 
+        RL_FREE(AUDIO.Buffer.pcm);
+        AUDIO.Buffer.pcm = NULL;
+        AUDIO.Buffer.pcmSize = 0;
+
         TRACELOG(LOG_INFO, "Audio device closed successfully");
     }
     else TRACELOG(LOG_WARNING, "Could not close audio device because it is not currently initialized");
@@ -451,6 +892,336 @@ void SetMasterVolume(float volume)
     ma_device_set_master_volume(&AUDIO.System.device, volume);
 }
 
+// Get number of audio xruns (mixer callbacks taking longer than the audio they provide)
+int GetAudioXrunsCount(void)
+{
+    return (int)AUDIO_LOAD_ACQUIRE(AUDIO.Mixer.xruns);
+}
+
+// Set maximum number of voices mixed at the same time
+// NOTE: Lower priority (and quieter) voices over budget become virtual, they keep playing without being mixed
+void SetAudioVoicesBudget(int count)
+{
+    if (count < 0) count = 0;
+    if (count > MAX_AUDIO_VOICES)
+    {
+        TRACELOG(LOG_WARNING, "SetAudioVoicesBudget() : Budget %i over maximum mixed voices, set to %i (MAX_AUDIO_VOICES)", count, MAX_AUDIO_VOICES);
+        count = MAX_AUDIO_VOICES;
+    }
+
+    AUDIO_STORE_RELEASE(AUDIO.Mixer.budget, count);
+}
+
+// Get number of voices mixed on last mix
+int GetAudioVoicesMixed(void)
+{
+    return AUDIO_LOAD_ACQUIRE(AUDIO.Mixer.voicesMixed);
+}
+
+// Get number of virtual voices on last mix (playing but not mixed)
+int GetAudioVoicesVirtual(void)
+{
+    return AUDIO_LOAD_ACQUIRE(AUDIO.Mixer.voicesVirtual);
+}
+
+// Render mixed audio frames on offline mode (stereo, 32 bit float, 44100 Hz)
+// NOTE 1: Frames are mixed in periods, music decoded on background is decoded before every period
+// NOTE 2: Music updated with UpdateMusicStream() must be rendered in blocks smaller than its stream buffer
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "RenderAudioFrames() : Audio device must be initialized with InitAudioDeviceOffline()");
+        return;
+    }
+
+    for (int framesRendered = 0; framesRendered < frameCount; framesRendered += AUDIO_OFFLINE_PERIOD_FRAMES)
+    {
+        int framesToRender = frameCount - framesRendered;
+        if (framesToRender > AUDIO_OFFLINE_PERIOD_FRAMES) framesToRender = AUDIO_OFFLINE_PERIOD_FRAMES;
+
+        if ((AUDIO.Decoder.first != NULL) && AUDIO.Decoder.isLockReady)
+        {
+            ma_mutex_lock(&AUDIO.Decoder.lock);
+            for (MusicDecoder *decoder = AUDIO.Decoder.first; decoder != NULL; decoder = decoder->next) UpdateMusicDecoder(decoder);
+            ma_mutex_unlock(&AUDIO.Decoder.lock);
+        }
+
+        OnSendAudioDataToDevice(&AUDIO.System.device, frames + framesRendered*AUDIO_DEVICE_CHANNELS, NULL, framesToRender);
+    }
+
+    AUDIO.System.framesRendered += frameCount;
+
+    // NOTE: Master volume is applied by miniaudio when a playback device is used
+    float volume = AUDIO.System.device.masterVolumeFactor;
+    if (volume != 1.0f) for (int i = 0; i < frameCount*AUDIO_DEVICE_CHANNELS; i++) frames[i] *= volume;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio buses and effects
+//----------------------------------------------------------------------------------
+
+// Set volume for a mixer bus (1.0 is max level)
+void SetAudioBusVolume(int bus, float volume)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES))
+    {
+        TRACELOG(LOG_WARNING, "SetAudioBusVolume() : Audio bus %i is not valid", bus);
+        return;
+    }
+
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_BUS_VOLUME;
+    command.bus = bus;
+    command.value = volume;
+
+    QueueAudioCommand(command);
+}
+
+// Add effect at the end of a bus processing chain, returns effect index (-1 on failure)
+// NOTE: Effects parameters depend on effect type, see AudioEffectType
+int AddAudioBusEffect(int bus, int type, float value1, float value2)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (type < AUDIO_EFFECT_LOWPASS) || (type > AUDIO_EFFECT_DUCKING))
+    {
+        TRACELOG(LOG_WARNING, "AddAudioBusEffect() : Audio bus %i or effect type %i is not valid", bus, type);
+        return -1;
+    }
+
+    int effect = AUDIO.Bus.effectsCount[bus];
+
+    if (effect >= MAX_AUDIO_BUS_EFFECTS)
+    {
+        TRACELOG(LOG_WARNING, "AddAudioBusEffect() : Audio bus %i effects chain is full", bus);
+        return -1;
+    }
+
+    // Reverb delay lines are allocated here and reused by following reverbs on the same position
+    if ((type == AUDIO_EFFECT_REVERB) && (AUDIO.Bus.reverbs[bus][effect] == NULL))
+    {
+        AUDIO.Bus.reverbs[bus][effect] = (AudioReverb *)RL_CALLOC(1, sizeof(AudioReverb));
+
+        if (AUDIO.Bus.reverbs[bus][effect] == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AddAudioBusEffect() : Failed to allocate memory for reverb");
+            return -1;
+        }
+    }
+
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_BUS_EFFECT;
+    command.bus = bus;
+    command.effect = effect;
+    command.effectType = type;
+    command.values[0] = value1;
+    command.values[1] = value2;
+
+    QueueAudioCommand(command);
+
+    AUDIO.Bus.effectTypes[bus][effect] = type;
+    AUDIO.Bus.effectsCount[bus]++;
+
+    return effect;
+}
+
+// Set parameters of a bus effect, effect state is kept (no clicks or reverb tail lost)
+void SetAudioBusEffect(int bus, int effect, float value1, float value2)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (effect < 0) || (effect >= AUDIO.Bus.effectsCount[bus]))
+    {
+        TRACELOG(LOG_WARNING, "SetAudioBusEffect() : Audio bus %i effect %i is not valid", bus, effect);
+        return;
+    }
+
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_BUS_EFFECT;
+    command.bus = bus;
+    command.effect = effect;
+    command.effectType = AUDIO.Bus.effectTypes[bus][effect];
+    command.values[0] = value1;
+    command.values[1] = value2;
+
+    QueueAudioCommand(command);
+}
+
+// Remove all effects from a bus processing chain
+void ClearAudioBusEffects(int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES))
+    {
+        TRACELOG(LOG_WARNING, "ClearAudioBusEffects() : Audio bus %i is not valid", bus);
+        return;
+    }
+
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_BUS_CLEAR;
+    command.bus = bus;
+
+    QueueAudioCommand(command);
+
+    AUDIO.Bus.effectsCount[bus] = 0;
+}
+
+// Get bus mixing and effects time on last mix, relative to audio mixed duration (1.0f means real-time)
+float GetAudioBusCpuUsage(int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return 0.0f;
+
+    return (float)AUDIO_LOAD_ACQUIRE(AUDIO.Mixer.buses[bus].usage)/1000000.0f;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - 3d audio
+//----------------------------------------------------------------------------------
+
+// Update 3d audio listener and send playing emitters parameters to mixer (once per frame)
+// NOTE: Emitters are updated in a single batch, listener and emitters velocities (doppler)
+// are measured from their positions change since last update. Only playing emitters are sent,
+// up to MAX_AUDIO_SPATIAL_EMITTERS (loudest ones), stopped emitters get parameters on play
+void UpdateAudioListener(Camera3D camera)
+{
+    double time = GetAudioTime();
+    float elapsed = AUDIO.Spatial.isListenerSet? (float)(time - AUDIO.Spatial.time) : 0.0f;
+
+    if (elapsed > 0.0f)
+    {
+        AUDIO.Spatial.velocity.x = (camera.position.x - AUDIO.Spatial.listener.position.x)/elapsed;
+        AUDIO.Spatial.velocity.y = (camera.position.y - AUDIO.Spatial.listener.position.y)/elapsed;
+        AUDIO.Spatial.velocity.z = (camera.position.z - AUDIO.Spatial.listener.position.z)/elapsed;
+    }
+    else AUDIO.Spatial.velocity = (Vector3){ 0.0f, 0.0f, 0.0f };
+
+    AUDIO.Spatial.listener = camera;
+    AUDIO.Spatial.time = time;
+    AUDIO.Spatial.isListenerSet = true;
+
+    AudioSpatialParams *emitters = AUDIO.Spatial.emitters;
+    int count = 0;
+    int skipped = 0;
+    int quietest = 0;               // Selected emitter with lowest gain, replaced by louder emitters once full
+    float quietestGain = 0.0f;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (!buffer->isSpatial) continue;
+
+        if (elapsed > 0.0f)
+        {
+            buffer->velocity.x = (buffer->position.x - buffer->previousPosition.x)/elapsed;
+            buffer->velocity.y = (buffer->position.y - buffer->previousPosition.y)/elapsed;
+            buffer->velocity.z = (buffer->position.z - buffer->previousPosition.z)/elapsed;
+        }
+
+        buffer->previousPosition = buffer->position;
+
+        if (!IsAudioBufferActive(buffer)) continue;
+
+        AudioSpatialParams params = { 0 };
+        params.buffer = buffer;
+        GetAudioSpatialParams(buffer, params.gains, &params.doppler);
+
+        float gain = fmaxf(params.gains[0], params.gains[1]);
+
+        if (count < MAX_AUDIO_SPATIAL_EMITTERS)
+        {
+            if ((count == 0) || (gain < quietestGain))
+            {
+                quietest = count;
+                quietestGain = gain;
+            }
+
+            emitters[count] = params;
+            count++;
+        }
+        else
+        {
+            // Emitters limit reached, quietest emitter is not updated (keeps its previous parameters)
+            skipped++;
+
+            if (gain > quietestGain)
+            {
+                emitters[quietest] = params;
+                quietestGain = gain;
+
+                for (int i = 0; i < count; i++)
+                {
+                    float emitterGain = fmaxf(emitters[i].gains[0], emitters[i].gains[1]);
+
+                    if (emitterGain < quietestGain)
+                    {
+                        quietest = i;
+                        quietestGain = emitterGain;
+                    }
+                }
+            }
+        }
+    }
+
+    if ((skipped > 0) && (AUDIO.Spatial.skippedCount == 0))
+    {
+        TRACELOG(LOG_WARNING, "UpdateAudioListener() : %i playing emitters over MAX_AUDIO_SPATIAL_EMITTERS (%i), quietest ones are not updated", skipped, MAX_AUDIO_SPATIAL_EMITTERS);
+    }
+
+    AUDIO.Spatial.skippedCount = skipped;
+
+    if (count == 0) return;
+
+    // Batch is reused once mixer has applied it, if mixer is not keeping up (batch still pending)
+    // emitters parameters are sent as individual commands, so no update is lost
+    int batch = AUDIO.Spatial.batch;
+
+    if ((int)(AUDIO_LOAD_ACQUIRE(AUDIO.Command.readIndex) - AUDIO.Spatial.batchSequence[batch]) < 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            AudioCommand command = { 0 };
+            command.type = AUDIO_COMMAND_SPATIAL;
+            command.buffer = emitters[i].buffer;
+            command.values[0] = emitters[i].gains[0];
+            command.values[1] = emitters[i].gains[1];
+            command.value = emitters[i].doppler;
+
+            QueueAudioCommand(command);
+        }
+
+        return;
+    }
+
+    memcpy(AUDIO.Spatial.batches[batch], emitters, count*sizeof(AudioSpatialParams));
+    AUDIO.Spatial.batchCount[batch] = count;
+
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_SPATIAL_BATCH;
+    command.value = (float)batch;
+
+    QueueAudioCommand(command);
+
+    AUDIO.Spatial.batchSequence[batch] = AUDIO.Command.writeIndex;
+    AUDIO.Spatial.batch = (batch + 1)%2;
+}
+
+// Set 3d audio distance attenuation model (AUDIO_ATTENUATION_INVERSE, 1.0f, 100.0f, 1.0f by default)
+// NOTE: Emitters closer than minDistance are not attenuated, attenuation stops at maxDistance
+void SetAudioAttenuation(int model, float minDistance, float maxDistance, float rolloff)
+{
+    if ((model < AUDIO_ATTENUATION_NONE) || (model > AUDIO_ATTENUATION_EXPONENTIAL) || (minDistance <= 0.0f) || (maxDistance < minDistance))
+    {
+        TRACELOG(LOG_WARNING, "SetAudioAttenuation() : Attenuation model %i or distances are not valid", model);
+        return;
+    }
+
+    AUDIO.Spatial.model = model;
+    AUDIO.Spatial.minDistance = minDistance;
+    AUDIO.Spatial.maxDistance = maxDistance;
+    AUDIO.Spatial.rolloff = (rolloff < 0.0f)? 0.0f : rolloff;
+}
+
+// Set 3d audio doppler effect strength (1.0f by default, 0.0f disables it)
+void SetAudioDopplerFactor(float factor)
+{
+    AUDIO.Spatial.dopplerFactor = (factor < 0.0f)? 0.0f : factor;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -458,6 +1229,8 @@ void SetMasterVolume(float volume)
 // Initialize a new audio buffer (filled with silence)
 AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
 {
+    FreeUnloadedAudioBuffers();
+
     AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
 
     if (audioBuffer == NULL)
@@ -490,6 +1263,13 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->usage = usage;
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
+    audioBuffer->voice.buffer = audioBuffer;
+    audioBuffer->sampleRateOut = AUDIO_DEVICE_SAMPLE_RATE;
+    audioBuffer->pitchSampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    audioBuffer->spatialGains[0] = 1.0f;
+    audioBuffer->spatialGains[1] = 1.0f;
+    audioBuffer->doppler = 1.0f;
+    audioBuffer->poolIndex = -1;
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
@@ -503,37 +1283,59 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is released once the mixer has applied the unload command, it could be mixing it right now
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_data_converter_uninit(&buffer->converter);
         UntrackAudioBuffer(buffer);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+
+        // NOTE: Decoded data is freed with the buffer, even if it was being released from sounds cache
+        if (buffer->compressed != NULL)
+        {
+            if (buffer->data != NULL) UntrackCompressedSound(buffer->compressed);
+
+            RL_FREE(buffer->compressed->fileData);
+            RL_FREE(buffer->compressed);
+            buffer->compressed = NULL;
+        }
+
+        PushAudioCommand(AUDIO_COMMAND_UNLOAD, buffer, NULL, 0.0f);
+
+        buffer->unloadSequence = AUDIO.Command.writeIndex;
+        buffer->next = AUDIO.Buffer.unloaded;
+        AUDIO.Buffer.unloaded = buffer;
+
+        FreeUnloadedAudioBuffers();
     }
 }
 
 // Check if an audio buffer is playing
+// NOTE: Mixer reports non-looping buffers reaching the end through endSequence
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL) result = (buffer->playing && !buffer->paused && (AUDIO_LOAD_ACQUIRE(buffer->endSequence) != buffer->playSequence));
 
     return result;
 }
 
 // Play an audio buffer
-// NOTE: Buffer is restarted to the start.
+// NOTE: Buffer is restarted to the start (streams keep their position).
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+        buffer->playSequence++;
+
+        // 3d audio emitters start playing with current listener parameters
+        if (buffer->isSpatial) PushAudioSpatialParams(buffer);
+
+        PushAudioCommand(AUDIO_COMMAND_PLAY, buffer, NULL, buffer->volume);
         buffer->playing = true;
         buffer->paused = false;
-        buffer->frameCursorPos = 0;
     }
 }
 
@@ -546,10 +1348,10 @@ void StopAudioBuffer(AudioBuffer *buffer)
         {
             buffer->playing = false;
             buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->totalFramesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            AUDIO_STORE_RELEASE(buffer->totalFramesProcessed, 0);
+
+            PushAudioCommand(AUDIO_COMMAND_STOP, buffer, NULL, 0.0f);
+            buffer->stopSequence = AUDIO.Command.writeIndex;
         }
     }
 }
@@ -557,19 +1359,31 @@ void StopAudioBuffer(AudioBuffer *buffer)
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = true;
+    if (buffer != NULL)
+    {
+        buffer->paused = true;
+        PushAudioCommand(AUDIO_COMMAND_PAUSE, buffer, NULL, 0.0f);
+    }
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = false;
+    if (buffer != NULL)
+    {
+        buffer->paused = false;
+        PushAudioCommand(AUDIO_COMMAND_RESUME, buffer, NULL, 0.0f);
+    }
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL)
+    {
+        buffer->volume = volume;
+        PushAudioCommand(AUDIO_COMMAND_VOLUME, buffer, NULL, volume);
+    }
 }
 
 // Set pitch for an audio buffer
@@ -577,51 +1391,68 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if (buffer != NULL)
     {
-        float pitchMul = pitch/buffer->pitch;
-
         // Pitching is just an adjustment of the sample rate.
         // Note that this changes the duration of the sound:
         //  - higher pitches will make the sound faster
         //  - lower pitches make it slower
-        ma_uint32 newOutputSampleRate = (ma_uint32)((float)buffer->converter.config.sampleRateOut/pitchMul);
-        buffer->pitch *= (float)buffer->converter.config.sampleRateOut/newOutputSampleRate;
+        // NOTE: Output sample rate is computed from base rate, avoiding accumulated error on pitch changes
+        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.config.sampleRateOut/pitch);
+        buffer->pitch = pitch;
 
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.config.sampleRateIn, newOutputSampleRate);
+        // NOTE: Converter is used while mixing, new rate is set by the mixer
+        PushAudioCommand(AUDIO_COMMAND_PITCH, buffer, NULL, (float)outputSampleRate);
     }
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
+// Set mixer bus for an audio buffer
+void SetAudioBufferBus(AudioBuffer *buffer, int bus)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (buffer != NULL)
     {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+        if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) TRACELOG(LOG_WARNING, "SetAudioBufferBus() : Audio bus %i is not valid", bus);
+        else PushAudioCommand(AUDIO_COMMAND_BUS, buffer, NULL, (float)bus);
+    }
+}
+
+// Set 3d audio emitter position for an audio buffer
+// NOTE: Position is sent to mixer on next listener update, with all emitters
+void SetAudioBufferPosition(AudioBuffer *buffer, Vector3 position)
+{
+    if (buffer != NULL)
+    {
+        // New emitters have no velocity on first listener update
+        if (!buffer->isSpatial) buffer->previousPosition = position;
+
+        buffer->position = position;
+        buffer->isSpatial = true;
+    }
+}
 
-        AUDIO.Buffer.last = buffer;
+// Track audio buffer to linked list next position
+// NOTE: Audio buffers list is only accessed from game thread, mixer uses its own voices list
+void TrackAudioBuffer(AudioBuffer *buffer)
+{
+    if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+    else
+    {
+        AUDIO.Buffer.last->next = buffer;
+        buffer->prev = AUDIO.Buffer.last;
     }
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    AUDIO.Buffer.last = buffer;
 }
 
 // Untrack audio buffer from linked list
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
+    if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+    else buffer->prev->next = buffer->next;
 
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
+    if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+    else buffer->next->prev = buffer->prev;
 
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    buffer->prev = NULL;
+    buffer->next = NULL;
 }
 
 //----------------------------------------------------------------------------------
@@ -655,11 +1486,19 @@ Wave LoadWave(const char *fileName)
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 Sound LoadSound(const char *fileName)
 {
-    Wave wave = LoadWave(fileName);
+    Sound sound = { 0 };
+
+    // OGG and FLAC sounds can keep file data compressed, decoded when played
+    if (AUDIO.Storage.mode == SOUND_STORAGE_COMPRESSED) sound = LoadCompressedSound(fileName);
 
-    Sound sound = LoadSoundFromWave(wave);
+    if (sound.stream.buffer == NULL)
+    {
+        Wave wave = LoadWave(fileName);
+
+        sound = LoadSoundFromWave(wave);
 
-    UnloadWave(wave);       // Sound is loaded, we can unload wave
+        UnloadWave(wave);       // Sound is loaded, we can unload wave
+    }
 
     return sound;
 }
@@ -679,11 +1518,31 @@ Sound LoadSoundFromWave(Wave wave)
         //   1) Convert the whole sound in one go at load time (here).
         //   2) Convert the audio data in chunks at mixing time.
         //
-        // First option has been selected, format conversion is done on the loading stage.
-        // The downside is that it uses more memory if the original sound is u8 or s16.
+        // Option is selected by sound storage mode, SOUND_STORAGE_DEVICE converts on the loading stage,
+        // mixing is cheaper but it uses more memory if the original sound is u8, s16, mono or lower sample rate.
         ma_format formatIn  = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.sampleCount/wave.channels;
 
+        if (AUDIO.Storage.mode != SOUND_STORAGE_DEVICE)
+        {
+            AudioBuffer *audioBuffer = LoadAudioBuffer(formatIn, wave.channels, wave.sampleRate, frameCountIn, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "LoadSoundFromWave() : Failed to create audio buffer");
+                return sound;
+            }
+
+            memcpy(audioBuffer->data, wave.data, frameCountIn*ma_get_bytes_per_frame(formatIn, wave.channels));
+
+            sound.sampleCount = frameCountIn*wave.channels;
+            sound.stream.sampleRate = wave.sampleRate;
+            sound.stream.sampleSize = wave.sampleSize;
+            sound.stream.channels = wave.channels;
+            sound.stream.buffer = audioBuffer;
+
+            return sound;
+        }
+
         ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "LoadSoundFromWave() : Failed to get frame count for format conversion");
 
@@ -703,6 +1562,38 @@ Sound LoadSoundFromWave(Wave wave)
     return sound;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Request sound loading on background, returns asset handle
+// NOTE: Storage mode is taken on request, file is read and decoded on a loader thread (converted
+// to device format for SOUND_STORAGE_DEVICE), audio buffer is loaded by PollAssetLoads()
+unsigned int LoadSoundAsync(const char *fileName)
+{
+    SoundAsset data = { 0 };
+    data.mode = AUDIO.Storage.mode;
+
+    return RequestAssetLoad(fileName, ASSET_TYPE_SOUND, &data, sizeof(SoundAsset), DecodeSoundAsset, FinalizeSoundAsset, UnloadSoundAsset);
+}
+
+// Get loaded sound and release asset handle
+// NOTE: Returns an empty sound if asset is not loaded yet (handle is kept) or loading failed
+Sound GetAssetSound(unsigned int asset)
+{
+    SoundAsset data = { 0 };
+
+    TakeAssetData(asset, ASSET_TYPE_SOUND, &data, sizeof(SoundAsset));
+
+    return data.sound;
+}
+#endif
+
+// Set storage mode for sounds loaded next
+// NOTE: SOUND_STORAGE_COMPRESSED only applies to OGG and FLAC files loaded with LoadSound(),
+// other sounds are kept in native format (wave format)
+void SetSoundStorageMode(int mode)
+{
+    AUDIO.Storage.mode = mode;
+}
+
 // Unload wave data
 void UnloadWave(Wave wave)
 {
@@ -724,6 +1615,13 @@ void UpdateSound(Sound sound, const void *data, int samplesCount)
 {
     if (sound.stream.buffer != NULL)
     {
+        // NOTE: Decoded data of compressed sounds is not kept, it could be released from sounds cache
+        if (sound.stream.buffer->compressed != NULL)
+        {
+            TRACELOG(LOG_WARNING, "UpdateSound() : Compressed sounds data can not be updated");
+            return;
+        }
+
         StopAudioBuffer(sound.stream.buffer);
 
         // TODO: May want to lock/unlock this since this data buffer is read at mixing time
@@ -801,67 +1699,84 @@ void ExportWaveAsCode(Wave wave, const char *fileName)
 // Play a sound
 void PlaySound(Sound sound)
 {
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->compressed != NULL) && !CacheCompressedSound(sound.stream.buffer->compressed)) return;
+
     PlayAudioBuffer(sound.stream.buffer);
 }
 
 // Play a sound in the multichannel buffer pool
+// NOTE: Free channels are taken in constant time, when all channels are in use
+// the lowest priority channel (oldest on same priority) is stolen
 void PlaySoundMulti(Sound sound)
 {
+    if (sound.stream.buffer == NULL) return;
+    if ((sound.stream.buffer->compressed != NULL) && !CacheCompressedSound(sound.stream.buffer->compressed)) return;
+
+    UpdateAudioBufferPool();
+
     int index = -1;
-    unsigned int oldAge = 0;
-    int oldIndex = -1;
 
-    // find the first non playing pool entry
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    if (AUDIO.MultiChannel.freeCount > 0)
     {
-        if (AUDIO.MultiChannel.channels[i] > oldAge)
-        {
-            oldAge = AUDIO.MultiChannel.channels[i];
-            oldIndex = i;
-        }
-
-        if (!IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i]))
-        {
-            index = i;
-            break;
-        }
+        AUDIO.MultiChannel.freeCount--;
+        index = AUDIO.MultiChannel.freeChannels[AUDIO.MultiChannel.freeCount];
+        AUDIO.MultiChannel.isChannelFree[index] = false;
     }
-
-    // If no none playing pool members can be index choose the oldest
-    if (index == -1)
+    else
     {
-        TRACELOG(LOG_WARNING, "Pool age %i ended a sound early no room in buffer pool", AUDIO.MultiChannel.poolCounter);
+        int stealIndex = -1;
 
-        if (oldIndex == -1)
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
         {
-            // Shouldn't be able to get here... but just in case something odd happens!
-            TRACELOG(LOG_ERROR, "Sound buffer pool could not determine oldest buffer not playing sound");
-            return;
+            AudioBuffer *buffer = AUDIO.MultiChannel.pool[i];
+
+            // Channel finished but not released by mixer yet
+            if (!IsAudioBufferPlaying(buffer))
+            {
+                index = i;
+                break;
+            }
+
+            if ((stealIndex == -1) || (buffer->priority < AUDIO.MultiChannel.pool[stealIndex]->priority) ||
+                ((buffer->priority == AUDIO.MultiChannel.pool[stealIndex]->priority) && (AUDIO.MultiChannel.channels[i] < AUDIO.MultiChannel.channels[stealIndex]))) stealIndex = i;
         }
 
-        index = oldIndex;
+        if (index == -1)
+        {
+            // Sounds never steal channels from higher priority sounds
+            if (AUDIO.MultiChannel.pool[stealIndex]->priority > sound.stream.buffer->priority)
+            {
+                TRACELOG(LOG_DEBUG, "Sound priority %i too low to play, no room in buffer pool", sound.stream.buffer->priority);
+                return;
+            }
 
-        // Just in case...
-        StopAudioBuffer(AUDIO.MultiChannel.pool[index]);
-    }
+            TRACELOG(LOG_WARNING, "Pool age %i ended a sound early no room in buffer pool", AUDIO.MultiChannel.poolCounter);
 
-    // Experimentally mutex lock doesn't seem to be needed this makes sense
-    // as pool[index] isn't playing and the only stuff we're copying
-    // shouldn't be changing...
+            // NOTE: No need to stop the stolen channel, mixer restarts its voice on play
+            index = stealIndex;
+        }
+    }
 
     AUDIO.MultiChannel.channels[index] = AUDIO.MultiChannel.poolCounter;
     AUDIO.MultiChannel.poolCounter++;
 
-    AUDIO.MultiChannel.pool[index]->volume = sound.stream.buffer->volume;
-    AUDIO.MultiChannel.pool[index]->pitch = sound.stream.buffer->pitch;
-    AUDIO.MultiChannel.pool[index]->looping = sound.stream.buffer->looping;
-    AUDIO.MultiChannel.pool[index]->usage = sound.stream.buffer->usage;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[0] = false;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[1] = false;
-    AUDIO.MultiChannel.pool[index]->sizeInFrames = sound.stream.buffer->sizeInFrames;
-    AUDIO.MultiChannel.pool[index]->data = sound.stream.buffer->data;
+    // NOTE: Pool buffer could still be mixed (stop not yet applied), sound data
+    // is copied into pool buffer by the mixer when applying the play command
+    AudioBuffer *buffer = AUDIO.MultiChannel.pool[index];
+
+    AUDIO.MultiChannel.sources[index] = sound.stream.buffer;
+
+    buffer->volume = sound.stream.buffer->volume;
+    buffer->pitch = sound.stream.buffer->pitch;
+    buffer->priority = sound.stream.buffer->priority;
+    buffer->playSequence++;
+
+    // Pool buffer follows sound 3d audio parameters, sent before play request
+    if (sound.stream.buffer->isSpatial) PushAudioSpatialParams(sound.stream.buffer);
 
-    PlayAudioBuffer(AUDIO.MultiChannel.pool[index]);
+    PushAudioCommand(AUDIO_COMMAND_PLAY, buffer, sound.stream.buffer, buffer->volume);
+    buffer->playing = true;
+    buffer->paused = false;
 }
 
 // Stop any sound played with PlaySoundMulti()
@@ -883,6 +1798,17 @@ int GetSoundsPlaying(void)
     return counter;
 }
 
+// Set priority for a sound, higher priority sounds are mixed first (default 0)
+// NOTE: Priority is applied to new instances played with PlaySoundMulti() and to the sound itself
+void SetSoundPriority(Sound sound, int priority)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        sound.stream.buffer->priority = priority;
+        PushAudioCommand(AUDIO_COMMAND_PRIORITY, sound.stream.buffer, NULL, 0.0f);
+    }
+}
+
 // Pause a sound
 void PauseSound(Sound sound)
 {
@@ -919,6 +1845,20 @@ void SetSoundPitch(Sound sound, float pitch)
     SetAudioBufferPitch(sound.stream.buffer, pitch);
 }
 
+// Set mixer bus for a sound (AUDIO_BUS_SFX by default)
+// NOTE: Bus is applied to new instances played with PlaySoundMulti() and to the sound itself
+void SetSoundBus(Sound sound, int bus)
+{
+    SetAudioBufferBus(sound.stream.buffer, bus);
+}
+
+// Set 3d audio emitter position for a sound (applied on next UpdateAudioListener())
+// NOTE: Instances played with PlaySoundMulti() are spatialized at sound position
+void SetSoundPosition(Sound sound, Vector3 position)
+{
+    SetAudioBufferPosition(sound.stream.buffer, position);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1145,6 +2085,8 @@ Music LoadMusicStream(const char *fileName)
     }
     else
     {
+        SetMusicBus(music, AUDIO_BUS_MUSIC);
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "[%s] Music file successfully loaded:", fileName);
         TRACELOG(LOG_INFO, "   Total samples: %i", music.sampleCount);
@@ -1159,6 +2101,8 @@ Music LoadMusicStream(const char *fileName)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    SetMusicStreamThreaded(music, 0);
+
     CloseAudioStream(music.stream);
 
     if (false) { }
@@ -1169,7 +2113,12 @@ void UnloadMusicStream(Music music)
     else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+    else if (music.ctxType == MUSIC_AUDIO_MP3)
+    {
+        RL_FREE(((drmp3 *)music.ctxData)->pSeekPoints);     // Seek table is owned by raudio, see SeekMusicStreamFrame()
+        drmp3_uninit((drmp3 *)music.ctxData);
+        RL_FREE(music.ctxData);
+    }
 #endif
 #if defined(SUPPORT_FILEFORMAT_XM)
     else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
@@ -1184,13 +2133,20 @@ void PlayMusicStream(Music music)
 {
     if (music.stream.buffer != NULL)
     {
-        // For music streams, we need to make sure we maintain the frame cursor position
-        // This is a hack for this section of code in UpdateMusicStream()
-        // NOTE: In case window is minimized, music stream is stopped, just make sure to
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+
+        // Music decoded on background finished playing, play again from start
+        if ((decoder != NULL) && AUDIO.Decoder.isLockReady && AUDIO_LOAD_ACQUIRE(music.stream.buffer->isStreamFinished))
+        {
+            ma_mutex_lock(&AUDIO.Decoder.lock);
+            ResetMusicDecoder(decoder);
+            ma_mutex_unlock(&AUDIO.Decoder.lock);
+        }
+
+        // NOTE: Streams keep their frame cursor position when played, it's only reset on stop
+        // In case window is minimized, music stream is stopped, just make sure to
         // play again on window restore: if (IsMusicPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = music.stream.buffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        music.stream.buffer->frameCursorPos = frameCursorPos;
+        PlayAudioStream(music.stream);
     }
 }
 
@@ -1206,130 +2162,138 @@ void ResumeMusicStream(Music music)
     ResumeAudioStream(music.stream);
 }
 
+// Seek music to a position (in seconds)
+// NOTE: Audio stream data already queued is discarded, music keeps its playing state from new position
+void SeekMusicStream(Music music, float position)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+
+    if ((buffer == NULL) || (music.stream.channels == 0)) return;
+
+    unsigned int frameCount = music.sampleCount/music.stream.channels;
+    unsigned int frame = (position > 0.0f)? (unsigned int)(position*music.stream.sampleRate) : 0;
+    if (frame >= frameCount) frame = (frameCount > 0)? frameCount - 1 : 0;
+
+    bool paused = buffer->playing && buffer->paused;
+    bool playing = paused || IsAudioBufferPlaying(buffer);
+    bool threaded = (buffer->decoder != NULL) && AUDIO.Decoder.isLockReady;
+
+    if (threaded) ma_mutex_lock(&AUDIO.Decoder.lock);
+
+    if (playing)
+    {
+        if (paused) ResumeAudioStream(music.stream);
+        StopAudioStream(music.stream);
+    }
+
+    bool seeked = true;
+
+    if (threaded) seeked = SeekMusicDecoder(buffer->decoder, frame);
+    else
+    {
+        seeked = SeekMusicStreamFrame(music, frame);
+        AUDIO_STORE_RELEASE(buffer->totalFramesProcessed, frame);
+    }
+
+    if (playing)
+    {
+        PlayAudioStream(music.stream);
+        if (paused) PauseAudioStream(music.stream);
+    }
+
+    if (threaded) ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+    if (!seeked) TRACELOG(LOG_WARNING, "SeekMusicStream() : Music could not be seeked to %.3f seconds", position);
+}
+
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
-
-    switch (music.ctxType)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL) && AUDIO.Decoder.isLockReady)
     {
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        // Decoder thread keeps decoding ahead from music start
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        StopAudioStream(music.stream);
+        ResetMusicDecoder(music.stream.buffer->decoder);
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+    }
+    else
+    {
+        StopAudioStream(music.stream);
+        RewindMusicStream(music);
     }
 }
 
 // Update (re-fill) music buffers if data already processed
+// NOTE: Not required for music decoded on background, see SetMusicStreamThreaded()
 void UpdateMusicStream(Music music)
 {
-    if (music.stream.buffer == NULL) return;
+    if ((music.stream.buffer == NULL) || (music.stream.buffer->decoder != NULL)) return;
 
     bool streamEnding = false;
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
-    // NOTE: Using dynamic allocation because it could require more than 16KB
-    void *pcm = RL_CALLOC(subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8, 1);
+    // NOTE: Using dynamic allocation because it could require more than 16KB,
+    // decoding buffer is reused between calls and only grows when required
+    unsigned int pcmSize = subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8;
+
+    if (AUDIO.Buffer.pcmSize < pcmSize)
+    {
+        RL_FREE(AUDIO.Buffer.pcm);
+        AUDIO.Buffer.pcm = RL_CALLOC(pcmSize, 1);
+        AUDIO.Buffer.pcmSize = (AUDIO.Buffer.pcm != NULL)? pcmSize : 0;
+
+        if (AUDIO.Buffer.pcm == NULL) return;
+    }
 
-    int samplesCount = 0;    // Total size of data streamed in L+R samples for xm floats, individual L or R for ogg shorts
+    unsigned char *pcm = (unsigned char *)AUDIO.Buffer.pcm;
+    unsigned int sampleBytes = music.stream.sampleSize/8;
 
     // TODO: Get the sampleLeft using totalFramesProcessed... but first, get total frames processed correctly...
     //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
     int sampleLeft = music.sampleCount - (music.stream.buffer->totalFramesProcessed*music.stream.channels);
 
+    // NOTE: Music passed by value, loop count can not be decreased, music keeps looping unless it plays once
+    bool looping = (music.loopCount != 1);
+
     while (IsAudioStreamProcessed(music.stream))
     {
-        if ((sampleLeft/music.stream.channels) >= subBufferSizeInFrames) samplesCount = subBufferSizeInFrames*music.stream.channels;
-        else samplesCount = sampleLeft;
+        int samplesCount = subBufferSizeInFrames*music.stream.channels;
+        int samplesDecoded = 0;
+        int loopSamples = -1;   // Samples of a new music loop on this buffer, -1 if no loop started
 
-        switch (music.ctxType)
+        // Music loops are decoded without gaps, next loop starts in the same buffer
+        while ((samplesDecoded < samplesCount) && !streamEnding)
         {
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
-                stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, samplesCount);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                // NOTE: Returns the number of samples to process (not required)
-                drflac_read_pcm_frames_s16((drflac *)music.ctxData, samplesCount, (short *)pcm);
+            int samplesToDecode = samplesCount - samplesDecoded;
+            if (samplesToDecode > sampleLeft) samplesToDecode = sampleLeft;
 
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                // NOTE: samplesCount, actually refers to framesCount and returns the number of frames processed
-                drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
+            if (samplesToDecode > 0) sampleLeft -= ReadMusicStreamSamples(music, pcm + samplesDecoded*sampleBytes, samplesToDecode);
+            samplesDecoded += samplesToDecode;
 
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally this function considers 2 channels generation, so samplesCount/2
-                jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, samplesCount/2);
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
+            if (sampleLeft <= 0)
             {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, samplesCount/2, 0);
-            } break;
-        #endif
-            default: break;
+                if (looping && (music.sampleCount > 0))
+                {
+                    RewindMusicStream(music);
+                    sampleLeft = music.sampleCount;
+                    loopSamples = samplesCount - samplesDecoded;
+                }
+                else streamEnding = true;
+            }
         }
 
-        UpdateAudioStream(music.stream, pcm, samplesCount);
+        UpdateAudioStream(music.stream, pcm, samplesDecoded);
 
-        if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))
-        {
-            if (samplesCount > 1) sampleLeft -= samplesCount/2;
-            else sampleLeft -= samplesCount;
-        }
-        else sampleLeft -= samplesCount;
+        // Music time played restarts with every loop
+        if (loopSamples >= 0) AUDIO_STORE_RELEASE(music.stream.buffer->totalFramesProcessed, loopSamples/music.stream.channels);
 
-        if (sampleLeft <= 0)
-        {
-            streamEnding = true;
-            break;
-        }
+        if (streamEnding) break;
     }
 
-    // Free allocated pcm data
-    RL_FREE(pcm);
-
-    // Reset audio stream for looping
-    if (streamEnding)
-    {
-        StopMusicStream(music);        // Stop music (and reset)
-
-        // Decrease loopCount to stop when required
-        if (music.loopCount > 1)
-        {
-            music.loopCount--;         // Decrease loop count
-            PlayMusicStream(music);    // Play again
-        }
-        else if (music.loopCount == 0) PlayMusicStream(music);
-    }
+    // Music played once, stop it (and reset)
+    if (streamEnding) StopMusicStream(music);
     else
     {
         // NOTE: In case window is minimized, music stream is stopped,
@@ -1356,11 +2320,34 @@ void SetMusicPitch(Music music, float pitch)
     SetAudioStreamPitch(music.stream, pitch);
 }
 
+// Set mixer bus for music (AUDIO_BUS_MUSIC by default)
+void SetMusicBus(Music music, int bus)
+{
+    SetAudioStreamBus(music.stream, bus);
+}
+
+// Set 3d audio emitter position for music (applied on next UpdateAudioListener())
+void SetMusicPosition(Music music, Vector3 position)
+{
+    SetAudioStreamPosition(music.stream, position);
+}
+
 // Set music loop count (loop repeats)
 // NOTE: If set to 0, means infinite loop
 void SetMusicLoopCount(Music music, int count)
 {
     music.loopCount = count;
+
+    // Music decoded on background keeps its own loop count
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL) && AUDIO.Decoder.isLockReady)
+    {
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+        int loopsPlayed = (decoder->loopCount > 0)? (int)(decoder->loopCount - decoder->loopsLeft) : 1;
+        decoder->loopsLeft = (count > loopsPlayed)? count - loopsPlayed : 0;
+        decoder->loopCount = count;
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+    }
 }
 
 // Get music time length (in seconds)
@@ -1381,13 +2368,134 @@ float GetMusicTimePlayed(Music music)
     if (music.stream.buffer != NULL)
     {
         //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-        unsigned int samplesPlayed = music.stream.buffer->totalFramesProcessed*music.stream.channels;
+        unsigned int samplesPlayed = AUDIO_LOAD_ACQUIRE(music.stream.buffer->totalFramesProcessed)*music.stream.channels;
         secondsPlayed = (float)samplesPlayed / (music.stream.sampleRate*music.stream.channels);
     }
 
     return secondsPlayed;
 }
 
+// Decode music on a background thread, keeping a ring of buffers decoded ahead of playback
+// NOTE 1: UpdateMusicStream() is not required for music decoded on background
+// NOTE 2: Use 0 buffers to go back to UpdateMusicStream() decoding, buffers decoded ahead are discarded
+void SetMusicStreamThreaded(Music music, int buffersCount)
+{
+    if (music.stream.buffer == NULL) return;
+
+    AudioBuffer *buffer = music.stream.buffer;
+
+    if (buffersCount <= 0)
+    {
+        MusicDecoder *decoder = buffer->decoder;
+        if (decoder == NULL) return;
+
+        // NOTE: Decoder thread could be already stopped by CloseAudioDevice()
+        if (AUDIO.Decoder.isLockReady) ma_mutex_lock(&AUDIO.Decoder.lock);
+
+        MusicDecoder **link = &AUDIO.Decoder.first;
+        while (*link != decoder) link = &(*link)->next;
+        *link = decoder->next;
+
+        buffer->decoder = NULL;
+        AUDIO_STORE_RELEASE(buffer->isStreamFinished, false);
+
+        if (AUDIO.Decoder.isLockReady) ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        RL_FREE(decoder->data);
+        RL_FREE(decoder->samplesCount);
+        RL_FREE(decoder->loopSamples);
+        RL_FREE(decoder);
+
+        return;
+    }
+
+#if defined(MA_EMSCRIPTEN)
+    TRACELOG(LOG_WARNING, "SetMusicStreamThreaded() : Music background decoding not supported on this platform");
+#else
+    if (!AUDIO.System.isReady || !AUDIO.Decoder.isLockReady)
+    {
+        TRACELOG(LOG_WARNING, "SetMusicStreamThreaded() : Audio device must be initialized to decode music on background");
+        return;
+    }
+
+    // Ring buffers size changed, music decoding keeps its position
+    if (buffer->decoder != NULL) SetMusicStreamThreaded(music, 0);
+
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+
+    decoder->music = music;
+    decoder->bufferSize = buffer->sizeInFrames/2*music.stream.channels;
+    decoder->buffersCount = buffersCount;
+    decoder->data = (unsigned char *)RL_CALLOC(decoder->bufferSize*buffersCount, music.stream.sampleSize/8);
+    decoder->samplesCount = (int *)RL_CALLOC(buffersCount, sizeof(int));
+    decoder->loopSamples = (int *)RL_CALLOC(buffersCount, sizeof(int));
+    decoder->loopCount = music.loopCount;
+    decoder->loopsLeft = (music.loopCount > 0)? music.loopCount - 1 : 0;
+
+    // Decoding continues from current music position
+    int samplesLeft = music.sampleCount - (buffer->totalFramesProcessed*music.stream.channels);
+    decoder->samplesLeft = (samplesLeft > 0)? samplesLeft : 0;
+
+    if ((decoder->data == NULL) || (decoder->samplesCount == NULL) || (decoder->loopSamples == NULL))
+    {
+        TRACELOG(LOG_WARNING, "SetMusicStreamThreaded() : Failed to allocate memory for decoded buffers");
+        RL_FREE(decoder->data);
+        RL_FREE(decoder->samplesCount);
+        RL_FREE(decoder->loopSamples);
+        RL_FREE(decoder);
+        return;
+    }
+
+    ma_mutex_lock(&AUDIO.Decoder.lock);
+    decoder->next = AUDIO.Decoder.first;
+    AUDIO.Decoder.first = decoder;
+    buffer->decoder = decoder;
+    ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+    // NOTE: Offline rendering decodes music on RenderAudioFrames(), keeping output deterministic
+    if (!AUDIO.Decoder.running && !AUDIO.System.isOffline)
+    {
+        AUDIO.Decoder.running = true;
+
+        if (ma_thread_create(&AUDIO.System.context, &AUDIO.Decoder.thread, ProcessMusicDecoders, NULL) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "SetMusicStreamThreaded() : Failed to create music decoder thread");
+            AUDIO.Decoder.running = false;
+            SetMusicStreamThreaded(music, 0);
+            return;
+        }
+
+        TRACELOG(LOG_INFO, "Music decoder thread started successfully");
+    }
+#endif
+}
+
+// Get music decoded buffers fill level (0.0f to 1.0f), headroom before playback starves
+// NOTE: For music updated with UpdateMusicStream(), audio stream sub-buffers are considered
+float GetMusicStreamFillLevel(Music music)
+{
+    float fillLevel = 0.0f;
+
+    if (music.stream.buffer != NULL)
+    {
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+
+        if (decoder != NULL)
+        {
+            unsigned int readIndex = AUDIO_LOAD_ACQUIRE(decoder->readIndex);
+            unsigned int writeIndex = AUDIO_LOAD_ACQUIRE(decoder->writeIndex);
+            fillLevel = (float)(writeIndex - readIndex)/decoder->buffersCount;
+        }
+        else
+        {
+            if (!AUDIO_LOAD_ACQUIRE(music.stream.buffer->isSubBufferProcessed[0])) fillLevel += 0.5f;
+            if (!AUDIO_LOAD_ACQUIRE(music.stream.buffer->isSubBufferProcessed[1])) fillLevel += 0.5f;
+        }
+    }
+
+    return fillLevel;
+}
+
 // Init audio stream (to stream audio pcm data)
 AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -1433,28 +2541,31 @@ void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        bool isSubBufferProcessed[2];
+        isSubBufferProcessed[0] = AUDIO_LOAD_ACQUIRE(stream.buffer->isSubBufferProcessed[0]);
+        isSubBufferProcessed[1] = AUDIO_LOAD_ACQUIRE(stream.buffer->isSubBufferProcessed[1]);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
         {
             ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
             {
                 // Both buffers are available for updating.
-                // Update the first one and make sure the cursor is moved back to the front.
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                // Update the one the mixer plays next, mixer cursor is at its start and doesn't move until updated
+                // NOTE: Cursor is written by mixer before marking sub-buffers as processed, it can be read safely
+                subBufferToUpdate = (stream.buffer->frameCursorPos >= subBufferSizeInFrames)? 1 : 0;
             }
             else
             {
                 // Just update whichever sub-buffer is processed.
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
             }
-
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
             unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
 
             // TODO: Get total frames processed on this buffer... DOES NOT WORK.
-            stream.buffer->totalFramesProcessed += subBufferSizeInFrames;
+            AUDIO_STORE_RELEASE(stream.buffer->totalFramesProcessed, stream.buffer->totalFramesProcessed + subBufferSizeInFrames);
 
             // Does this API expect a whole buffer to be updated in one go?
             // Assuming so, but if not will need to change this logic.
@@ -1472,7 +2583,8 @@ void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                // Sub-buffer data must be visible to the mixer before it's marked as available
+                AUDIO_STORE_RELEASE(stream.buffer->isSubBufferProcessed[subBufferToUpdate], false);
             }
             else TRACELOG(LOG_ERROR, "UpdateAudioStream() : Attempting to write too many frames to buffer");
         }
@@ -1485,7 +2597,10 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    return (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1]);
+    // Sub-buffers keep previous data until stop request is applied by mixer
+    if ((int)(AUDIO_LOAD_ACQUIRE(AUDIO.Command.readIndex) - stream.buffer->stopSequence) < 0) return false;
+
+    return (AUDIO_LOAD_ACQUIRE(stream.buffer->isSubBufferProcessed[0]) || AUDIO_LOAD_ACQUIRE(stream.buffer->isSubBufferProcessed[1]));
 }
 
 // Play audio stream
@@ -1530,6 +2645,18 @@ void SetAudioStreamPitch(AudioStream stream, float pitch)
     SetAudioBufferPitch(stream.buffer, pitch);
 }
 
+// Set mixer bus for audio stream (AUDIO_BUS_SFX by default)
+void SetAudioStreamBus(AudioStream stream, int bus)
+{
+    SetAudioBufferBus(stream.buffer, bus);
+}
+
+// Set 3d audio emitter position for audio stream (applied on next UpdateAudioListener())
+void SetAudioStreamPosition(AudioStream stream, Vector3 position)
+{
+    SetAudioBufferPosition(stream.buffer, position);
+}
+
 // Default size for new audio streams
 void SetAudioStreamBufferSizeDefault(int size)
 {
@@ -1560,8 +2687,8 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     // Another thread can update the processed state of buffers so
     // we just take a copy here to try and avoid potential synchronization problems
     bool isSubBufferProcessed[2];
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = AUDIO_LOAD_ACQUIRE(audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = AUDIO_LOAD_ACQUIRE(audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.config.formatIn, audioBuffer->converter.config.channelsIn);
 
@@ -1579,7 +2706,12 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         }
         else
         {
-            if (isSubBufferProcessed[currentSubBufferIndex]) break;
+            if (isSubBufferProcessed[currentSubBufferIndex])
+            {
+                // Stream with no more data ends once all its data has been played
+                if (AUDIO_LOAD_ACQUIRE(audioBuffer->isStreamFinished)) audioBuffer->voice.ended = true;
+                break;
+            }
         }
 
         ma_uint32 totalFramesRemaining = (frameCount - framesRead);
@@ -1606,7 +2738,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            AUDIO_STORE_RELEASE(audioBuffer->isSubBufferProcessed[currentSubBufferIndex], true);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -1614,7 +2746,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                audioBuffer->voice.ended = true;
                 break;
             }
         }
@@ -1682,123 +2814,1759 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 
 // Sending audio data to device callback function
-// NOTE: All the mixing takes place here
+// NOTE: All the mixing takes place here, no locks are used so the callback never waits for the game thread
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
 {
-    (void)pDevice;
+    double startTime = ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer);
 
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+    // Apply game thread requests, voices list is not modified while mixing
+    ProcessAudioCommands();
 
-            ma_uint32 framesRead = 0;
+    // Voices over budget are not mixed, they just keep playing
+    UpdateAudioVirtualVoices();
 
-            while (1)
-            {
-                if (framesRead >= frameCount) break;
+    // Voices in device format sharing the same pitch (and bus) are resampled together
+    UpdateAudioResampleGroups();
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+    ma_uint32 channels = pDevice->playback.channels;
+    double busTime[MAX_AUDIO_BUSES] = { 0 };
+    int busVoices[MAX_AUDIO_BUSES] = { 0 };
 
-                while (framesToRead > 0)
+    // Voices are mixed into their bus by chunks, buses are processed by their effects before output
+    for (ma_uint32 framesMixed = 0; framesMixed < frameCount; framesMixed += AUDIO_MIXER_CHUNK_FRAMES)
+    {
+        ma_uint32 framesToMix = frameCount - framesMixed;
+        if (framesToMix > AUDIO_MIXER_CHUNK_FRAMES) framesToMix = AUDIO_MIXER_CHUNK_FRAMES;
+
+        for (int b = 0; b < MAX_AUDIO_BUSES; b++)
+        {
+            double busStartTime = ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer);
+            AudioBus *bus = &AUDIO.Mixer.buses[b];
+
+            memset(bus->frames, 0, framesToMix*channels*sizeof(float));
+
+            for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+            {
+                // Ignore paused or ended sounds and voices mixed by their resample group
+                if ((voice->buffer->bus != b) || voice->paused || voice->ended || (voice->group >= 0)) continue;
+
+                if (voice->isVirtual) AdvanceAudioVoice(voice, framesToMix);
+                else
+                {
+                    MixAudioVoice(voice, bus->frames, framesToMix, channels);
+                    busVoices[b]++;
+                }
+            }
+
+            for (int i = 0; i < MAX_AUDIO_RESAMPLE_GROUPS; i++)
+            {
+                if ((AUDIO.Mixer.groups[i].voicesCount > 0) && (AUDIO.Mixer.groups[i].bus == b))
+                {
+                    MixAudioResampleGroup(i, bus->frames, framesToMix, channels);
+                    busVoices[b]++;
+                }
+            }
+
+            // Bus level is measured before effects, it's used as sidechain by ducking effects
+            bus->peak = 0.0f;
+            if (busVoices[b] > 0) for (ma_uint32 i = 0; i < framesToMix*channels; i++) if (fabsf(bus->frames[i]) > bus->peak) bus->peak = fabsf(bus->frames[i]);
+
+            busTime[b] += ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer) - busStartTime;
+        }
+
+        for (int b = 0; b < MAX_AUDIO_BUSES; b++)
+        {
+            AudioBus *bus = &AUDIO.Mixer.buses[b];
+
+            // Silent buses without effects don't contribute to output
+            if ((busVoices[b] == 0) && (bus->effectsCount == 0)) continue;
+
+            double busStartTime = ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer);
+
+            ProcessAudioBusEffects(bus, framesToMix);
+            MixAudioFrames((float *)pFramesOut + framesMixed*channels, bus->frames, framesToMix, channels, bus->volume);
+
+            busTime[b] += ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer) - busStartTime;
+        }
+    }
+
+    for (int b = 0; b < MAX_AUDIO_BUSES; b++) AUDIO_STORE_RELEASE(AUDIO.Mixer.buses[b].usage, (unsigned int)(busTime[b]*pDevice->sampleRate/frameCount*1000000.0));
+
+    // Remove voices that reached the end, game thread is notified through endSequence
+    for (AudioVoice *voice = AUDIO.Mixer.voices, *next = NULL; voice != NULL; voice = next)
+    {
+        next = voice->next;
+
+        if (voice->ended)
+        {
+            voice->buffer->frameCursorPos = 0;
+            AUDIO_STORE_RELEASE(voice->buffer->isSubBufferProcessed[0], true);
+            AUDIO_STORE_RELEASE(voice->buffer->isSubBufferProcessed[1], true);
+            AUDIO_STORE_RELEASE(voice->buffer->endSequence, voice->sequence);
+
+            RemoveAudioVoice(voice);
+        }
+    }
+
+    // Mixing slower than real-time means the device is running out of audio data
+    double mixTime = ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer) - startTime;
+    if (mixTime > (double)frameCount/pDevice->sampleRate) AUDIO_STORE_RELEASE(AUDIO.Mixer.xruns, AUDIO.Mixer.xruns + 1);
+}
+
+// This is the main mixing function. Mixing is pretty simple in this project - it's just an accumulation.
+// NOTE: framesOut is both an input and an output. It will be initially filled with zeros outside of this function.
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float localVolume)
+{
+    // Frames are interleaved, all channels samples are mixed as a single array
+    ma_uint32 samplesCount = frameCount*channels;
+    ma_uint32 i = 0;
+
+#if defined(MIXING_SIMD_AVX)
+    __m256 volume8 = _mm256_set1_ps(localVolume);
+    for (; (i + 8) <= samplesCount; i += 8) _mm256_storeu_ps(framesOut + i, _mm256_add_ps(_mm256_loadu_ps(framesOut + i), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), volume8)));
+#endif
+#if defined(MIXING_SIMD_AVX) || defined(MIXING_SIMD_SSE)
+    __m128 volume4 = _mm_set1_ps(localVolume);
+    for (; (i + 4) <= samplesCount; i += 4) _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), volume4)));
+#elif defined(MIXING_SIMD_NEON)
+    for (; (i + 4) <= samplesCount; i += 4) vst1q_f32(framesOut + i, vmlaq_n_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), localVolume));
+#endif
+
+    for (; i < samplesCount; i++) framesOut[i] += (framesIn[i]*localVolume);
+}
+
+// Mix stereo frames with a different volume per channel (3d audio panning)
+// NOTE: SIMD vectors hold whole frames, channels volumes pattern matches frames layout
+static void MixAudioFramesPanned(float *framesOut, const float *framesIn, ma_uint32 frameCount, float volumeLeft, float volumeRight)
+{
+    ma_uint32 samplesCount = frameCount*AUDIO_DEVICE_CHANNELS;
+    ma_uint32 i = 0;
+
+#if defined(MIXING_SIMD_AVX)
+    __m256 volume8 = _mm256_setr_ps(volumeLeft, volumeRight, volumeLeft, volumeRight, volumeLeft, volumeRight, volumeLeft, volumeRight);
+    for (; (i + 8) <= samplesCount; i += 8) _mm256_storeu_ps(framesOut + i, _mm256_add_ps(_mm256_loadu_ps(framesOut + i), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), volume8)));
+#endif
+#if defined(MIXING_SIMD_AVX) || defined(MIXING_SIMD_SSE)
+    __m128 volume4 = _mm_setr_ps(volumeLeft, volumeRight, volumeLeft, volumeRight);
+    for (; (i + 4) <= samplesCount; i += 4) _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), volume4)));
+#elif defined(MIXING_SIMD_NEON)
+    const float volumes[4] = { volumeLeft, volumeRight, volumeLeft, volumeRight };
+    float32x4_t volume4 = vld1q_f32(volumes);
+    for (; (i + 4) <= samplesCount; i += 4) vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), volume4));
+#endif
+
+    for (; i < samplesCount; i += 2)
+    {
+        framesOut[i] += (framesIn[i]*volumeLeft);
+        framesOut[i + 1] += (framesIn[i + 1]*volumeRight);
+    }
+}
+
+// Mix one voice frames into output
+// NOTE: Voices already in device format and sample rate skip data conversion
+static void MixAudioVoice(AudioVoice *voice, float *framesOut, ma_uint32 frameCount, ma_uint32 channels)
+{
+    AudioBuffer *audioBuffer = voice->buffer;
+
+    bool passthrough = (audioBuffer->converter.config.formatIn == AUDIO_DEVICE_FORMAT) &&
+                       (audioBuffer->converter.config.channelsIn == AUDIO_DEVICE_CHANNELS) &&
+                       (audioBuffer->converter.config.sampleRateIn == AUDIO_DEVICE_SAMPLE_RATE) &&
+                       (audioBuffer->sampleRateOut == AUDIO_DEVICE_SAMPLE_RATE);
+
+    ma_uint32 framesRead = 0;
+
+    while (1)
+    {
+        if (framesRead >= frameCount) break;
+
+        // Just read as much data as we can from the stream
+        ma_uint32 framesToRead = (frameCount - framesRead);
+
+        while (framesToRead > 0)
+        {
+            float *tempBuffer = AUDIO.Mixer.voiceFrames;
+
+            ma_uint32 framesToReadRightNow = framesToRead;
+            if (framesToReadRightNow > AUDIO_MIXER_CHUNK_FRAMES) framesToReadRightNow = AUDIO_MIXER_CHUNK_FRAMES;
+
+            ma_uint32 framesJustRead = 0;
+            if (passthrough) framesJustRead = ReadAudioBufferFramesInInternalFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+            else framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+
+            if (framesJustRead > 0)
+            {
+                if (audioBuffer->spatialGains[0] == audioBuffer->spatialGains[1]) MixAudioFrames(framesOut + (framesRead*channels), tempBuffer, framesJustRead, channels, voice->volume*audioBuffer->spatialGains[0]);
+                else MixAudioFramesPanned(framesOut + (framesRead*channels), tempBuffer, framesJustRead, voice->volume*audioBuffer->spatialGains[0], voice->volume*audioBuffer->spatialGains[1]);
+
+                framesToRead -= framesJustRead;
+                framesRead += framesJustRead;
+            }
+
+            if (voice->ended)
+            {
+                framesRead = frameCount;
+                break;
+            }
+
+            // If we weren't able to read all the frames we requested, break
+            if (framesJustRead < framesToReadRightNow)
+            {
+                if (!audioBuffer->looping)
+                {
+                    voice->ended = true;
+                    break;
+                }
+                else
                 {
-                    float tempBuffer[1024]; // 512 frames for stereo
+                    // Should never get here, but just for safety,
+                    // move the cursor position back to the start and continue the loop
+                    audioBuffer->frameCursorPos = 0;
+                    continue;
+                }
+            }
+        }
+
+        // If for some reason we weren't able to read every frame we'll need to break from the loop
+        // Not doing this could theoretically put us into an infinite loop
+        if (framesToRead > 0) break;
+    }
+}
+
+// Mix a resample group voices into output
+// NOTE: Voices are mixed at input sample rate and the result is resampled once for the whole group
+static void MixAudioResampleGroup(int group, float *framesOut, ma_uint32 frameCount, ma_uint32 channels)
+{
+    AudioResampleGroup *resampler = &AUDIO.Mixer.groups[group];
+    ma_uint32 framesMixed = 0;
+
+    while (framesMixed < frameCount)
+    {
+        ma_uint64 framesToMix = frameCount - framesMixed;
+        if (framesToMix > AUDIO_MIXER_CHUNK_FRAMES) framesToMix = AUDIO_MIXER_CHUNK_FRAMES;
+
+        ma_uint64 inputFrames = ma_data_converter_get_required_input_frame_count(&resampler->converter, framesToMix);
+        if (inputFrames > AUDIO_MIXER_CHUNK_FRAMES) inputFrames = AUDIO_MIXER_CHUNK_FRAMES;
+
+        memset(AUDIO.Mixer.groupFrames, 0, (size_t)inputFrames*channels*sizeof(float));
+
+        for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+        {
+            if ((voice->group != group) || voice->ended) continue;
+
+            ma_uint32 framesRead = ReadAudioBufferFramesInInternalFormat(voice->buffer, AUDIO.Mixer.voiceFrames, (ma_uint32)inputFrames);
+            const float *gains = voice->buffer->spatialGains;
+
+            if (gains[0] == gains[1]) MixAudioFrames(AUDIO.Mixer.groupFrames, AUDIO.Mixer.voiceFrames, framesRead, channels, voice->volume*gains[0]);
+            else MixAudioFramesPanned(AUDIO.Mixer.groupFrames, AUDIO.Mixer.voiceFrames, framesRead, voice->volume*gains[0], voice->volume*gains[1]);
+
+            if ((framesRead < inputFrames) && !voice->buffer->looping) voice->ended = true;
+        }
+
+        ma_uint64 framesIn = inputFrames;
+        ma_uint64 framesOutCount = framesToMix;
+        ma_data_converter_process_pcm_frames(&resampler->converter, AUDIO.Mixer.groupFrames, &framesIn, AUDIO.Mixer.voiceFrames, &framesOutCount);
+
+        MixAudioFrames(framesOut + (framesMixed*channels), AUDIO.Mixer.voiceFrames, (ma_uint32)framesOutCount, channels, 1.0f);
+
+        // Avoid infinite loop in case resampler can't produce more frames
+        if (framesOutCount == 0) break;
+
+        framesMixed += (ma_uint32)framesOutCount;
+    }
+}
+
+// Assign voices to resample groups, -1 for voices mixed with their own converter
+// NOTE: Groups keep their sample rates (and resampler state) between mixes while used
+static void UpdateAudioResampleGroups(void)
+{
+    for (int i = 0; i < MAX_AUDIO_RESAMPLE_GROUPS; i++)
+    {
+        // Groups not used on previous mix are released, resampler state of previous voices is discarded
+        if (AUDIO.Mixer.groups[i].voicesCount == 0) AUDIO.Mixer.groups[i].sampleRateIn = 0;
+        AUDIO.Mixer.groups[i].voicesCount = 0;
+    }
+
+    // Voices join existing groups with their sample rates first, so groups in use keep their resampler state
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+    {
+        AudioBuffer *buffer = voice->buffer;
+
+        voice->group = -1;
+
+        // Paused and virtual voices, voices in other formats and voices not requiring resampling are mixed on their own
+        if (voice->paused || voice->isVirtual ||
+            (buffer->converter.config.formatIn != AUDIO_DEVICE_FORMAT) ||
+            (buffer->converter.config.channelsIn != AUDIO_DEVICE_CHANNELS) ||
+            (buffer->converter.config.sampleRateIn == buffer->sampleRateOut))
+        {
+            voice->group = -2;
+            continue;
+        }
+
+        for (int k = 0; k < MAX_AUDIO_RESAMPLE_GROUPS; k++)
+        {
+            if ((AUDIO.Mixer.groups[k].sampleRateIn == buffer->converter.config.sampleRateIn) &&
+                (AUDIO.Mixer.groups[k].sampleRateOut == buffer->sampleRateOut) &&
+                (AUDIO.Mixer.groups[k].bus == buffer->bus))
+            {
+                voice->group = k;
+                AUDIO.Mixer.groups[k].voicesCount++;
+                break;
+            }
+        }
+    }
+
+    // Remaining voices take a group not used on this mix, set up for their sample rates
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+    {
+        if (voice->group != -1) continue;
+
+        AudioBuffer *buffer = voice->buffer;
+
+        for (int k = 0; k < MAX_AUDIO_RESAMPLE_GROUPS; k++)
+        {
+            AudioResampleGroup *group = &AUDIO.Mixer.groups[k];
+
+            if (group->voicesCount == 0)
+            {
+                // NOTE: Linear resampler initialization does not allocate memory
+                ma_data_converter_config config = ma_data_converter_config_init(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_CHANNELS, buffer->converter.config.sampleRateIn, buffer->sampleRateOut);
+
+                if (ma_data_converter_init(&config, &group->converter) != MA_SUCCESS) break;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                group->sampleRateIn = buffer->converter.config.sampleRateIn;
+                group->sampleRateOut = buffer->sampleRateOut;
+                group->bus = buffer->bus;
+
+                // Following voices with same sample rates (and bus) join this group
+                for (AudioVoice *other = voice; other != NULL; other = other->next)
+                {
+                    if ((other->group == -1) &&
+                        (other->buffer->converter.config.sampleRateIn == group->sampleRateIn) &&
+                        (other->buffer->sampleRateOut == group->sampleRateOut) &&
+                        (other->buffer->bus == group->bus))
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        other->group = k;
+                        group->voicesCount++;
                     }
+                }
+
+                break;
+            }
+        }
+    }
+
+    // Voices without group (or no groups available) are mixed with their own converter
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+    {
+        if (voice->group < 0) voice->group = -1;
+    }
+}
+
+// Select voices mixed within budget, remaining voices are virtual
+// NOTE: Voices are mixed by priority and then by level (volume and 3d audio attenuation), inaudible voices are never mixed,
+// only best candidates within budget are kept sorted (budget is limited to MAX_AUDIO_VOICES, playing voices are not)
+static void UpdateAudioVirtualVoices(void)
+{
+    int budget = AUDIO_LOAD_ACQUIRE(AUDIO.Mixer.budget);
+    int voicesMixed = 0;
+    int voicesVirtual = 0;
+
+    AudioVoice *candidates[MAX_AUDIO_VOICES] = { 0 };
+    int candidatesCount = 0;
+
+    // Streams are always mixed, their data is provided on demand and can't be skipped
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+    {
+        if (!voice->paused && (voice->buffer->usage == AUDIO_BUFFER_USAGE_STREAM)) voicesMixed++;
+    }
+
+    int candidatesMax = budget - voicesMixed;
+    if (candidatesMax < 0) candidatesMax = 0;
+
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next)
+    {
+        voice->isVirtual = false;
+
+        if (voice->paused || (voice->buffer->usage == AUDIO_BUFFER_USAGE_STREAM)) continue;
+
+        // Voice level includes 3d audio attenuation, distant emitters become virtual
+        const float *gains = voice->buffer->spatialGains;
+        voice->level = voice->volume*((gains[0] > gains[1])? gains[0] : gains[1]);
+
+        if (voice->level < AUDIO_VOICE_INAUDIBLE_VOLUME)
+        {
+            voice->isVirtual = true;
+            continue;
+        }
+
+        // Insert voice in candidates list sorted by priority and level, last candidate becomes virtual if list is full
+        int k = candidatesCount;
+
+        while ((k > 0) && ((voice->priority > candidates[k - 1]->priority) ||
+               ((voice->priority == candidates[k - 1]->priority) && (voice->level > candidates[k - 1]->level)))) k--;
+
+        if (k >= candidatesMax)
+        {
+            voice->isVirtual = true;
+            continue;
+        }
+
+        if (candidatesCount == candidatesMax)
+        {
+            candidatesCount--;
+            candidates[candidatesCount]->isVirtual = true;
+        }
+
+        for (int i = candidatesCount; i > k; i--) candidates[i] = candidates[i - 1];
+
+        candidates[k] = voice;
+        candidatesCount++;
+    }
+
+    voicesMixed += candidatesCount;
+
+    for (AudioVoice *voice = AUDIO.Mixer.voices; voice != NULL; voice = voice->next) if (voice->isVirtual) voicesVirtual++;
+
+    AUDIO_STORE_RELEASE(AUDIO.Mixer.voicesMixed, voicesMixed);
+    AUDIO_STORE_RELEASE(AUDIO.Mixer.voicesVirtual, voicesVirtual);
+}
+
+// Advance virtual voice cursor without mixing, as if it was mixed at its pitch
+// NOTE: Only static buffers can be virtual, sound data is already available
+static void AdvanceAudioVoice(AudioVoice *voice, ma_uint32 frameCount)
+{
+    AudioBuffer *audioBuffer = voice->buffer;
+
+    if (audioBuffer->sizeInFrames == 0)
+    {
+        voice->ended = true;
+        return;
+    }
+
+    ma_uint64 framesToAdvance = (ma_uint64)frameCount*audioBuffer->converter.config.sampleRateIn/audioBuffer->sampleRateOut;
+    ma_uint64 frameCursorPos = audioBuffer->frameCursorPos + framesToAdvance;
+
+    if (frameCursorPos >= audioBuffer->sizeInFrames)
+    {
+        if (audioBuffer->looping) frameCursorPos %= audioBuffer->sizeInFrames;
+        else
+        {
+            frameCursorPos = 0;
+            voice->ended = true;
+        }
+    }
+
+    audioBuffer->frameCursorPos = (unsigned int)frameCursorPos;
+}
+
+// Compute effect coefficients from parameters (audio thread)
+// NOTE: Parameters are validated here, effects are always stable
+static void SetAudioEffectParams(AudioEffect *effect, float value1, float value2)
+{
+    const float sampleRate = (float)AUDIO_DEVICE_SAMPLE_RATE;
+
+    switch (effect->type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS:
+        {
+            // Biquad filter coefficients (Audio EQ Cookbook, Robert Bristow-Johnson)
+            float frequency = value1;
+            if (frequency < 10.0f) frequency = 10.0f;
+            if (frequency > 0.45f*sampleRate) frequency = 0.45f*sampleRate;
+
+            float q = (value2 > 0.0f)? value2 : 0.7071f;
+
+            float w0 = 2.0f*PI*frequency/sampleRate;
+            float cosw0 = cosf(w0);
+            float alpha = sinf(w0)/(2.0f*q);
+            float a0 = 1.0f + alpha;
+            float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+
+            if (effect->type == AUDIO_EFFECT_LOWPASS) { b0 = (1.0f - cosw0)/2.0f; b1 = 1.0f - cosw0; b2 = b0; }
+            else if (effect->type == AUDIO_EFFECT_HIGHPASS) { b0 = (1.0f + cosw0)/2.0f; b1 = -(1.0f + cosw0); b2 = b0; }
+            else { b0 = alpha; b1 = 0.0f; b2 = -alpha; }
+
+            effect->coeffs[0] = b0/a0;
+            effect->coeffs[1] = b1/a0;
+            effect->coeffs[2] = b2/a0;
+            effect->coeffs[3] = -2.0f*cosw0/a0;
+            effect->coeffs[4] = (1.0f - alpha)/a0;
+        } break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        {
+            // Threshold (linear), gain exponent over threshold, attack (5 ms) and release (100 ms) envelope coefficients
+            float ratio = (value2 > 1.0f)? value2 : 1.0f;
+
+            effect->coeffs[0] = powf(10.0f, value1/20.0f);
+            effect->coeffs[1] = 1.0f/ratio - 1.0f;
+            effect->coeffs[2] = expf(-1.0f/(0.005f*sampleRate));
+            effect->coeffs[3] = expf(-1.0f/(0.1f*sampleRate));
+        } break;
+        case AUDIO_EFFECT_LIMITER:
+        {
+            // Ceiling (linear), attack is instant so peaks never exceed the ceiling
+            float release = (value2 > 0.0f)? value2 : 50.0f;
+
+            effect->coeffs[0] = powf(10.0f, value1/20.0f);
+            effect->coeffs[1] = 0.0f;
+            effect->coeffs[2] = 0.0f;
+            effect->coeffs[3] = expf(-1.0f/(release*0.001f*sampleRate));
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            // Comb filters feedback (room size), wet mix and feedback damping
+            float roomSize = (value1 < 0.0f)? 0.0f : ((value1 > 1.0f)? 1.0f : value1);
+            float wet = (value2 < 0.0f)? 0.0f : ((value2 > 1.0f)? 1.0f : value2);
+
+            effect->coeffs[0] = 0.7f + 0.28f*roomSize;
+            effect->coeffs[1] = wet;
+            effect->coeffs[2] = 0.2f;
+        } break;
+        case AUDIO_EFFECT_DUCKING:
+        {
+            // Sidechain bus, volume while sidechain bus is playing, attack (10 ms) and release (300 ms) coefficients
+            int sidechain = (int)value1;
+            if ((sidechain < 0) || (sidechain >= MAX_AUDIO_BUSES)) sidechain = AUDIO_BUS_VOICE;
+
+            effect->coeffs[0] = (float)sidechain;
+            effect->coeffs[1] = (value2 < 0.0f)? 0.0f : ((value2 > 1.0f)? 1.0f : value2);
+            effect->coeffs[2] = expf(-1.0f/(0.01f*sampleRate));
+            effect->coeffs[3] = expf(-1.0f/(0.3f*sampleRate));
+        } break;
+        default: break;
+    }
+}
+
+// Process bus frames through bus effects chain (audio thread)
+static void ProcessAudioBusEffects(AudioBus *bus, ma_uint32 frameCount)
+{
+    for (int i = 0; i < bus->effectsCount; i++)
+    {
+        AudioEffect *effect = &bus->effects[i];
+
+        switch (effect->type)
+        {
+            case AUDIO_EFFECT_LOWPASS:
+            case AUDIO_EFFECT_HIGHPASS:
+            case AUDIO_EFFECT_BANDPASS: ProcessAudioFilter(effect, bus->frames, frameCount); break;
+            case AUDIO_EFFECT_COMPRESSOR:
+            case AUDIO_EFFECT_LIMITER:
+            case AUDIO_EFFECT_DUCKING: ProcessAudioDynamics(effect, bus->frames, frameCount); break;
+            case AUDIO_EFFECT_REVERB: ProcessAudioReverb(effect, bus->frames, frameCount); break;
+            default: break;
+        }
+    }
+}
+
+// Process biquad filter effect, transposed direct form II
+static void ProcessAudioFilter(AudioEffect *effect, float *frames, ma_uint32 frameCount)
+{
+    const float b0 = effect->coeffs[0], b1 = effect->coeffs[1], b2 = effect->coeffs[2];
+    const float a1 = effect->coeffs[3], a2 = effect->coeffs[4];
+
+    for (int ch = 0; ch < AUDIO_DEVICE_CHANNELS; ch++)
+    {
+        float z1 = effect->state[ch*2];
+        float z2 = effect->state[ch*2 + 1];
+
+        for (ma_uint32 i = 0; i < frameCount; i++)
+        {
+            float x = frames[i*AUDIO_DEVICE_CHANNELS + ch];
+            float y = b0*x + z1;
+
+            z1 = b1*x - a1*y + z2;
+            z2 = b2*x - a2*y;
+            frames[i*AUDIO_DEVICE_CHANNELS + ch] = y;
+        }
+
+        // Avoid denormals when filter input becomes silent
+        effect->state[ch*2] = (fabsf(z1) < 1e-15f)? 0.0f : z1;
+        effect->state[ch*2 + 1] = (fabsf(z2) < 1e-15f)? 0.0f : z2;
+    }
+}
+
+// Process compressor, limiter or ducking effect
+// NOTE: Gain is applied to all channels (stereo-linked), state keeps gain reduction (0.0f means no reduction)
+static void ProcessAudioDynamics(AudioEffect *effect, float *frames, ma_uint32 frameCount)
+{
+    const float attack = effect->coeffs[2];
+    const float release = effect->coeffs[3];
+
+    float envelope = effect->state[0];
+    float gain = 1.0f - effect->state[1];
+
+    // Ducking target gain depends on sidechain bus level, measured for the whole chunk
+    float duckingGain = 1.0f;
+    if ((effect->type == AUDIO_EFFECT_DUCKING) && (AUDIO.Mixer.buses[(int)effect->coeffs[0]].peak > AUDIO_DUCKING_THRESHOLD)) duckingGain = effect->coeffs[1];
+
+    for (ma_uint32 i = 0; i < frameCount; i++)
+    {
+        float *frame = frames + i*AUDIO_DEVICE_CHANNELS;
+        float peak = 0.0f;
+
+        for (int ch = 0; ch < AUDIO_DEVICE_CHANNELS; ch++) if (fabsf(frame[ch]) > peak) peak = fabsf(frame[ch]);
+
+        if (effect->type == AUDIO_EFFECT_COMPRESSOR)
+        {
+            // Peak envelope follower, gain is reduced over threshold depending on ratio
+            if (peak > envelope) envelope = attack*envelope + (1.0f - attack)*peak;
+            else envelope = release*envelope + (1.0f - release)*peak;
+
+            gain = (envelope > effect->coeffs[0])? powf(envelope/effect->coeffs[0], effect->coeffs[1]) : 1.0f;
+        }
+        else if (effect->type == AUDIO_EFFECT_LIMITER)
+        {
+            float target = (peak > effect->coeffs[0])? effect->coeffs[0]/peak : 1.0f;
+
+            if (target < gain) gain = target;
+            else gain = release*gain + (1.0f - release)*target;
+        }
+        else
+        {
+            if (duckingGain < gain) gain = attack*gain + (1.0f - attack)*duckingGain;
+            else gain = release*gain + (1.0f - release)*duckingGain;
+        }
+
+        for (int ch = 0; ch < AUDIO_DEVICE_CHANNELS; ch++) frame[ch] *= gain;
+    }
+
+    effect->state[0] = envelope;
+    effect->state[1] = 1.0f - gain;
+}
+
+// Process reverb effect, parallel comb filters followed by allpass filters for every channel (Freeverb)
+// NOTE: Channels use slightly different delay lines length for stereo width
+static void ProcessAudioReverb(AudioEffect *effect, float *frames, ma_uint32 frameCount)
+{
+    AudioReverb *reverb = effect->reverb;
+
+    const float feedback = effect->coeffs[0];
+    const float wet = effect->coeffs[1];
+    const float damping = effect->coeffs[2];
+
+    for (int ch = 0; ch < AUDIO_DEVICE_CHANNELS; ch++)
+    {
+        for (ma_uint32 i = 0; i < frameCount; i++)
+        {
+            float input = frames[i*AUDIO_DEVICE_CHANNELS + ch]*0.03f;
+            float output = 0.0f;
+
+            for (int k = 0; k < AUDIO_REVERB_COMBS; k++)
+            {
+                int index = reverb->combIndex[ch][k];
+                float delayed = reverb->comb[ch][k][index];
+
+                reverb->combDamping[ch][k] = delayed*(1.0f - damping) + reverb->combDamping[ch][k]*damping;
+                reverb->comb[ch][k][index] = input + reverb->combDamping[ch][k]*feedback;
+
+                if (++index >= (reverbCombDelays[k] + ch*AUDIO_REVERB_STEREO_SPREAD)) index = 0;
+                reverb->combIndex[ch][k] = index;
+
+                output += delayed;
+            }
+
+            for (int k = 0; k < AUDIO_REVERB_ALLPASSES; k++)
+            {
+                int index = reverb->allpassIndex[ch][k];
+                float delayed = reverb->allpass[ch][k][index];
+
+                reverb->allpass[ch][k][index] = output + delayed*0.5f;
+                output = delayed - output;
+
+                if (++index >= (reverbAllpassDelays[k] + ch*AUDIO_REVERB_STEREO_SPREAD)) index = 0;
+                reverb->allpassIndex[ch][k] = index;
+            }
+
+            frames[i*AUDIO_DEVICE_CHANNELS + ch] = frames[i*AUDIO_DEVICE_CHANNELS + ch]*(1.0f - wet) + output*wet*3.0f;
+        }
+
+        // Avoid denormals on reverb tail end
+        for (int k = 0; k < AUDIO_REVERB_COMBS; k++) if (fabsf(reverb->combDamping[ch][k]) < 1e-15f) reverb->combDamping[ch][k] = 0.0f;
+    }
+}
+
+// Clear buses effects chains and free reverbs memory
+// NOTE: Only called when mixer is not running anymore
+static void CloseAudioBuses(void)
+{
+    for (int b = 0; b < MAX_AUDIO_BUSES; b++)
+    {
+        AUDIO.Mixer.buses[b].effectsCount = 0;
+        AUDIO.Bus.effectsCount[b] = 0;
+
+        for (int i = 0; i < MAX_AUDIO_BUS_EFFECTS; i++)
+        {
+            RL_FREE(AUDIO.Bus.reverbs[b][i]);
+            AUDIO.Bus.reverbs[b][i] = NULL;
+        }
+    }
+}
+
+// Get audio time for 3d audio velocities (seconds)
+// NOTE: Offline rendering uses audio time rendered, keeping doppler effect deterministic
+static double GetAudioTime(void)
+{
+    if (AUDIO.System.isOffline) return (double)AUDIO.System.framesRendered/AUDIO_DEVICE_SAMPLE_RATE;
+
+    return ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer);
+}
+
+// Compute emitter channels gains and doppler factor from listener (game thread)
+static void GetAudioSpatialParams(AudioBuffer *buffer, float *gains, float *doppler)
+{
+    Camera3D listener = AUDIO.Spatial.listener;
+
+    Vector3 direction = { buffer->position.x - listener.position.x, buffer->position.y - listener.position.y, buffer->position.z - listener.position.z };
+    float distance = sqrtf(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
+
+    // Distance attenuation, distance clamped to attenuation range
+    float clampedDistance = distance;
+    if (clampedDistance < AUDIO.Spatial.minDistance) clampedDistance = AUDIO.Spatial.minDistance;
+    if (clampedDistance > AUDIO.Spatial.maxDistance) clampedDistance = AUDIO.Spatial.maxDistance;
+
+    float attenuation = 1.0f;
+
+    switch (AUDIO.Spatial.model)
+    {
+        case AUDIO_ATTENUATION_LINEAR:
+        {
+            float range = AUDIO.Spatial.maxDistance - AUDIO.Spatial.minDistance;
+            if (range > 0.0f) attenuation = 1.0f - AUDIO.Spatial.rolloff*(clampedDistance - AUDIO.Spatial.minDistance)/range;
+            if (attenuation < 0.0f) attenuation = 0.0f;
+        } break;
+        case AUDIO_ATTENUATION_INVERSE: attenuation = AUDIO.Spatial.minDistance/(AUDIO.Spatial.minDistance + AUDIO.Spatial.rolloff*(clampedDistance - AUDIO.Spatial.minDistance)); break;
+        case AUDIO_ATTENUATION_EXPONENTIAL: attenuation = powf(clampedDistance/AUDIO.Spatial.minDistance, -AUDIO.Spatial.rolloff); break;
+        default: break;
+    }
+
+    *doppler = 1.0f;
+    float pan = 0.0f;
+
+    if (distance > 0.0001f)
+    {
+        direction.x /= distance;
+        direction.y /= distance;
+        direction.z /= distance;
+
+        // Listener right axis: cross product of forward and up axis
+        Vector3 forward = { listener.target.x - listener.position.x, listener.target.y - listener.position.y, listener.target.z - listener.position.z };
+        Vector3 right = { forward.y*listener.up.z - forward.z*listener.up.y, forward.z*listener.up.x - forward.x*listener.up.z, forward.x*listener.up.y - forward.y*listener.up.x };
+        float length = sqrtf(right.x*right.x + right.y*right.y + right.z*right.z);
+
+        if (length > 0.0001f) pan = (direction.x*right.x + direction.y*right.y + direction.z*right.z)/length;
+
+        // Doppler effect, listener and emitter speeds along the line between them
+        if (AUDIO.Spatial.dopplerFactor > 0.0f)
+        {
+            Vector3 velocity = AUDIO.Spatial.velocity;
+            float listenerSpeed = (velocity.x*direction.x + velocity.y*direction.y + velocity.z*direction.z)*AUDIO.Spatial.dopplerFactor;
+            float emitterSpeed = (buffer->velocity.x*direction.x + buffer->velocity.y*direction.y + buffer->velocity.z*direction.z)*AUDIO.Spatial.dopplerFactor;
+
+            *doppler = (AUDIO_SPEED_OF_SOUND + listenerSpeed)/(AUDIO_SPEED_OF_SOUND + emitterSpeed);
+
+            // Factor is limited, also avoids speeds over the speed of sound
+            if (!(*doppler >= 1.0f/AUDIO_DOPPLER_MAX_SHIFT)) *doppler = 1.0f/AUDIO_DOPPLER_MAX_SHIFT;
+            else if (*doppler > AUDIO_DOPPLER_MAX_SHIFT) *doppler = AUDIO_DOPPLER_MAX_SHIFT;
+        }
+    }
+
+    // Constant power panning, centered emitters keep full volume on both channels
+    float angle = (pan + 1.0f)*PI/4.0f;
+    gains[0] = attenuation*fminf(1.0f, sqrtf(2.0f)*cosf(angle));
+    gains[1] = attenuation*fminf(1.0f, sqrtf(2.0f)*sinf(angle));
+}
+
+// Send emitter 3d audio parameters to mixer (game thread)
+static void PushAudioSpatialParams(AudioBuffer *buffer)
+{
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_SPATIAL;
+    command.buffer = buffer;
+
+    GetAudioSpatialParams(buffer, command.values, &command.value);
+    QueueAudioCommand(command);
+}
+
+// Apply emitter 3d audio parameters (audio thread)
+static void SetAudioBufferSpatial(AudioBuffer *buffer, const float *gains, float doppler)
+{
+    buffer->spatialGains[0] = gains[0];
+    buffer->spatialGains[1] = gains[1];
+    buffer->doppler = doppler;
+
+    UpdateAudioBufferRate(buffer);
+}
+
+// Set converter output sample rate from pitch and doppler (audio thread)
+// NOTE: Doppler effect goes through the pitch path, emitter pitch is kept
+static void UpdateAudioBufferRate(AudioBuffer *buffer)
+{
+    ma_uint32 sampleRateOut = (ma_uint32)((float)buffer->pitchSampleRate/buffer->doppler);
+
+    if (sampleRateOut != buffer->sampleRateOut)
+    {
+        buffer->sampleRateOut = sampleRateOut;
+        ma_data_converter_set_rate(&buffer->converter, buffer->converter.config.sampleRateIn, buffer->sampleRateOut);
+    }
+}
+
+// Initialise the multichannel buffer pool
+static void InitAudioBufferPool(void)
+{
+    // Dummy buffers
+    // NOTE: Pool buffers don't own any data, they play the data of the sound requested
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AUDIO.MultiChannel.pool[i] = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, 0, AUDIO_BUFFER_USAGE_STATIC);
+        RL_FREE(AUDIO.MultiChannel.pool[i]->data);
+        AUDIO.MultiChannel.pool[i]->data = NULL;
+        AUDIO.MultiChannel.pool[i]->poolIndex = i;
+
+        // Channels are taken from the top of the stack, first channels are used first
+        AUDIO.MultiChannel.freeChannels[i] = MAX_AUDIO_BUFFER_POOL_CHANNELS - 1 - i;
+        AUDIO.MultiChannel.isChannelFree[i] = true;
+        AUDIO.MultiChannel.channels[i] = 0;
+    }
+
+    AUDIO.MultiChannel.freeCount = MAX_AUDIO_BUFFER_POOL_CHANNELS;
+    AUDIO.MultiChannel.poolCounter = 0;
+    AUDIO.MultiChannel.releasedWriteIndex = 0;
+    AUDIO.MultiChannel.releasedReadIndex = 0;
+}
+
+// Close the audio buffers pool
+static void CloseAudioBufferPool(void)
+{
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        UntrackAudioBuffer(AUDIO.MultiChannel.pool[i]);
+        ma_data_converter_uninit(&AUDIO.MultiChannel.pool[i]->converter);
+        RL_FREE(AUDIO.MultiChannel.pool[i]);
+    }
+}
+
+// Recover multichannel pool channels released by mixer (game thread)
+// NOTE: Releases of channels played again since then (stolen channels) are ignored
+static void UpdateAudioBufferPool(void)
+{
+    unsigned int readIndex = AUDIO.MultiChannel.releasedReadIndex;
+    unsigned int writeIndex = AUDIO_LOAD_ACQUIRE(AUDIO.MultiChannel.releasedWriteIndex);
+
+    while (readIndex != writeIndex)
+    {
+        AudioChannelRelease release = AUDIO.MultiChannel.released[readIndex%MAX_AUDIO_CHANNEL_RELEASES];
+
+        if (!AUDIO.MultiChannel.isChannelFree[release.channel] && (release.sequence == AUDIO.MultiChannel.pool[release.channel]->playSequence))
+        {
+            AUDIO.MultiChannel.freeChannels[AUDIO.MultiChannel.freeCount] = release.channel;
+            AUDIO.MultiChannel.freeCount++;
+            AUDIO.MultiChannel.isChannelFree[release.channel] = true;
+        }
+
+        readIndex++;
+    }
+
+    AUDIO_STORE_RELEASE(AUDIO.MultiChannel.releasedReadIndex, readIndex);
+}
+
+// Release multichannel pool channel to game thread (audio thread)
+// NOTE: If releases queue is full, channel is recovered when all channels are in use
+static void ReleaseAudioPoolChannel(AudioBuffer *buffer, unsigned int sequence)
+{
+    unsigned int writeIndex = AUDIO.MultiChannel.releasedWriteIndex;
+
+    if ((writeIndex - AUDIO_LOAD_ACQUIRE(AUDIO.MultiChannel.releasedReadIndex)) < MAX_AUDIO_CHANNEL_RELEASES)
+    {
+        AudioChannelRelease release = { buffer->poolIndex, sequence };
+
+        AUDIO.MultiChannel.released[writeIndex%MAX_AUDIO_CHANNEL_RELEASES] = release;
+        AUDIO_STORE_RELEASE(AUDIO.MultiChannel.releasedWriteIndex, writeIndex + 1);
+    }
+}
+
+// Send command to mixer (game thread)
+// NOTE: Commands queue is single producer (game thread) and single consumer (mixer),
+// commands are never discarded, pushing waits for the mixer only if queue is full
+static void PushAudioCommand(int type, AudioBuffer *buffer, AudioBuffer *source, float value)
+{
+    AudioCommand command = { 0 };
+    command.type = type;
+    command.buffer = buffer;
+    command.source = source;
+    command.value = value;
+    command.priority = buffer->priority;
+    command.sequence = buffer->playSequence;
+
+    QueueAudioCommand(command);
+}
+
+// Push command to commands queue (game thread)
+// NOTE: Also used by bus commands, not targeting any audio buffer
+// NOTE: Lifecycle commands (play, stop, unload) can not be lost, if queue is full
+// game thread waits for the mixer to free space, offline mixer is only run by
+// RenderAudioFrames() on game thread, so pending commands are applied directly
+static void QueueAudioCommand(AudioCommand command)
+{
+    // No mixer running, command can be applied directly
+    if (!AUDIO.System.isReady)
+    {
+        ApplyAudioCommand(command);
+        return;
+    }
+
+    unsigned int writeIndex = AUDIO.Command.writeIndex;
+
+    while ((writeIndex - AUDIO_LOAD_ACQUIRE(AUDIO.Command.readIndex)) >= MAX_AUDIO_COMMANDS)
+    {
+        if (AUDIO.System.isOffline || !ma_device_is_started(&AUDIO.System.device)) ProcessAudioCommands();
+        else ma_sleep(1);
+    }
+
+    AUDIO.Command.queue[writeIndex%MAX_AUDIO_COMMANDS] = command;
+    AUDIO_STORE_RELEASE(AUDIO.Command.writeIndex, writeIndex + 1);
+}
+
+// Apply pending commands to mixer voices (audio thread)
+static void ProcessAudioCommands(void)
+{
+    unsigned int readIndex = AUDIO.Command.readIndex;
+    unsigned int writeIndex = AUDIO_LOAD_ACQUIRE(AUDIO.Command.writeIndex);
+
+    while (readIndex != writeIndex)
+    {
+        ApplyAudioCommand(AUDIO.Command.queue[readIndex%MAX_AUDIO_COMMANDS]);
+        readIndex++;
+    }
+
+    // Queue slots and unloaded buffers are released once commands are applied
+    AUDIO_STORE_RELEASE(AUDIO.Command.readIndex, readIndex);
+}
+
+// Apply one command to mixer voices
+// NOTE: Only called by mixer, or by game thread when mixer is not running
+static void ApplyAudioCommand(AudioCommand command)
+{
+    AudioBuffer *buffer = command.buffer;
+    AudioVoice *voice = ((buffer != NULL) && buffer->voice.isActive)? &buffer->voice : NULL;
+
+    switch (command.type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            if (voice == NULL)
+            {
+                // Buffer voice is linked at the start of voices list, playing voices are not limited
+                voice = &buffer->voice;
+                voice->isActive = true;
+                voice->prev = NULL;
+                voice->next = AUDIO.Mixer.voices;
+                if (AUDIO.Mixer.voices != NULL) AUDIO.Mixer.voices->prev = voice;
+                AUDIO.Mixer.voices = voice;
+            }
+
+            // Multichannel pool buffers play data from source sound
+            if (command.source != NULL)
+            {
+                buffer->source = command.source;
+                buffer->bus = command.source->bus;
+                buffer->looping = command.source->looping;
+                buffer->usage = command.source->usage;
+                buffer->sizeInFrames = command.source->sizeInFrames;
+                buffer->data = command.source->data;
+
+                // Sounds can be stored in any format, converter is set up for source sound data
+                // NOTE: Data converter initialization does not allocate memory (linear resampler)
+                if ((buffer->converter.config.formatIn != command.source->converter.config.formatIn) ||
+                    (buffer->converter.config.channelsIn != command.source->converter.config.channelsIn) ||
+                    (buffer->converter.config.sampleRateIn != command.source->converter.config.sampleRateIn))
+                {
+                    ma_data_converter_config config = ma_data_converter_config_init(command.source->converter.config.formatIn, AUDIO_DEVICE_FORMAT,
+                        command.source->converter.config.channelsIn, AUDIO_DEVICE_CHANNELS, command.source->converter.config.sampleRateIn, AUDIO_DEVICE_SAMPLE_RATE);
+                    config.resampling.allowDynamicSampleRate = true;
+
+                    ma_data_converter_init(&config, &buffer->converter);
+                    buffer->sampleRateOut = AUDIO_DEVICE_SAMPLE_RATE;
+                }
+
+                buffer->pitchSampleRate = command.source->pitchSampleRate;
+                SetAudioBufferSpatial(buffer, command.source->spatialGains, command.source->doppler);
+
+                AUDIO_STORE_RELEASE(buffer->isSubBufferProcessed[0], false);
+                AUDIO_STORE_RELEASE(buffer->isSubBufferProcessed[1], false);
+            }
+
+            // NOTE: Streams keep their cursor position, it's reset on stop or when fully processed
+            if (buffer->usage == AUDIO_BUFFER_USAGE_STATIC) buffer->frameCursorPos = 0;
+
+            voice->sequence = command.sequence;
+            voice->volume = command.value;
+            voice->priority = command.priority;
+            voice->paused = false;
+            voice->ended = false;
+            voice->isVirtual = false;
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            if (voice != NULL) RemoveAudioVoice(voice);
+
+            buffer->frameCursorPos = 0;
+            AUDIO_STORE_RELEASE(buffer->isSubBufferProcessed[0], true);
+            AUDIO_STORE_RELEASE(buffer->isSubBufferProcessed[1], true);
+        } break;
+        case AUDIO_COMMAND_PAUSE: if (voice != NULL) voice->paused = true; break;
+        case AUDIO_COMMAND_RESUME: if (voice != NULL) voice->paused = false; break;
+        case AUDIO_COMMAND_VOLUME: if (voice != NULL) voice->volume = command.value; break;
+        case AUDIO_COMMAND_PRIORITY: if (voice != NULL) voice->priority = command.priority; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            buffer->pitchSampleRate = (ma_uint32)command.value;
+            UpdateAudioBufferRate(buffer);
+        } break;
+        case AUDIO_COMMAND_UNLOAD:
+        {
+            // Remove buffer voice and multichannel pool voices playing buffer data
+            for (AudioVoice *poolVoice = AUDIO.Mixer.voices, *next = NULL; poolVoice != NULL; poolVoice = next)
+            {
+                next = poolVoice->next;
+
+                if ((poolVoice->buffer == buffer) || (poolVoice->buffer->source == buffer) || ((buffer->data != NULL) && (poolVoice->buffer->data == buffer->data)))
+                {
+                    AUDIO_STORE_RELEASE(poolVoice->buffer->endSequence, poolVoice->sequence);
+                    RemoveAudioVoice(poolVoice);
+                }
+            }
+        } break;
+        case AUDIO_COMMAND_BUS: buffer->bus = (int)command.value; break;
+        case AUDIO_COMMAND_BUS_VOLUME: AUDIO.Mixer.buses[command.bus].volume = command.value; break;
+        case AUDIO_COMMAND_BUS_EFFECT:
+        {
+            AudioBus *bus = &AUDIO.Mixer.buses[command.bus];
+            AudioEffect *effect = &bus->effects[command.effect];
+
+            // New effects start from a clean state, parameters changes keep it
+            if (command.effect >= bus->effectsCount)
+            {
+                *effect = (AudioEffect){ 0 };
+                effect->type = command.effectType;
+
+                if (effect->type == AUDIO_EFFECT_REVERB)
+                {
+                    effect->reverb = AUDIO.Bus.reverbs[command.bus][command.effect];
+                    memset(effect->reverb, 0, sizeof(AudioReverb));
+                }
+
+                bus->effectsCount = command.effect + 1;
+            }
+
+            SetAudioEffectParams(effect, command.values[0], command.values[1]);
+        } break;
+        case AUDIO_COMMAND_BUS_CLEAR: AUDIO.Mixer.buses[command.bus].effectsCount = 0; break;
+        case AUDIO_COMMAND_SPATIAL:
+        {
+            SetAudioBufferSpatial(buffer, command.values, command.value);
+
+            // Multichannel pool voices follow their sound 3d audio parameters
+            for (AudioVoice *poolVoice = AUDIO.Mixer.voices; poolVoice != NULL; poolVoice = poolVoice->next)
+            {
+                if (poolVoice->buffer->source == buffer) SetAudioBufferSpatial(poolVoice->buffer, command.values, command.value);
+            }
+        } break;
+        case AUDIO_COMMAND_SPATIAL_BATCH:
+        {
+            int batch = (int)command.value;
+
+            for (int i = 0; i < AUDIO.Spatial.batchCount[batch]; i++)
+            {
+                AudioSpatialParams *params = &AUDIO.Spatial.batches[batch][i];
+                SetAudioBufferSpatial(params->buffer, params->gains, params->doppler);
+            }
+
+            // Multichannel pool voices follow their sound 3d audio parameters
+            for (AudioVoice *poolVoice = AUDIO.Mixer.voices; poolVoice != NULL; poolVoice = poolVoice->next)
+            {
+                AudioBuffer *poolBuffer = poolVoice->buffer;
+                if (poolBuffer->source != NULL) SetAudioBufferSpatial(poolBuffer, poolBuffer->source->spatialGains, poolBuffer->source->doppler);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Remove voice from mixer voices list
+static void RemoveAudioVoice(AudioVoice *voice)
+{
+    // Multichannel pool channels are available again for new sounds
+    if (voice->buffer->poolIndex >= 0) ReleaseAudioPoolChannel(voice->buffer, voice->sequence);
+
+    if (voice->prev != NULL) voice->prev->next = voice->next;
+    else AUDIO.Mixer.voices = voice->next;
+    if (voice->next != NULL) voice->next->prev = voice->prev;
+
+    voice->next = NULL;
+    voice->prev = NULL;
+    voice->isActive = false;
+}
+
+// Free unloaded audio buffers already released by mixer
+static void FreeUnloadedAudioBuffers(void)
+{
+    unsigned int readIndex = AUDIO_LOAD_ACQUIRE(AUDIO.Command.readIndex);
+    AudioBuffer **link = &AUDIO.Buffer.unloaded;
+
+    while (*link != NULL)
+    {
+        AudioBuffer *buffer = *link;
+
+        // Check unload command has been applied (wrapping safe comparison)
+        if ((int)(readIndex - buffer->unloadSequence) >= 0)
+        {
+            *link = buffer->next;
+
+            ma_data_converter_uninit(&buffer->converter);
+            RL_FREE(buffer->data);
+            RL_FREE(buffer);
+        }
+        else link = &buffer->next;
+    }
+
+    // Free sounds cache decoded data released (not played again since release request)
+    CompressedSound *sound = AUDIO.Storage.first;
+
+    while (sound != NULL)
+    {
+        CompressedSound *next = sound->next;
+
+        if (sound->isReleasing && ((int)(readIndex - sound->releaseSequence) >= 0))
+        {
+            UntrackCompressedSound(sound);
+
+            RL_FREE(sound->buffer->data);
+            sound->buffer->data = NULL;
+            sound->isReleasing = false;
+        }
+
+        sound = next;
+    }
+}
+
+// Get compressed sound file type (MUSIC_AUDIO_OGG, MUSIC_AUDIO_FLAC), -1 if it can not be kept compressed
+static int GetCompressedSoundType(const char *fileName)
+{
+    int ctxType = -1;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg")) ctxType = MUSIC_AUDIO_OGG;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileExtension(fileName, ".flac")) ctxType = MUSIC_AUDIO_FLAC;
+#endif
+
+    return ctxType;
+}
+
+// Load sound keeping compressed file data (OGG, FLAC), decoded into sounds cache when played
+// NOTE: Returns an empty sound if file type can not be kept compressed
+static Sound LoadCompressedSound(const char *fileName)
+{
+    Sound sound = { 0 };
+    int ctxType = GetCompressedSoundType(fileName);
+
+    if (ctxType == -1) return sound;
+
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+
+    if (fileData != NULL) sound = LoadCompressedSoundFromMemory(fileName, ctxType, fileData, fileDataSize);
+
+    return sound;
+}
+
+// Load sound keeping compressed file data loaded from fileName
+// NOTE: File data is owned by sound (freed if sound can not be loaded)
+static Sound LoadCompressedSoundFromMemory(const char *fileName, int ctxType, unsigned char *fileData, int fileDataSize)
+{
+    Sound sound = { 0 };
+
+    // Only stream information is read on loading, data is decoded when played
+    unsigned int channels = 0;
+    unsigned int sampleRate = 0;
+    unsigned int frameCount = 0;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (ctxType == MUSIC_AUDIO_OGG)
+    {
+        stb_vorbis *ctxOgg = stb_vorbis_open_memory(fileData, fileDataSize, NULL, NULL);
+
+        if (ctxOgg != NULL)
+        {
+            stb_vorbis_info info = stb_vorbis_get_info(ctxOgg);
+
+            channels = info.channels;
+            sampleRate = info.sample_rate;
+            frameCount = stb_vorbis_stream_length_in_samples(ctxOgg);
+
+            stb_vorbis_close(ctxOgg);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (ctxType == MUSIC_AUDIO_FLAC)
+    {
+        drflac *ctxFlac = drflac_open_memory(fileData, fileDataSize);
+
+        if (ctxFlac != NULL)
+        {
+            channels = ctxFlac->channels;
+            sampleRate = ctxFlac->sampleRate;
+            frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
+
+            drflac_close(ctxFlac);
+        }
+    }
+#endif
+
+    AudioBuffer *audioBuffer = NULL;
+    CompressedSound *compressed = NULL;
+
+    if ((frameCount > 0) && (channels > 0) && (channels <= 2))
+    {
+        audioBuffer = LoadAudioBuffer(ma_format_s16, channels, sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        compressed = (CompressedSound *)RL_CALLOC(1, sizeof(CompressedSound));
+    }
+
+    if ((audioBuffer == NULL) || (compressed == NULL))
+    {
+        TRACELOG(LOG_WARNING, "[%s] Sound file data could not be kept compressed", fileName);
+
+        if (audioBuffer != NULL) UnloadAudioBuffer(audioBuffer);
+        RL_FREE(compressed);
+        RL_FREE(fileData);
+
+        return sound;
+    }
+
+    // NOTE: Buffer data is the decoded data, only available while sound is in sounds cache
+    RL_FREE(audioBuffer->data);
+    audioBuffer->data = NULL;
+    audioBuffer->sizeInFrames = frameCount;
+    audioBuffer->compressed = compressed;
+
+    compressed->buffer = audioBuffer;
+    compressed->fileData = fileData;
+    compressed->fileDataSize = fileDataSize;
+    compressed->ctxType = ctxType;
+
+    sound.sampleCount = frameCount*channels;
+    sound.stream.sampleRate = sampleRate;
+    sound.stream.sampleSize = 16;
+    sound.stream.channels = channels;
+    sound.stream.buffer = audioBuffer;
+
+    TRACELOG(LOG_INFO, "[%s] Sound file data kept compressed (%i Hz, %i bit, %s)", fileName, sampleRate, 16, (channels == 1)? "Mono" : "Stereo");
+
+    return sound;
+}
+
+// Decode compressed sound into sounds cache (if not cached) and set it as most recently played
+// NOTE: Least recently played sounds not playing are released while cache is over MAX_SOUND_CACHE_SIZE,
+// their decoded data is freed once the mixer applies the release request (it could still be mixing it)
+static bool CacheCompressedSound(CompressedSound *sound)
+{
+    AudioBuffer *buffer = sound->buffer;
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn  = tempBuffer;
+    FreeUnloadedAudioBuffers();
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer->volume);
+    if (buffer->data == NULL)
+    {
+        ma_uint32 channels = buffer->converter.config.channelsIn;
+        unsigned char *data = (unsigned char *)RL_MALLOC(buffer->sizeInFrames*channels*sizeof(short));
+        unsigned int framesDecoded = 0;
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+        if (data == NULL) return false;
 
-                    if (!audioBuffer->playing)
-                    {
-                        framesRead = frameCount;
-                        break;
-                    }
+        switch (sound->ctxType)
+        {
+        #if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG:
+            {
+                stb_vorbis *ctxOgg = stb_vorbis_open_memory(sound->fileData, sound->fileDataSize, NULL, NULL);
 
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBuffer(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
-                    }
+                if (ctxOgg != NULL)
+                {
+                    // NOTE: Returns the number of samples per channel decoded
+                    framesDecoded = stb_vorbis_get_samples_short_interleaved(ctxOgg, channels, (short *)data, buffer->sizeInFrames*channels);
+                    stb_vorbis_close(ctxOgg);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC:
+            {
+                drflac *ctxFlac = drflac_open_memory(sound->fileData, sound->fileDataSize);
+
+                if (ctxFlac != NULL)
+                {
+                    framesDecoded = (unsigned int)drflac_read_pcm_frames_s16(ctxFlac, buffer->sizeInFrames, (short *)data);
+                    drflac_close(ctxFlac);
                 }
+            } break;
+        #endif
+            default: break;
+        }
 
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
-            }
+        if (framesDecoded == 0)
+        {
+            TRACELOG(LOG_WARNING, "Compressed sound data could not be decoded");
+            RL_FREE(data);
+            return false;
         }
+
+        // Frames not decoded (truncated stream) are played as silence
+        if (framesDecoded < buffer->sizeInFrames) memset(data + framesDecoded*channels*sizeof(short), 0, (buffer->sizeInFrames - framesDecoded)*channels*sizeof(short));
+
+        // NOTE: Decoded data is published to the mixer by the play command
+        buffer->data = data;
+    }
+    else UntrackCompressedSound(sound);
+
+    // Played again before the release was applied, decoded data is kept
+    sound->isReleasing = false;
+
+    // Track compressed sound as most recently played
+    sound->prev = AUDIO.Storage.last;
+    sound->next = NULL;
+
+    if (AUDIO.Storage.last == NULL) AUDIO.Storage.first = sound;
+    else AUDIO.Storage.last->next = sound;
+
+    AUDIO.Storage.last = sound;
+
+    // Get decoded data kept in cache, not counting sounds already being released
+    unsigned int cacheSize = 0;
+
+    for (CompressedSound *cached = AUDIO.Storage.first; cached != NULL; cached = cached->next)
+    {
+        if (!cached->isReleasing) cacheSize += cached->buffer->sizeInFrames*ma_get_bytes_per_frame(ma_format_s16, cached->buffer->converter.config.channelsIn);
+    }
+
+    // Release least recently played sounds, the unload command removes any voice still mixing their data
+    for (CompressedSound *cached = AUDIO.Storage.first; (cached != sound) && (cacheSize > MAX_SOUND_CACHE_SIZE); cached = cached->next)
+    {
+        if (cached->isReleasing || IsCompressedSoundPlaying(cached)) continue;
+
+        PushAudioCommand(AUDIO_COMMAND_UNLOAD, cached->buffer, NULL, 0.0f);
+
+        cached->isReleasing = true;
+        cached->releaseSequence = AUDIO.Command.writeIndex;
+        cacheSize -= cached->buffer->sizeInFrames*ma_get_bytes_per_frame(ma_format_s16, cached->buffer->converter.config.channelsIn);
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    return true;
 }
 
-// This is the main mixing function. Mixing is pretty simple in this project - it's just an accumulation.
-// NOTE: framesOut is both an input and an output. It will be initially filled with zeros outside of this function.
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume)
+// Check if compressed sound decoded data is being played (paused included), by the sound or by multichannel pool channels
+static bool IsCompressedSoundPlaying(CompressedSound *sound)
+{
+    return IsAudioBufferActive(sound->buffer);
+}
+
+// Check if audio buffer is being played (paused included), by itself or by multichannel pool channels
+static bool IsAudioBufferActive(AudioBuffer *buffer)
+{
+    if (buffer->playing && (AUDIO_LOAD_ACQUIRE(buffer->endSequence) != buffer->playSequence)) return true;
+
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioBuffer *channel = AUDIO.MultiChannel.pool[i];
+
+        if ((channel != NULL) && (AUDIO.MultiChannel.sources[i] == buffer) && channel->playing && (AUDIO_LOAD_ACQUIRE(channel->endSequence) != channel->playSequence)) return true;
+    }
+
+    return false;
+}
+
+// Remove compressed sound from sounds cache list
+static void UntrackCompressedSound(CompressedSound *sound)
+{
+    if (sound->prev == NULL) AUDIO.Storage.first = sound->next;
+    else sound->prev->next = sound->next;
+
+    if (sound->next == NULL) AUDIO.Storage.last = sound->prev;
+    else sound->next->prev = sound->prev;
+
+    sound->prev = NULL;
+    sound->next = NULL;
+}
+
+#if !defined(RAUDIO_STANDALONE)
+// Load sound asset wave or compressed file data (loader thread)
+// NOTE: For SOUND_STORAGE_DEVICE, wave is converted to device format here, so the audio buffer is just copied on main thread
+static bool DecodeSoundAsset(void *asset, const char *fileName)
 {
-    for (ma_uint32 iFrame = 0; iFrame < frameCount; ++iFrame)
+    SoundAsset *data = (SoundAsset *)asset;
+
+    data->ctxType = (data->mode == SOUND_STORAGE_COMPRESSED)? GetCompressedSoundType(fileName) : -1;
+
+    if (data->ctxType != -1)
+    {
+        data->fileData = LoadFileData(fileName, &data->fileDataSize);
+
+        return (data->fileData != NULL);
+    }
+
+    Wave wave = LoadWave(fileName);
+
+    if ((wave.data != NULL) && (data->mode == SOUND_STORAGE_DEVICE))
     {
-        for (ma_uint32 iChannel = 0; iChannel < AUDIO.System.device.playback.channels; ++iChannel)
+        ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+        ma_uint32 frameCountIn = wave.sampleCount/wave.channels;
+
+        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+
+        if (frameCount > 0)
         {
-            float *frameOut = framesOut + (iFrame*AUDIO.System.device.playback.channels);
-            const float *frameIn  = framesIn  + (iFrame*AUDIO.System.device.playback.channels);
+            float *frames = (float *)RL_MALLOC(frameCount*AUDIO_DEVICE_CHANNELS*sizeof(float));
+            frameCount = (ma_uint32)ma_convert_frames(frames, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+
+            RL_FREE(wave.data);
 
-            frameOut[iChannel] += (frameIn[iChannel]*localVolume);
+            wave.data = frames;
+            wave.sampleCount = frameCount*AUDIO_DEVICE_CHANNELS;
+            wave.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+            wave.sampleSize = 32;
+            wave.channels = AUDIO_DEVICE_CHANNELS;
         }
     }
+
+    data->wave = wave;
+
+    return (wave.data != NULL);
 }
 
-// Initialise the multichannel buffer pool
-static void InitAudioBufferPool(void)
+// Load sound asset audio buffer (main thread)
+// NOTE: Like LoadSound(), file is loaded as wave if it can not be kept compressed
+static bool FinalizeSoundAsset(void *asset, const char *fileName)
 {
-    // Dummy buffers
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    SoundAsset *data = (SoundAsset *)asset;
+
+    if (data->fileData != NULL)
     {
-        AUDIO.MultiChannel.pool[i] = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, 0, AUDIO_BUFFER_USAGE_STATIC);
+        data->sound = LoadCompressedSoundFromMemory(fileName, data->ctxType, data->fileData, data->fileDataSize);
+        data->fileData = NULL;
+
+        if (data->sound.stream.buffer == NULL) data->wave = LoadWave(fileName);
+    }
+
+    if (data->sound.stream.buffer == NULL)
+    {
+        data->sound = LoadSoundFromWave(data->wave);
+
+        UnloadWave(data->wave);
+        data->wave = (Wave){ 0 };
     }
+
+    return (data->sound.stream.buffer != NULL);
 }
 
-// Close the audio buffers pool
-static void CloseAudioBufferPool(void)
+// Unload sound asset not retrieved, it could be decoded but not loaded yet
+static void UnloadSoundAsset(void *asset)
 {
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    SoundAsset *data = (SoundAsset *)asset;
+
+    RL_FREE(data->fileData);
+    if (data->wave.data != NULL) UnloadWave(data->wave);
+    if (data->sound.stream.buffer != NULL) UnloadSound(data->sound);
+}
+#endif
+
+// Decode music samples, returns samples consumed from music samples count
+// NOTE: Samples not decoded (end of data) are filled with silence
+static int ReadMusicStreamSamples(Music music, void *pcm, int samplesCount)
+{
+    int samplesConsumed = samplesCount;
+    int samplesDecoded = samplesCount;
+
+    switch (music.ctxType)
     {
-        RL_FREE(AUDIO.MultiChannel.pool[i]->data);
-        RL_FREE(AUDIO.MultiChannel.pool[i]);
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
+            samplesDecoded = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, samplesCount)*music.stream.channels;
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            // NOTE: Returns the number of samples to process (not required)
+            drflac_read_pcm_frames_s16((drflac *)music.ctxData, samplesCount, (short *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            // NOTE: samplesCount, actually refers to framesCount and returns the number of frames processed
+            samplesDecoded = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm)*music.stream.channels;
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally this function considers 2 channels generation, so samplesCount/2
+            jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, samplesCount/2);
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, samplesCount/2, 0);
+        } break;
+    #endif
+        default: break;
+    }
+
+    // Decoding buffers are reused, fill with silence any sample not decoded
+    if ((samplesDecoded >= 0) && (samplesDecoded < samplesCount)) memset((unsigned char *)pcm + samplesDecoded*music.stream.sampleSize/8, 0, (samplesCount - samplesDecoded)*music.stream.sampleSize/8);
+
+    if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))
+    {
+        if (samplesCount > 1) samplesConsumed = samplesCount/2;
+    }
+
+    return samplesConsumed;
+}
+
+// Seek music decoding to start
+static void RewindMusicStream(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Seek music decoding to frame (sample-accurate)
+// NOTE 1: OGG seeking bisects pages granule positions and FLAC seeking uses file seektable (if available),
+// MP3 seek table is built on first seek, modules (XM, MOD) are generated from start up to frame
+// NOTE 2: Frame must be smaller than music frames count
+static bool SeekMusicStreamFrame(Music music, unsigned int frame)
+{
+    if (frame == 0)
+    {
+        RewindMusicStream(music);
+        return true;
+    }
+
+    bool result = false;
+
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: result = (stb_vorbis_seek((stb_vorbis *)music.ctxData, frame) != 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: result = drflac_seek_to_pcm_frame((drflac *)music.ctxData, frame); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            drmp3 *ctxMp3 = (drmp3 *)music.ctxData;
+
+            // Seek table is calculated once (one seek point per second), avoids decoding from start on every seek
+            if (ctxMp3->pSeekPoints == NULL)
+            {
+                drmp3_uint32 seekPointCount = music.sampleCount/music.stream.channels/ctxMp3->sampleRate + 1;
+                drmp3_seek_point *seekPoints = (drmp3_seek_point *)RL_MALLOC(seekPointCount*sizeof(drmp3_seek_point));
+
+                if ((seekPoints != NULL) && drmp3_calculate_seek_points(ctxMp3, &seekPointCount, seekPoints)) drmp3_bind_seek_table(ctxMp3, seekPointCount, seekPoints);
+                else RL_FREE(seekPoints);
+            }
+
+            result = drmp3_seek_to_pcm_frame(ctxMp3, frame);
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            float samples[MUSIC_SEEK_SKIP_FRAMES*2];    // NOTE: Only stereo is supported for XM
+
+            jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+            for (unsigned int framesLeft = frame; framesLeft > 0; )
+            {
+                unsigned int framesToSkip = (framesLeft > MUSIC_SEEK_SKIP_FRAMES)? MUSIC_SEEK_SKIP_FRAMES : framesLeft;
+                jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, samples, framesToSkip);
+                framesLeft -= framesToSkip;
+            }
+
+            result = true;
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            short samples[MUSIC_SEEK_SKIP_FRAMES*2];    // NOTE: Only stereo is supported for MOD
+
+            jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+            for (unsigned int framesLeft = frame; framesLeft > 0; )
+            {
+                unsigned int framesToSkip = (framesLeft > MUSIC_SEEK_SKIP_FRAMES)? MUSIC_SEEK_SKIP_FRAMES : framesLeft;
+                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, samples, framesToSkip, 0);
+                framesLeft -= framesToSkip;
+            }
+
+            result = true;
+        } break;
+#endif
+        default: break;
+    }
+
+    return result;
+}
+
+// Restart music decoder from music start, buffers decoded ahead are discarded
+// NOTE: Requires decoders lock, audio stream is not fed until pending stop request is applied by mixer
+static void ResetMusicDecoder(MusicDecoder *decoder)
+{
+    decoder->loopsLeft = (decoder->loopCount > 0)? decoder->loopCount - 1 : 0;
+
+    SeekMusicDecoder(decoder, 0);
+}
+
+// Restart music decoder from frame, buffers decoded ahead are discarded
+// NOTE: Requires decoders lock, music loops left are kept
+static bool SeekMusicDecoder(MusicDecoder *decoder, unsigned int frame)
+{
+    bool result = SeekMusicStreamFrame(decoder->music, frame);
+
+    int samplesLeft = decoder->music.sampleCount - frame*decoder->music.stream.channels;
+    decoder->samplesLeft = (samplesLeft > 0)? samplesLeft : 0;
+    decoder->decoded = false;
+    decoder->resetSequence = AUDIO.Command.writeIndex;
+    AUDIO_STORE_RELEASE(decoder->music.stream.buffer->totalFramesProcessed, frame);
+
+    AUDIO_STORE_RELEASE(decoder->readIndex, decoder->writeIndex);
+    AUDIO_STORE_RELEASE(decoder->music.stream.buffer->isStreamFinished, false);
+
+    return result;
+}
+
+// Feed audio stream and decode buffers ahead (decoder thread)
+// NOTE: Music loops are decoded without gaps, next loop starts in the same buffer
+static void UpdateMusicDecoder(MusicDecoder *decoder)
+{
+    AudioStream stream = decoder->music.stream;
+    unsigned int sampleBytes = stream.sampleSize/8;
+
+    // Audio stream sub-buffers keep previous data until stop request is applied
+    bool isStreamReady = ((int)(AUDIO_LOAD_ACQUIRE(AUDIO.Command.readIndex) - decoder->resetSequence) >= 0);
+
+    while (1)
+    {
+        // Send decoded buffers to audio stream in order, as soon as sub-buffers are processed
+        while (isStreamReady && (decoder->readIndex != decoder->writeIndex) && IsAudioStreamProcessed(stream))
+        {
+            int index = decoder->readIndex%decoder->buffersCount;
+
+            UpdateAudioStream(stream, decoder->data + index*decoder->bufferSize*sampleBytes, decoder->samplesCount[index]);
+            AUDIO_STORE_RELEASE(decoder->readIndex, decoder->readIndex + 1);
+
+            // Music time played restarts with every loop
+            if (decoder->loopSamples[index] >= 0) AUDIO_STORE_RELEASE(stream.buffer->totalFramesProcessed, decoder->loopSamples[index]/stream.channels);
+        }
+
+        // Audio stream ends once last decoded buffer is played
+        if (isStreamReady && decoder->decoded && (decoder->readIndex == decoder->writeIndex) && !stream.buffer->isStreamFinished)
+        {
+            AUDIO_STORE_RELEASE(stream.buffer->isStreamFinished, true);
+        }
+
+        if (decoder->decoded || ((decoder->writeIndex - decoder->readIndex) >= (unsigned int)decoder->buffersCount)) break;
+
+        // Decode next buffer, looping to music start when required
+        int index = decoder->writeIndex%decoder->buffersCount;
+        unsigned char *pcm = decoder->data + index*decoder->bufferSize*sampleBytes;
+        int samplesDecoded = 0;
+
+        decoder->loopSamples[index] = -1;
+
+        while ((samplesDecoded < (int)decoder->bufferSize) && !decoder->decoded)
+        {
+            int samplesCount = decoder->bufferSize - samplesDecoded;
+            if (samplesCount > decoder->samplesLeft) samplesCount = decoder->samplesLeft;
+
+            if (samplesCount > 0) decoder->samplesLeft -= ReadMusicStreamSamples(decoder->music, pcm + samplesDecoded*sampleBytes, samplesCount);
+            samplesDecoded += samplesCount;
+
+            if (decoder->samplesLeft <= 0)
+            {
+                if ((decoder->loopCount == 0) || (decoder->loopsLeft > 0))
+                {
+                    if (decoder->loopsLeft > 0) decoder->loopsLeft--;
+
+                    RewindMusicStream(decoder->music);
+                    decoder->samplesLeft = decoder->music.sampleCount;
+                    decoder->loopSamples[index] = decoder->bufferSize - samplesDecoded;
+
+                    // Avoid infinite loop on empty music
+                    if (decoder->samplesLeft <= 0) decoder->decoded = true;
+                }
+                else decoder->decoded = true;
+            }
+        }
+
+        decoder->samplesCount[index] = samplesDecoded;
+        AUDIO_STORE_RELEASE(decoder->writeIndex, decoder->writeIndex + 1);
+    }
+}
+
+#if !defined(MA_EMSCRIPTEN)
+// Music decoder thread main loop, decodes all music on the list
+// NOTE: Sleep time must be shorter than audio stream sub-buffers duration
+static ma_thread_result MA_THREADCALL ProcessMusicDecoders(void *data)
+{
+    (void)data;
+
+    while (AUDIO_LOAD_ACQUIRE(AUDIO.Decoder.running))
+    {
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        for (MusicDecoder *decoder = AUDIO.Decoder.first; decoder != NULL; decoder = decoder->next) UpdateMusicDecoder(decoder);
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        ma_sleep(MUSIC_DECODER_SLEEP_MS);
     }
+
+    return (ma_thread_result)0;
 }
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_WAV)
 // Load WAV file into Wave structure
@@ -1889,7 +4657,9 @@ static Wave LoadWAV(const char *fileName)
                     wave.data = RL_MALLOC(wavData.subChunkSize);
 
                     // Read in the sound data into the soundData variable
-                    fread(wave.data, wavData.subChunkSize, 1, wavFile);
+                    // NOTE: Truncated files provide less data than declared, only data read is kept
+                    int dataSize = (int)fread(wave.data, 1, wavData.subChunkSize, wavFile);
+                    if (dataSize < wavData.subChunkSize) TRACELOG(LOG_WARNING, "[%s] WAV data truncated (%i of %i bytes)", fileName, dataSize, wavData.subChunkSize);
 
                     // Store wave parameters
                     wave.sampleRate = wavFormat.sampleRate;
@@ -1911,7 +4681,7 @@ static Wave LoadWAV(const char *fileName)
                     }
 
                     // NOTE: subChunkSize comes in bytes, we need to translate it to number of samples
-                    wave.sampleCount = (wavData.subChunkSize/(wave.sampleSize/8))/wave.channels;
+                    wave.sampleCount = (dataSize/(wave.sampleSize/8))/wave.channels;
 
                     TRACELOG(LOG_INFO, "[%s] WAV file loaded successfully (%i Hz, %i bit, %s)", fileName, wave.sampleRate, wave.sampleSize, (wave.channels == 1)? "Mono" : "Stereo");
                 }
@@ -1967,7 +4737,7 @@ static int SaveWAV(Wave wave, const char *fileName)
         riffHeader.chunkID[1] = 'I';
         riffHeader.chunkID[2] = 'F';
         riffHeader.chunkID[3] = 'F';
-        riffHeader.chunkSize = 44 - 4 + wave.sampleCount*wave.sampleSize/8;
+        riffHeader.chunkSize = 44 - 8 + dataSize;
         riffHeader.format[0] = 'W';
         riffHeader.format[1] = 'A';
         riffHeader.format[2] = 'V';
@@ -1978,11 +4748,11 @@ static int SaveWAV(Wave wave, const char *fileName)
         waveFormat.subChunkID[2] = 't';
         waveFormat.subChunkID[3] = ' ';
         waveFormat.subChunkSize = 16;
-        waveFormat.audioFormat = 1;
+        waveFormat.audioFormat = (wave.sampleSize == 32)? 3 : 1;     // 32 bit samples are float (WAVE_FORMAT_IEEE_FLOAT)
         waveFormat.numChannels = wave.channels;
         waveFormat.sampleRate = wave.sampleRate;
-        waveFormat.byteRate = wave.sampleRate*wave.sampleSize/8;
-        waveFormat.blockAlign = wave.sampleSize/8;
+        waveFormat.byteRate = wave.sampleRate*wave.channels*wave.sampleSize/8;
+        waveFormat.blockAlign = wave.channels*wave.sampleSize/8;
         waveFormat.bitsPerSample = wave.sampleSize;
 
         waveData.subChunkID[0] = 'd';
@@ -2106,6 +4876,44 @@ bool IsFileExtension(const char *fileName, const char *ext)
 
     return result;
 }
+
+// Load data from file into a buffer
+unsigned char *LoadFileData(const char *fileName, int *bytesRead)
+{
+    unsigned char *data = NULL;
+    *bytesRead = 0;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*size);
+            *bytesRead = (int)fread(data, sizeof(unsigned char), size, file);
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Save data to file from buffer
+void SaveFileData(const char *fileName, void *data, int bytesToWrite)
+{
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        fwrite(data, 1, bytesToWrite, file);
+        fclose(file);
+    }
+}
 #endif
 
 #undef AudioBuffer
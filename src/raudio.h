@@ -78,6 +78,23 @@
     #endif
 #endif
 
+// Vector3 type
+typedef struct Vector3 {
+    float x;
+    float y;
+    float z;
+} Vector3;
+
+// Camera type, defines a camera position/orientation in 3d space (used as 3d audio listener)
+// NOTE: Same structure as raylib Camera3D
+typedef struct Camera3D {
+    Vector3 position;       // Camera position
+    Vector3 target;         // Camera target it looks-at
+    Vector3 up;             // Camera up vector (rotation over its axis)
+    float fovy;             // Camera field-of-view apperture in Y (degrees), not used by audio
+    int type;               // Camera type, not used by audio
+} Camera3D;
+
 // Wave type, defines audio wave data
 typedef struct Wave {
     unsigned int sampleCount;       // Total number of samples
@@ -87,6 +104,39 @@ typedef struct Wave {
     void *data;                     // Buffer data pointer
 } Wave;
 
+// Sound data storage modes (sounds loaded after SetSoundStorageMode())
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,   // Sound data converted to device format on load (fastest mixing)
+    SOUND_STORAGE_NATIVE,       // Sound data kept in wave format, converted while mixing
+    SOUND_STORAGE_COMPRESSED    // OGG/FLAC file data kept compressed, decoded on play into sounds cache
+} SoundStorageMode;
+
+// Audio mixer buses, sounds and audio streams are mixed into AUDIO_BUS_SFX and music into AUDIO_BUS_MUSIC by default
+typedef enum {
+    AUDIO_BUS_SFX = 0,          // Sound effects bus
+    AUDIO_BUS_MUSIC,            // Music bus
+    AUDIO_BUS_VOICE             // Voice (dialogs) bus
+} AudioBusType;
+
+// Audio bus effects, processed in order on bus mixed frames (see AddAudioBusEffect())
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,   // Biquad low-pass filter (value1: cutoff frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_HIGHPASS,      // Biquad high-pass filter (value1: cutoff frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_BANDPASS,      // Biquad band-pass filter (value1: center frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_COMPRESSOR,    // Compressor (value1: threshold in dB, value2: ratio)
+    AUDIO_EFFECT_LIMITER,       // Peak limiter (value1: ceiling in dB, value2: release time in ms, 50 ms by default)
+    AUDIO_EFFECT_REVERB,        // Reverb (value1: room size 0.0f to 1.0f, value2: wet mix 0.0f to 1.0f)
+    AUDIO_EFFECT_DUCKING        // Ducking, lowers bus volume while sidechain bus plays (value1: sidechain bus, value2: ducked volume)
+} AudioEffectType;
+
+// 3d audio distance attenuation models (see SetAudioAttenuation())
+typedef enum {
+    AUDIO_ATTENUATION_NONE = 0, // No distance attenuation, only panning and doppler
+    AUDIO_ATTENUATION_LINEAR,   // Linear attenuation from minimum distance, silent at maximum distance
+    AUDIO_ATTENUATION_INVERSE,  // Inverse distance attenuation (realistic, default)
+    AUDIO_ATTENUATION_EXPONENTIAL   // Exponential distance attenuation, faster roll-off
+} AudioAttenuationModel;
+
 typedef struct rAudioBuffer rAudioBuffer;
 
 // Audio stream type
@@ -132,14 +182,33 @@ extern "C" {            // Prevents name mangling of functions
 
 // Audio device management functions
 void InitAudioDevice(void);                                     // Initialize audio device and context
+void InitAudioDeviceOffline(void);                              // Initialize audio context without device (offline rendering)
 void CloseAudioDevice(void);                                    // Close the audio device and context
 bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 void SetMasterVolume(float volume);                             // Set master volume (listener)
+int GetAudioXrunsCount(void);                                   // Get number of audio xruns (mixing slower than real-time)
+void SetAudioVoicesBudget(int count);                           // Set maximum number of voices mixed (remaining voices are virtual)
+int GetAudioVoicesMixed(void);                                  // Get number of voices mixed on last mix
+int GetAudioVoicesVirtual(void);                                // Get number of virtual voices on last mix (playing but not mixed)
+void RenderAudioFrames(float *frames, int frameCount);          // Render mixed audio frames (offline rendering, stereo 32 bit float)
+
+// Audio buses and effects functions
+void SetAudioBusVolume(int bus, float volume);                  // Set volume for a mixer bus (1.0 is max level)
+int AddAudioBusEffect(int bus, int type, float value1, float value2); // Add effect at the end of a bus processing chain, returns effect index (-1 on failure)
+void SetAudioBusEffect(int bus, int effect, float value1, float value2); // Set parameters of a bus effect
+void ClearAudioBusEffects(int bus);                             // Remove all effects from a bus processing chain
+float GetAudioBusCpuUsage(int bus);                             // Get bus mixing and effects time on last mix, relative to audio duration
+
+// 3d audio functions
+void UpdateAudioListener(Camera3D camera);                      // Update listener from camera and all emitters 3d audio parameters (once per frame)
+void SetAudioAttenuation(int model, float minDistance, float maxDistance, float rolloff);// Set 3d audio distance attenuation model and range
+void SetAudioDopplerFactor(float factor);                       // Set 3d audio doppler effect factor (0.0 disables it, 1.0 by default)
 
 // Wave/Sound loading/unloading functions
 Wave LoadWave(const char *fileName);                            // Load wave data from file
 Sound LoadSound(const char *fileName);                          // Load sound from file
 Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+void SetSoundStorageMode(int mode);                             // Set storage mode for sounds loaded next (SOUND_STORAGE_DEVICE by default)
 void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
 void UnloadWave(Wave wave);                                     // Unload wave data
 void UnloadSound(Sound sound);                                  // Unload sound
@@ -157,6 +226,9 @@ int GetSoundsPlaying(void);                                     // Get number of
 bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
+void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (higher priority sounds are mixed first)
+void SetSoundBus(Sound sound, int bus);                         // Set mixer bus for a sound (AUDIO_BUS_SFX by default)
+void SetSoundPosition(Sound sound, Vector3 position);           // Set 3d position for a sound (sound becomes an emitter)
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
 Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
@@ -170,12 +242,17 @@ void UpdateMusicStream(Music music);                            // Updates buffe
 void StopMusicStream(Music music);                              // Stop music playing
 void PauseMusicStream(Music music);                             // Pause music playing
 void ResumeMusicStream(Music music);                            // Resume playing paused music
+void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
 bool IsMusicPlaying(Music music);                               // Check if music is playing
 void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
+void SetMusicBus(Music music, int bus);                         // Set mixer bus for music (AUDIO_BUS_MUSIC by default)
+void SetMusicPosition(Music music, Vector3 position);           // Set 3d position for music (music becomes an emitter)
 void SetMusicLoopCount(Music music, int count);                 // Set music loop count (loop repeats)
 float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+void SetMusicStreamThreaded(Music music, int buffersCount);     // Decode music on background thread, keeping buffers decoded ahead (0 to disable)
+float GetMusicStreamFillLevel(Music music);                     // Get music decoded buffers fill level (0.0f to 1.0f)
 
 // AudioStream management functions
 AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Init audio stream (to stream raw audio pcm data)
@@ -189,6 +266,8 @@ bool IsAudioStreamPlaying(AudioStream stream);                  // Check if audi
 void StopAudioStream(AudioStream stream);                       // Stop audio stream
 void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
+void SetAudioStreamBus(AudioStream stream, int bus);            // Set mixer bus for audio stream (AUDIO_BUS_SFX by default)
+void SetAudioStreamPosition(AudioStream stream, Vector3 position);// Set 3d position for audio stream (stream becomes an emitter)
 void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 
 #ifdef __cplusplus
@@ -302,6 +302,9 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// Mesh bounding volume hierarchy, internal data used by ray collisions
+typedef struct MeshBVH MeshBVH;
+
 // Vertex data definning a mesh
 // NOTE: Data stored in CPU memory (and GPU)
 typedef struct Mesh {
@@ -322,6 +325,11 @@ typedef struct Mesh {
     float *animNormals;     // Animated normals (after bones transformations)
     int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    Matrix *boneMatrices;   // Bones transformation matrices for current pose (GPU skinning)
+    int boneCount;          // Number of bones transformation matrices (GPU skinning)
+
+    // Collision data
+    MeshBVH *bvh;           // Bounding volume hierarchy for ray collisions (optional)
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
@@ -384,7 +392,12 @@ typedef struct ModelAnimation {
     BoneInfo *bones;        // Bones information (skeleton)
 
     int frameCount;         // Number of animation frames
-    Transform **framePoses; // Poses array by frame
+    Transform **framePoses; // Poses array by frame (NULL if animation keyframes have been compressed)
+
+    int keyCount;           // Number of keyframes, all bones (compressed animation)
+    int *boneKeys;          // First keyframe index by bone, boneCount + 1 entries (compressed animation)
+    int *keyFrames;         // Keyframes frame number (compressed animation)
+    Transform *keyPoses;    // Keyframes bone pose (compressed animation)
 } ModelAnimation;
 
 // Ray type (useful for raycast)
@@ -705,7 +718,12 @@ typedef enum {
     LOC_MAP_CUBEMAP,
     LOC_MAP_IRRADIANCE,
     LOC_MAP_PREFILTER,
-    LOC_MAP_BRDF
+    LOC_MAP_BRDF,
+    LOC_VERTEX_INSTANCE_TRANSFORM,
+    LOC_VERTEX_INSTANCE_COLOR,
+    LOC_VERTEX_BONEIDS,
+    LOC_VERTEX_BONEWEIGHTS,
+    LOC_MATRIX_BONES
 } ShaderLocationIndex;
 
 #define LOC_MAP_DIFFUSE      LOC_MAP_ALBEDO
@@ -850,6 +868,48 @@ typedef enum {
     NPT_3PATCH_HORIZONTAL   // Npatch defined by 3x1 tiles
 } NPatchType;
 
+// Asynchronous asset loading state (see PollAssetLoads())
+typedef enum {
+    ASSET_LOAD_INVALID = 0,     // Asset handle not valid (unknown, retrieved or unloaded)
+    ASSET_LOAD_PENDING,         // Asset queued or being decoded on a loader thread
+    ASSET_LOAD_DECODED,         // Asset decoded, waiting to be finalized on main thread (GPU upload)
+    ASSET_LOAD_READY,           // Asset loaded, ready to be retrieved
+    ASSET_LOAD_FAILED           // Asset could not be loaded, retrieving it releases the handle
+} AssetLoadState;
+
+// Sound data storage modes (sounds loaded after SetSoundStorageMode())
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,   // Sound data converted to device format on load (fastest mixing)
+    SOUND_STORAGE_NATIVE,       // Sound data kept in wave format, converted while mixing
+    SOUND_STORAGE_COMPRESSED    // OGG/FLAC file data kept compressed, decoded on play into sounds cache
+} SoundStorageMode;
+
+// Audio mixer buses, sounds and audio streams are mixed into AUDIO_BUS_SFX and music into AUDIO_BUS_MUSIC by default
+typedef enum {
+    AUDIO_BUS_SFX = 0,          // Sound effects bus
+    AUDIO_BUS_MUSIC,            // Music bus
+    AUDIO_BUS_VOICE             // Voice (dialogs) bus
+} AudioBusType;
+
+// Audio bus effects, processed in order on bus mixed frames (see AddAudioBusEffect())
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,   // Biquad low-pass filter (value1: cutoff frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_HIGHPASS,      // Biquad high-pass filter (value1: cutoff frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_BANDPASS,      // Biquad band-pass filter (value1: center frequency in Hz, value2: resonance Q, 0.7071f by default)
+    AUDIO_EFFECT_COMPRESSOR,    // Compressor (value1: threshold in dB, value2: ratio)
+    AUDIO_EFFECT_LIMITER,       // Peak limiter (value1: ceiling in dB, value2: release time in ms, 50 ms by default)
+    AUDIO_EFFECT_REVERB,        // Reverb (value1: room size 0.0f to 1.0f, value2: wet mix 0.0f to 1.0f)
+    AUDIO_EFFECT_DUCKING        // Ducking, lowers bus volume while sidechain bus plays (value1: sidechain bus, value2: ducked volume)
+} AudioEffectType;
+
+// 3d audio distance attenuation models (see SetAudioAttenuation())
+typedef enum {
+    AUDIO_ATTENUATION_NONE = 0, // No distance attenuation, only panning and doppler
+    AUDIO_ATTENUATION_LINEAR,   // Linear attenuation from minimum distance, silent at maximum distance
+    AUDIO_ATTENUATION_INVERSE,  // Inverse distance attenuation (realistic, default)
+    AUDIO_ATTENUATION_EXPONENTIAL   // Exponential distance attenuation, faster roll-off
+} AudioAttenuationModel;
+
 // Callbacks to be implemented by users
 typedef void (*TraceLogCallback)(int logType, const char *text, va_list args);
 
@@ -946,9 +1006,17 @@ RLAPI void SetTraceLogLevel(int logType);                         // Set the cur
 RLAPI void SetTraceLogExit(int logType);                          // Set the exit threshold (minimum) log level
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);        // Set a trace log callback to enable custom logging
 RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR)
+RLAPI void SetWorkerThreadCount(int count);                       // Set number of threads used for parallel processing (0 = hardware concurrency, 1 = disabled)
+RLAPI int GetWorkerThreadCount(void);                             // Get number of threads used for parallel processing (including calling thread)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (saved a .png)
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
 
+// Asynchronous assets loading functions (assets requested with Load*Async(), retrieved with GetAsset*())
+RLAPI int PollAssetLoads(float timeBudget);                       // Finalize decoded assets (GPU upload) for timeBudget seconds, returns assets still loading
+RLAPI int GetAssetLoadState(unsigned int asset);                  // Get asset loading state (AssetLoadState)
+RLAPI void GetAssetLoadProgress(int *loaded, int *requested);     // Get assets finished of requested since all previous requests finished
+RLAPI void UnloadAsset(unsigned int asset);                       // Cancel asset loading or unload asset not retrieved, handle is released
+
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *bytesRead);     // Load file data as byte array (read)
 RLAPI void SaveFileData(const char *fileName, void *data, int bytesToWrite); // Save data to file from byte array (write)
@@ -1108,6 +1176,10 @@ RLAPI void ExportImage(Image image, const char *fileName);
 RLAPI void ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI unsigned int LoadImageAsync(const char *fileName);                                                 // Request image loading on background, returns asset handle
+RLAPI unsigned int LoadTextureAsync(const char *fileName);                                               // Request texture loading on background (uploaded by PollAssetLoads()), returns asset handle
+RLAPI Image GetAssetImage(unsigned int asset);                                                           // Get loaded image and release asset handle
+RLAPI Texture2D GetAssetTexture(unsigned int asset);                                                     // Get loaded texture and release asset handle
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layoutType);                                    // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
@@ -1188,6 +1260,8 @@ RLAPI Font GetFontDefault(void);
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // Load font from file with extended parameters
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
+RLAPI unsigned int LoadFontAsync(const char *fileName);                                     // Request font loading on background (uploaded by PollAssetLoads()), returns asset handle
+RLAPI Font GetAssetFont(unsigned int asset);                                                // Get loaded font and release asset handle (default font if not loaded)
 RLAPI CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int charsCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const CharInfo *chars, Rectangle **recs, int charsCount, int fontSize, int padding, int packMethod);  // Generate image font atlas using chars info
 RLAPI void UnloadFont(Font font);                                                           // Unload Font from GPU memory (VRAM)
@@ -1262,6 +1336,8 @@ RLAPI void DrawGizmo(Vector3 position);
 // Model loading/unloading functions
 RLAPI Model LoadModel(const char *fileName);                                                            // Load model from files (meshes and materials)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                               // Load model from generated mesh (default material)
+RLAPI unsigned int LoadModelAsync(const char *fileName);                                                // Request model loading on background (uploaded by PollAssetLoads()), returns asset handle
+RLAPI Model GetAssetModel(unsigned int asset);                                                          // Get loaded model and release asset handle
 RLAPI void UnloadModel(Model model);                                                                    // Unload model from memory (RAM and/or VRAM)
 
 // Mesh loading/unloading functions
@@ -1279,6 +1355,11 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animsCount);                       // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);                           // Update model animation pose
+RLAPI void UpdateModelAnimationEx(Model model, ModelAnimation anim, float frame);                       // Update model animation pose for a fractional frame (interpolated)
+RLAPI void UpdateModelAnimationBlend(Model model, ModelAnimation *anims, float *frames, float *weights, int count);  // Update model animation pose cross-fading multiple animations
+RLAPI void UpdateModelAnimationPose(Model model, Transform *pose);                                      // Update model animation from custom pose (bones transforms)
+RLAPI void GetModelAnimationPose(ModelAnimation anim, float frame, Transform *pose);                     // Get animation pose (bones transforms) for a fractional frame (interpolated)
+RLAPI void CompressModelAnimation(ModelAnimation *anim, float tolerance);                               // Compress animation keyframes, dropping the ones interpolated within tolerance
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                                   // Unload animation data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                                     // Check model animation skeleton match
 
@@ -1298,10 +1379,13 @@ RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);
 RLAPI BoundingBox MeshBoundingBox(Mesh mesh);                                                           // Compute mesh bounding box limits
 RLAPI void MeshTangents(Mesh *mesh);                                                                    // Compute mesh tangents
 RLAPI void MeshBinormals(Mesh *mesh);                                                                   // Compute mesh binormals
+RLAPI void GenMeshBVH(Mesh *mesh);                                                                      // Generate mesh bounding volume hierarchy (faster ray collisions), call again after editing mesh.vertices
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);                           // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
+RLAPI void DrawModelInstanced(Model model, Matrix *transforms, Color *tints, int count);                // Draw a model multiple times with transforms (tints are optional, can be NULL)
+RLAPI void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int count);              // Draw a 3d mesh multiple times with material and transforms (GPU instancing)
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);                      // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                               // Draw bounding box (wires)
@@ -1315,7 +1399,9 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI bool CheckCollisionRaySphere(Ray ray, Vector3 center, float radius);                              // Detect collision between ray and sphere
 RLAPI bool CheckCollisionRaySphereEx(Ray ray, Vector3 center, float radius, Vector3 *collisionPoint);   // Detect collision between ray and sphere, returns collision point
 RLAPI bool CheckCollisionRayBox(Ray ray, BoundingBox box);                                              // Detect collision between ray and box
-RLAPI RayHitInfo GetCollisionRayModel(Ray ray, Model model);                                            // Get collision info between ray and model
+RLAPI RayHitInfo GetCollisionRayModel(Ray ray, Model model);                                            // Get collision info between ray and model (meshes BVH used if generated, GenMeshBVH() again after editing vertices)
+RLAPI RayHitInfo GetCollisionRayMesh(Ray ray, Mesh mesh, Matrix transform);                            // Get collision info between ray and mesh (mesh BVH used if available, GenMeshBVH() again after editing vertices)
+RLAPI void GetCollisionRaysModel(Ray *rays, int count, Model model, RayHitInfo *hits);                  // Get collision info between multiple rays and model (meshes BVH used if generated, GenMeshBVH() again after editing vertices)
 RLAPI RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);                  // Get collision info between ray and triangle
 RLAPI RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight);                                    // Get collision info between ray and ground plane (Y-normal plane)
 
@@ -1375,14 +1461,35 @@ RLAPI void EndVrDrawing(void);                          // End VR simulator ster
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(void);                              // Initialize audio context without device (offline rendering)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI int GetAudioXrunsCount(void);                                   // Get number of audio xruns (mixing slower than real-time)
+RLAPI void SetAudioVoicesBudget(int count);                           // Set maximum number of voices mixed (remaining voices are virtual)
+RLAPI int GetAudioVoicesMixed(void);                                  // Get number of voices mixed on last mix
+RLAPI int GetAudioVoicesVirtual(void);                                // Get number of virtual voices on last mix (playing but not mixed)
+RLAPI void RenderAudioFrames(float *frames, int frameCount);          // Render mixed audio frames (offline rendering, stereo 32 bit float)
+
+// Audio buses and effects functions
+RLAPI void SetAudioBusVolume(int bus, float volume);                  // Set volume for a mixer bus (1.0 is max level)
+RLAPI int AddAudioBusEffect(int bus, int type, float value1, float value2); // Add effect at the end of a bus processing chain, returns effect index (-1 on failure)
+RLAPI void SetAudioBusEffect(int bus, int effect, float value1, float value2); // Set parameters of a bus effect
+RLAPI void ClearAudioBusEffects(int bus);                             // Remove all effects from a bus processing chain
+RLAPI float GetAudioBusCpuUsage(int bus);                             // Get bus mixing and effects time on last mix, relative to audio duration
+
+// 3d audio functions
+RLAPI void UpdateAudioListener(Camera3D camera);                      // Update listener from camera and all emitters 3d audio parameters (once per frame)
+RLAPI void SetAudioAttenuation(int model, float minDistance, float maxDistance, float rolloff);// Set 3d audio distance attenuation model and range
+RLAPI void SetAudioDopplerFactor(float factor);                       // Set 3d audio doppler effect factor (0.0 disables it, 1.0 by default)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI unsigned int LoadSoundAsync(const char *fileName);              // Request sound loading on background (finished by PollAssetLoads()), returns asset handle
+RLAPI Sound GetAssetSound(unsigned int asset);                        // Get loaded sound and release asset handle
+RLAPI void SetSoundStorageMode(int mode);                             // Set storage mode for sounds loaded next (SOUND_STORAGE_DEVICE by default)
 RLAPI void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
@@ -1400,6 +1507,9 @@ RLAPI int GetSoundsPlaying(void);                                     // Get num
 RLAPI bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (higher priority sounds are mixed first)
+RLAPI void SetSoundBus(Sound sound, int bus);                         // Set mixer bus for a sound (AUDIO_BUS_SFX by default)
+RLAPI void SetSoundPosition(Sound sound, Vector3 position);           // Set 3d position for a sound (sound becomes an emitter)
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
@@ -1413,12 +1523,17 @@ RLAPI void UpdateMusicStream(Music music);                            // Updates
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
+RLAPI void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
 RLAPI bool IsMusicPlaying(Music music);                               // Check if music is playing
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
+RLAPI void SetMusicBus(Music music, int bus);                         // Set mixer bus for music (AUDIO_BUS_MUSIC by default)
+RLAPI void SetMusicPosition(Music music, Vector3 position);           // Set 3d position for music (music becomes an emitter)
 RLAPI void SetMusicLoopCount(Music music, int count);                 // Set music loop count (loop repeats)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI void SetMusicStreamThreaded(Music music, int buffersCount);     // Decode music on background thread, keeping buffers decoded ahead (0 to disable)
+RLAPI float GetMusicStreamFillLevel(Music music);                     // Get music decoded buffers fill level (0.0f to 1.0f)
 
 // AudioStream management functions
 RLAPI AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Init audio stream (to stream raw audio pcm data)
@@ -1432,6 +1547,8 @@ RLAPI bool IsAudioStreamPlaying(AudioStream stream);                  // Check i
 RLAPI void StopAudioStream(AudioStream stream);                       // Stop audio stream
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
+RLAPI void SetAudioStreamBus(AudioStream stream, int bus);            // Set mixer bus for audio stream (AUDIO_BUS_SFX by default)
+RLAPI void SetAudioStreamPosition(AudioStream stream, Vector3 position);// Set 3d position for audio stream (stream becomes an emitter)
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 
 //------------------------------------------------------------------------------------
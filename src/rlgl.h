@@ -32,6 +32,12 @@
 *   #define SUPPORT_VR_SIMULATOR
 *       Support VR simulation functionality (stereo rendering)
 *
+*   #define MAX_BATCH_BUFFERING
+*       Number of internal batch buffers used in a ring (multi-buffering), 3 by default.
+*       On OpenGL 3.3 with GL_ARB_buffer_storage support, buffers are persistently mapped and
+*       vertex data is written directly into GPU-visible memory, otherwise (or if mapping fails) buffers
+*       are orphaned and updated on every rlglDraw()
+*
 *   DEPENDENCIES:
 *       raymath     - 3D math functionality (Vector3, Matrix, Quaternion)
 *       GLAD        - OpenGL extensions loading (OpenGL 3.3 Core only)
@@ -132,17 +138,23 @@
     // This is the maximum amount of elements (quads) per batch
     // NOTE: Be careful with text, every letter maps to a quad
     #define MAX_BATCH_ELEMENTS            8192
+    // Maximum amount of elements (quads) default batch can grow to when full (auto-grow)
+    #define MAX_BATCH_ELEMENTS_LIMIT     65536
 #elif defined(GRAPHICS_API_OPENGL_ES2)
     // We reduce memory sizes for embedded systems (RPI and HTML5)
     // NOTE: On HTML5 (emscripten) this is allocated on heap, by default it's only 16MB!...just take care...
     #define MAX_BATCH_ELEMENTS            2048
+    // NOTE: Indices are 16bit on OpenGL ES 2.0, limiting every buffer to 65536 vertex
+    #define MAX_BATCH_ELEMENTS_LIMIT     16384
 #endif
 
 #ifndef MAX_BATCH_BUFFERING
-    #define MAX_BATCH_BUFFERING              1      // Max number of buffers for batching (multi-buffering)
+    // NOTE: Buffers are used in a ring, every rlglDraw() moves to the next one,
+    // so the GPU can keep reading previous batches while new vertex data is written
+    #define MAX_BATCH_BUFFERING              3      // Max number of buffers for batching (multi-buffering)
 #endif
 #define MAX_MATRIX_STACK_SIZE               32      // Max size of Matrix stack
-#define MAX_DRAWCALL_REGISTERED            256      // Max draws by state changes (mode, texture)
+#define MAX_DRAWCALL_REGISTERED            256      // Initial draws by state changes (mode, texture), grows if required
 
 #ifndef DEFAULT_NEAR_CULL_DISTANCE
     #define DEFAULT_NEAR_CULL_DISTANCE    0.01      // Default near cull distance
@@ -153,6 +165,7 @@
 
 // Shader and material limits
 #define MAX_SHADER_LOCATIONS                32      // Maximum number of predefined locations stored in shader struct
+#define MAX_MESH_BONES                     128      // Maximum number of bones for GPU skinning (reduced if GPU vertex uniforms are not enough)
 #define MAX_MATERIAL_MAPS                   12      // Maximum number of texture maps stored in shader struct
 
 // Texture parameters (equivalent to OpenGL defines)
@@ -257,10 +270,12 @@ typedef unsigned char byte;
         float *animNormals;     // Animated normals (after bones transformations)
         int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning)
         float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+        Matrix *boneMatrices;   // Bones transformation matrices for current pose (GPU skinning)
+        int boneCount;          // Number of bones transformation matrices (GPU skinning)
 
         // OpenGL identifiers
         unsigned int vaoId;     // OpenGL Vertex Array Object id
-        unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (7 types of vertex data)
+        unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (9 types of vertex data)
     } Mesh;
 
     // Shader and material limits
@@ -401,7 +416,12 @@ typedef unsigned char byte;
         LOC_MAP_CUBEMAP,
         LOC_MAP_IRRADIANCE,
         LOC_MAP_PREFILTER,
-        LOC_MAP_BRDF
+        LOC_MAP_BRDF,
+        LOC_VERTEX_INSTANCE_TRANSFORM,
+        LOC_VERTEX_INSTANCE_COLOR,
+        LOC_VERTEX_BONEIDS,
+        LOC_VERTEX_BONEWEIGHTS,
+        LOC_MATRIX_BONES
     } ShaderLocationIndex;
 
     // Shader uniform data types
@@ -439,6 +459,58 @@ typedef unsigned char byte;
     #define MAP_SPECULAR     MAP_METALNESS
 #endif
 
+// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+typedef struct VertexBuffer {
+    int elementsCount;          // Number of elements in the buffer (QUADS)
+
+    int vCounter;               // Vertex position counter to process (and draw) from full buffer
+    int tcCounter;              // Vertex texcoord counter to process (and draw) from full buffer
+    int cCounter;               // Vertex color counter to process (and draw) from full buffer
+
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#endif
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    void *fence;                // OpenGL sync object, signaled when GPU finished reading the buffer (persistent mapping only)
+    bool mapped;                // Vertex arrays are persistently mapped GPU-visible memory (not allocated on CPU)
+} VertexBuffer;
+
+// Draw call type
+// NOTE: Only texture changes register a new draw, as well as changing draw mode,
+// on batch sorting mode, shader, blending mode and layer changes also register a new draw
+typedef struct DrawCall {
+    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
+    int vertexCount;            // Number of vertex of the draw
+    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+    unsigned int textureId;     // Texture id to be used on the draw
+
+    Shader shader;              // Shader to be used on the draw (batch sorting mode)
+    int blendMode;              // Blending mode to be used on the draw (batch sorting mode)
+    int layer;                  // Draw layer, lower layers are drawn first (batch sorting mode)
+    int vertexOffset;           // Vertex offset in buffer, computed on batch sorting
+} DrawCall;
+
+// RenderBatch type
+typedef struct RenderBatch {
+    int buffersCount;           // Number of vertex buffers (multi-buffering support)
+    int currentBuffer;          // Current buffer tracking in case of multi-buffering
+    VertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
+
+    DrawCall *draws;            // Draw calls array, depends on textureId
+    int drawsCounter;           // Draw calls counter
+    int drawsCapacity;          // Draw calls array size (grows if required)
+    float currentDepth;         // Current depth value for next draw
+
+    int elementsLimit;          // Max elements a buffer can grow to when full (0 = no auto-grow, batch is drawn)
+    bool mapped;                // Vertex buffers persistent mapping requested (every buffer falls back to orphaning if mapping fails)
+} RenderBatch;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -506,9 +578,13 @@ RLAPI unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *b
 RLAPI void rlglInit(int width, int height);           // Initialize rlgl (buffers, shaders, textures, states)
 RLAPI void rlglClose(void);                           // De-inititialize rlgl (buffers, shaders, textures)
 RLAPI void rlglDraw(void);                            // Update and draw default internal buffers
+RLAPI void rlglEndFrame(void);                        // Finish current frame (update internal frame statistics)
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI double rlGetBatchStallTime(void);               // Get time spent uploading/waiting batch buffers on last frame (in seconds)
+RLAPI int rlGetDrawCallsRegistered(void);             // Get number of draw calls registered on last frame (before merging)
+RLAPI int rlGetDrawCallsSubmitted(void);              // Get number of draw calls submitted to GPU on last frame (after merging)
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 RLAPI Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view);  // Get world coordinates from screen coordinates
@@ -535,8 +611,22 @@ RLAPI void rlLoadMesh(Mesh *mesh, bool dynamic);                          // Upl
 RLAPI void rlUpdateMesh(Mesh mesh, int buffer, int num);                  // Update vertex or index data on GPU (upload new data to one buffer)
 RLAPI void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index);     // Update vertex or index data on GPU, at index
 RLAPI void rlDrawMesh(Mesh mesh, Material material, Matrix transform);    // Draw a 3d mesh with material and transform
+RLAPI void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, Color *colors, int count); // Draw a 3d mesh multiple times (GPU instancing if supported, colors can be NULL)
+RLAPI bool rlCheckSkinningSupport(Shader shader, int boneCount);          // Check if GPU skinning is supported for a shader and bones count (default shader supported)
 RLAPI void rlUnloadMesh(Mesh mesh);                                       // Unload mesh data from CPU and GPU
 
+// Render batch management
+// NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
+// but this render batch API is exposed in case of custom batches are required
+RLAPI RenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
+RLAPI void rlUnloadRenderBatch(RenderBatch batch);                        // Unload render batch system
+RLAPI void rlDrawRenderBatch(RenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
+RLAPI void rlSetRenderBatchActive(RenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
+RLAPI void rlSetRenderBatchGrowLimit(RenderBatch *batch, int elementsLimit); // Set render batch auto-grow elements limit (NULL for default internal, 0 disables)
+RLAPI void rlEnableBatchSorting(void);                                    // Enable batch sorting mode (draw calls sorted by state and merged on draw)
+RLAPI void rlDisableBatchSorting(void);                                   // Disable batch sorting mode (draw calls submitted in order)
+RLAPI void rlSetBatchLayer(int layer);                                    // Set layer for next draws (batch sorting mode)
+
 // NOTE: There is a set of shader related functions that are available to end user,
 // to avoid creating function wrappers through core module, they have been directly declared in raylib.h
 
@@ -616,6 +706,7 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 #endif
 
 #include <stdlib.h>                 // Required for: malloc(), free()
+#include <stdio.h>                  // Required for: snprintf() [Used in LoadShaderSkinning()]
 #include <string.h>                 // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                   // Required for: atan2f(), fabs()
 
@@ -725,6 +816,17 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
     #define GL_LUMINANCE_ALPHA                  0x190A
 #endif
 
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21) && !defined(__APPLE__)
+    // Persistently mapped buffers require GL_ARB_buffer_storage (loaded by GLAD if available)
+    #define RLGL_BUFFER_STORAGE_AVAILABLE
+#endif
+
+#if defined(RLGL_STANDALONE)
+    #define RLGL_GET_TIME()         0.0     // No timer available on standalone mode, stall time is not measured
+#else
+    #define RLGL_GET_TIME()         GetTime()
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2)
     #define glClearDepth                glClearDepthf
     #define GL_READ_FRAMEBUFFER         GL_FRAMEBUFFER
@@ -738,42 +840,15 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 #define DEFAULT_ATTRIB_COLOR_NAME       "vertexColor"       // shader-location = 3
 #define DEFAULT_ATTRIB_TANGENT_NAME     "vertexTangent"     // shader-location = 4
 #define DEFAULT_ATTRIB_TEXCOORD2_NAME   "vertexTexCoord2"   // shader-location = 5
+#define DEFAULT_ATTRIB_INSTANCE_TRANSFORM_NAME  "instanceTransform" // shader-location = 6 (mat4, uses locations 6..9)
+#define DEFAULT_ATTRIB_INSTANCE_COLOR_NAME      "instanceColor"     // shader-location = 10
+#define DEFAULT_ATTRIB_BONEIDS_NAME             "vertexBoneIds"     // shader-location = 11
+#define DEFAULT_ATTRIB_BONEWEIGHTS_NAME         "vertexBoneWeights" // shader-location = 12
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
-typedef struct DynamicBuffer {
-    int vCounter;               // vertex position counter to process (and draw) from full buffer
-    int tcCounter;              // vertex texcoord counter to process (and draw) from full buffer
-    int cCounter;               // vertex color counter to process (and draw) from full buffer
-
-    float *vertices;            // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    unsigned char *colors;      // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#endif
-    unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
-} DynamicBuffer;
-
-// Draw call type
-typedef struct DrawCall {
-    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
-    int vertexCount;            // Number of vertex of the draw
-    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
-    //unsigned int vaoId;         // Vertex array id to be used on the draw
-    //unsigned int shaderId;      // Shader id to be used on the draw
-    unsigned int textureId;     // Texture id to be used on the draw
-
-    //Matrix projection;        // Projection matrix for this draw
-    //Matrix modelview;         // Modelview matrix for this draw
-} DrawCall;
-
 #if defined(SUPPORT_VR_SIMULATOR)
 // VR Stereo rendering configuration for simulator
 typedef struct VrStereoConfig {
@@ -787,6 +862,9 @@ typedef struct VrStereoConfig {
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 typedef struct rlglData {
+    RenderBatch *currentBatch;              // Current render batch
+    RenderBatch defaultBatch;               // Default internal render batch
+
     struct {
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -794,14 +872,10 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool doTransform;                   // Use transform matrix against vertex (if required)
+        unsigned char currentColor[4];      // Last vertex color defined, used by rlEnd() to complete vertex colors
         Matrix stack[MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
-        DynamicBuffer vertexData[MAX_BATCH_BUFFERING];// Default dynamic buffer for elements data
-        int currentBuffer;                  // Current buffer tracking, multi-buffering system is supported
-        DrawCall *draws;                    // Draw calls array
-        int drawsCounter;                   // Draw calls counter
-
         Texture2D shapesTexture;            // Texture used on shapes drawing (usually a white)
         Rectangle shapesTextureRec;         // Texture source rectangle used on shapes drawing
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
@@ -809,7 +883,31 @@ typedef struct rlglData {
         unsigned int defaultFShaderId;      // Default fragment shader Id (used by default shader program)
         Shader defaultShader;               // Basic shader, support vertex color and diffuse texture
         Shader currentShader;               // Shader to be used on rendering (by default, defaultShader)
-        float currentDepth;                 // Current depth value
+        Shader instancingShader;            // Default shader with per-instance transform and color (used for instanced meshes)
+        unsigned int instancingVShaderId;   // Default instancing vertex shader id (fragment shader is the default one)
+        unsigned int instanceBufferId[2];   // Instance data buffers ids (transforms, colors)
+        float16 *instanceTransforms;        // Instance transforms staging array (column-major matrices)
+        int instanceCapacity;               // Instance transforms staging array size
+        Shader skinningShader;              // Default shader with vertex skinning (used for skinned meshes)
+        unsigned int skinningVShaderId;     // Default skinning vertex shader id (fragment shader is the default one)
+        int skinningMaxBones;               // Maximum bones for GPU skinning (bones array size, limited by vertex uniform components)
+        double stallTime;                   // Time spent uploading/waiting batch buffers on current frame
+        double stallTimeFrame;              // Time spent uploading/waiting batch buffers on last frame
+
+        int currentBlendMode;               // Blending mode active
+        int currentLayer;                   // Draw layer for next draws (batch sorting mode)
+        bool batchSorting;                  // Batch draw calls are sorted by state and merged on draw
+#if defined(GRAPHICS_API_OPENGL_33)
+        unsigned int *sortIndices;          // Sorted draws indices (generated on batch draw)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        unsigned short *sortIndices;        // Sorted draws indices (generated on batch draw)
+#endif
+        int sortIndicesCapacity;            // Sorted draws indices array size
+        unsigned int sortIndicesId;         // Sorted draws indices buffer id
+        int drawCallsRegistered;            // Draw calls registered on current frame
+        int drawCallsSubmitted;             // Draw calls submitted to GPU on current frame
+        int drawCallsRegisteredFrame;       // Draw calls registered on last frame
+        int drawCallsSubmittedFrame;        // Draw calls submitted to GPU on last frame
 
         int framebufferWidth;               // Default framebuffer width
         int framebufferHeight;              // Default framebuffer height
@@ -828,9 +926,12 @@ typedef struct rlglData {
         bool texMirrorClamp;                // Clamp mirror wrap mode supported
         bool texAnisoFilter;                // Anisotropic texture filtering support
         bool debugMarker;                   // Debug marker support
+        bool bufferStorage;                 // Persistently mapped buffers support (GL_ARB_buffer_storage)
+        bool instancing;                    // Instanced drawing support (vertex attrib divisor and instanced draw calls)
 
         float maxAnisotropicLevel;          // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
+        int maxVertexAttribs;               // Maximum vertex attributes (OpenGL ES 2.0 guarantees 8, OpenGL 3.3 guarantees 16)
 
     } ExtSupported;     // Extensions supported flags
 #if defined(SUPPORT_VR_SIMULATOR)
@@ -856,6 +957,11 @@ static rlglData RLGL = { 0 };
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;        // Entry point pointer to function glGenVertexArrays()
 static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;        // Entry point pointer to function glBindVertexArray()
 static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;  // Entry point pointer to function glDeleteVertexArrays()
+
+// NOTE: Instancing functionality is exposed through extensions (ANGLE, EXT, NV)
+static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced;       // Entry point pointer to function glDrawArraysInstanced()
+static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced;   // Entry point pointer to function glDrawElementsInstanced()
+static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor;       // Entry point pointer to function glVertexAttribDivisor()
 #endif
 
 //----------------------------------------------------------------------------------
@@ -868,11 +974,23 @@ static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShad
 static Shader LoadShaderDefault(void);      // Load default shader (just vertex positioning and texture coloring)
 static void SetShaderDefaultLocations(Shader *shader); // Bind default shader locations (attributes and uniforms)
 static void UnloadShaderDefault(void);      // Unload default shader
+static Shader LoadShaderInstancing(void);   // Load default instancing shader (default shader with per-instance transform and color)
+#if defined(GRAPHICS_API_OPENGL_33)
+static Shader LoadShaderSkinning(void);     // Load default skinning shader (default shader with bones transformations)
+#endif
+static void DrawMeshBuffers(Mesh mesh, Material material, Matrix transform, int instances, bool instanceColors);  // Draw mesh buffers (instanced if instances > 0)
 
-static void LoadBuffersDefault(void);       // Load default internal buffers
-static void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
-static void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
-static void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
+static void LoadVertexBuffer(VertexBuffer *buffer, int elementsCount, bool mapped);  // Load vertex buffer data (CPU and GPU)
+static void UnloadVertexBuffer(VertexBuffer *buffer);                // Unload vertex buffer data from CPU and GPU
+static bool GrowRenderBatch(RenderBatch *batch, int vCount);          // Grow vertex buffers of a batch (auto-grow)
+static void GrowDrawCalls(RenderBatch *batch);                        // Grow draw calls array of a batch
+static void SetDrawCallState(void);                                   // Register current state (shader, blending, layer) on current batch draw call
+static int SortRenderBatch(RenderBatch *batch);                       // Sort and merge batch draw calls, generating sorted indices
+static int CompareDrawCalls(const void *a, const void *b);            // Compare draw calls by state key (used for sorting)
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+static bool MapVertexBuffer(VertexBuffer *buffer, int elementsCount); // Create vertex buffers with immutable storage and map them persistently
+static void *MapBufferPersistent(unsigned int target, int size);   // Create immutable buffer storage and map it persistently
+#endif
 
 static void GenDrawCube(void);              // Generate and draw cube
 static void GenDrawQuad(void);              // Generate and draw quad
@@ -883,6 +1001,8 @@ static void SetStereoView(int eye, Matrix matProjection, Matrix matModelView);
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static void SetBlendMode(int mode);         // Set blending function for a blending mode
+
 #if defined(GRAPHICS_API_OPENGL_11)
 static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight);
 static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight);
@@ -1077,36 +1197,39 @@ void rlBegin(int mode)
 {
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode != mode)
+    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode != mode)
     {
-        if (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount > 0)
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount > 0)
         {
-            // Make sure current RLGL.State.draws[i].vertexCount is aligned a multiple of 4,
+            // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
             // that way, following QUADS drawing will keep aligned with index processing
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_LINES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount : RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4);
-            else if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_TRIANGLES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4)));
+            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
+            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)));
 
-            else RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = 0;
+            else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) rlglDraw();
             else
             {
-                RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
 
-                RLGL.State.drawsCounter++;
+                RLGL.currentBatch->drawsCounter++;
             }
         }
 
-        if (RLGL.State.drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity) GrowDrawCalls(RLGL.currentBatch);
 
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].mode = mode;
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount = 0;
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode = mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].shader = RLGL.State.currentShader;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].blendMode = RLGL.State.currentBlendMode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].layer = RLGL.State.currentLayer;
     }
 }
 
@@ -1117,30 +1240,31 @@ void rlEnd(void)
     // NOTE: In OpenGL 1.1, one glColor call can be made for all the subsequent glVertex calls
 
     // Make sure colors count match vertex count
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter != RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter)
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter != RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter)
     {
-        int addColors = RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter - RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter;
+        int addColors = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter - RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter;
 
+        // NOTE: Last color is kept on CPU, vertex colors are not read back from buffer (it could be GPU-visible memory)
         for (int i = 0; i < addColors; i++)
         {
-            RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 4];
-            RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 1] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 3];
-            RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 2] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 2];
-            RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 3] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 1];
-            RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter++;
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter] = RLGL.State.currentColor[0];
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 1] = RLGL.State.currentColor[1];
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 2] = RLGL.State.currentColor[2];
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 3] = RLGL.State.currentColor[3];
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter++;
         }
     }
 
     // Make sure texcoords count match vertex count
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter != RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter)
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter != RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter)
     {
-        int addTexCoords = RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter - RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter;
+        int addTexCoords = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter - RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter;
 
         for (int i = 0; i < addTexCoords; i++)
         {
-            RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter] = 0.0f;
-            RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter + 1] = 0.0f;
-            RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter++;
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter] = 0.0f;
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter + 1] = 0.0f;
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter++;
         }
     }
 
@@ -1149,11 +1273,12 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.State.currentDepth += (1.0f/20000.0f);
+    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 
     // Verify internal buffers limits
     // NOTE: This check is combined with usage of rlCheckBufferLimit()
-    if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter) >= (MAX_BATCH_ELEMENTS*4 - 4))
+    if (((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter) >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4 - 4)) &&
+        !GrowRenderBatch(RLGL.currentBatch, 4))
     {
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlglDraw(),
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
@@ -1172,38 +1297,41 @@ void rlVertex3f(float x, float y, float z)
     // Transform provided vector if required
     if (RLGL.State.doTransform) vec = Vector3Transform(vec, RLGL.State.transform);
 
-    // Verify that MAX_BATCH_ELEMENTS limit not reached
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter < (MAX_BATCH_ELEMENTS*4))
+    // Verify that current vertex buffer elements limit has not been reached (or buffer can grow)
+    // NOTE: Persistently mapped buffers only grow between primitives (rlEnd(), rlCheckBufferLimit()),
+    // batch must be drawn before growing them and current primitive would be split
+    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) ||
+        (!RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].mapped && GrowRenderBatch(RLGL.currentBatch, 1)))
     {
-        RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter] = vec.x;
-        RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + 1] = vec.y;
-        RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + 2] = vec.z;
-        RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter++;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter] = vec.x;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter + 1] = vec.y;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter + 2] = vec.z;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter++;
 
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount++;
     }
-    else TRACELOG(LOG_ERROR, "MAX_BATCH_ELEMENTS overflow");
+    else TRACELOG(LOG_ERROR, "Render batch elements overflow");
 }
 
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.State.currentDepth);
+    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.State.currentDepth);
+    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter] = x;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter + 1] = y;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter++;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter] = x;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter + 1] = y;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter++;
 }
 
 // Define one vertex (normal)
@@ -1216,11 +1344,16 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(byte x, byte y, byte z, byte w)
 {
-    RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter] = x;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 1] = y;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 2] = z;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 3] = w;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter++;
+    RLGL.State.currentColor[0] = x;
+    RLGL.State.currentColor[1] = y;
+    RLGL.State.currentColor[2] = z;
+    RLGL.State.currentColor[3] = w;
+
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter] = x;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 1] = y;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 2] = z;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 3] = w;
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter++;
 }
 
 // Define one vertex (color)
@@ -1250,35 +1383,38 @@ void rlEnableTexture(unsigned int id)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId != id)
+    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId != id)
     {
-        if (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount > 0)
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount > 0)
         {
-            // Make sure current RLGL.State.draws[i].vertexCount is aligned a multiple of 4,
+            // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
             // that way, following QUADS drawing will keep aligned with index processing
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_LINES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount : RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4);
-            else if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_TRIANGLES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4)));
+            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
+            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)));
 
-            else RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = 0;
+            else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) rlglDraw();
             else
             {
-                RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
 
-                RLGL.State.drawsCounter++;
+                RLGL.currentBatch->drawsCounter++;
             }
         }
 
-        if (RLGL.State.drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity) GrowDrawCalls(RLGL.currentBatch);
 
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId = id;
-        RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = id;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].shader = RLGL.State.currentShader;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].blendMode = RLGL.State.currentBlendMode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].layer = RLGL.State.currentLayer;
     }
 #endif
 }
@@ -1292,7 +1428,7 @@ void rlDisableTexture(void)
 #else
     // NOTE: If quads batch limit is reached,
     // we force a draw call and next batch starts
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDraw();
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) rlglDraw();
 #endif
 }
 
@@ -1528,6 +1664,9 @@ void rlglInit(int width, int height)
     // NOTE: On OpenGL 3.3 VAO and NPOT are supported by default
     RLGL.ExtSupported.vao = true;
 
+    // Instancing is core on OpenGL 3.3, but not on OpenGL 2.1 contexts (functions not loaded)
+    if ((glDrawArraysInstanced != NULL) && (glDrawElementsInstanced != NULL) && (glVertexAttribDivisor != NULL)) RLGL.ExtSupported.instancing = true;
+
     // Multiple texture extensions supported by default
     RLGL.ExtSupported.texNPOT = true;
     RLGL.ExtSupported.texFloat32 = true;
@@ -1593,6 +1732,24 @@ void rlglInit(int width, int height)
             if ((glGenVertexArrays != NULL) && (glBindVertexArray != NULL) && (glDeleteVertexArrays != NULL)) RLGL.ExtSupported.vao = true;
         }
 
+        // Check instancing support
+        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has instancing support as core feature
+        if (strcmp(extList[i], (const char *)"GL_ANGLE_instanced_arrays") == 0)
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstancedANGLE");
+            glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)eglGetProcAddress("glDrawElementsInstancedANGLE");
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisorANGLE");
+        }
+        else if ((strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0) ||
+                 (strcmp(extList[i], (const char *)"GL_EXT_draw_instanced") == 0))
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstancedEXT");
+            glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)eglGetProcAddress("glDrawElementsInstancedEXT");
+            if (glVertexAttribDivisor == NULL) glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisorEXT");
+        }
+
+        if ((glDrawArraysInstanced != NULL) && (glDrawElementsInstanced != NULL) && (glVertexAttribDivisor != NULL)) RLGL.ExtSupported.instancing = true;
+
         // Check NPOT textures support
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
@@ -1637,6 +1794,11 @@ void rlglInit(int width, int height)
 
         // Debug marker support
         if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) RLGL.ExtSupported.debugMarker = true;
+
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+        // Persistently mapped buffers support
+        if ((strcmp(extList[i], (const char *)"GL_ARB_buffer_storage") == 0) && (glBufferStorage != NULL)) RLGL.ExtSupported.bufferStorage = true;
+#endif
     }
 
     // Free extensions pointers
@@ -1662,6 +1824,12 @@ void rlglInit(int width, int height)
     if (RLGL.ExtSupported.texMirrorClamp) TRACELOG(LOG_INFO, "[EXTENSION] Mirror clamp wrap texture mode supported");
 
     if (RLGL.ExtSupported.debugMarker) TRACELOG(LOG_INFO, "[EXTENSION] Debug Marker supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(LOG_INFO, "[EXTENSION] Persistently mapped buffers supported");
+    if (RLGL.ExtSupported.instancing) TRACELOG(LOG_INFO, "[EXTENSION] Instanced drawing supported");
+
+    // Get maximum vertex attributes, shader attribute locations are only binded if supported
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &RLGL.ExtSupported.maxVertexAttribs);
+    TRACELOG(LOG_INFO, "GPU: Maximum vertex attributes: %i", RLGL.ExtSupported.maxVertexAttribs);
 
     // Initialize buffers, default shaders and default textures
     //----------------------------------------------------------
@@ -1676,29 +1844,24 @@ void rlglInit(int width, int height)
     RLGL.State.defaultShader = LoadShaderDefault();
     RLGL.State.currentShader = RLGL.State.defaultShader;
 
+    // Init default instancing shader (only if instancing supported)
+    if (RLGL.ExtSupported.instancing) RLGL.State.instancingShader = LoadShaderInstancing();
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Init default skinning shader
+    // NOTE: GPU skinning not supported on OpenGL ES 2.0 (limited uniforms and attributes), CPU skinning is used
+    RLGL.State.skinningShader = LoadShaderSkinning();
+#endif
+
     // Init default vertex arrays buffers
-    LoadBuffersDefault();
+    // NOTE: Default batch grows when full (up to MAX_BATCH_ELEMENTS_LIMIT), avoiding draws in the middle of a frame
+    RLGL.defaultBatch = rlLoadRenderBatch(MAX_BATCH_BUFFERING, MAX_BATCH_ELEMENTS);
+    RLGL.defaultBatch.elementsLimit = MAX_BATCH_ELEMENTS_LIMIT;
+    RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init transformations matrix accumulator
     RLGL.State.transform = MatrixIdentity();
 
-    // Init draw calls tracking system
-    RLGL.State.draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
-
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
-    {
-        RLGL.State.draws[i].mode = RL_QUADS;
-        RLGL.State.draws[i].vertexCount = 0;
-        RLGL.State.draws[i].vertexAlignment = 0;
-        //RLGL.State.draws[i].vaoId = 0;
-        //RLGL.State.draws[i].shaderId = 0;
-        RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
-        //RLGL.State.draws[i].RLGL.State.projection = MatrixIdentity();
-        //RLGL.State.draws[i].RLGL.State.modelview = MatrixIdentity();
-    }
-
-    RLGL.State.drawsCounter = 1;
-
     // Init RLGL.State.stack matrices (emulating OpenGL 1.1)
     for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = MatrixIdentity();
 
@@ -1750,13 +1913,19 @@ void rlglInit(int width, int height)
 void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    UnloadShaderDefault();              // Unload default shader
-    UnloadBuffersDefault();             // Unload default buffers
+    UnloadShaderDefault();              // Unload default shader (and default instancing/skinning shaders)
+
+    // Unload instance data buffers
+    if (RLGL.State.instanceBufferId[0] != 0) glDeleteBuffers(2, RLGL.State.instanceBufferId);
+    RL_FREE(RLGL.State.instanceTransforms);
+    rlUnloadRenderBatch(RLGL.defaultBatch); // Unload default render batch
+
+    // Unload batch sorting indices
+    if (RLGL.State.sortIndicesId != 0) glDeleteBuffers(1, &RLGL.State.sortIndicesId);
+    RL_FREE(RLGL.State.sortIndices);
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
 
     TRACELOG(LOG_INFO, "[TEX ID %i] Unloaded texture data (base white texture) from VRAM", RLGL.State.defaultTextureId);
-
-    RL_FREE(RLGL.State.draws);
 #endif
 }
 
@@ -1764,172 +1933,617 @@ void rlglClose(void)
 void rlglDraw(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Only process data if we have data to process
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
-    {
-        UpdateBuffersDefault();
-        DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
-    }
+    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
 }
 
-// Returns current OpenGL version
-int rlGetVersion(void)
+// Finish current frame
+// NOTE: Internal per-frame statistics are stored and reset for next frame
+void rlglEndFrame(void)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    return OPENGL_11;
-#elif defined(GRAPHICS_API_OPENGL_21)
-    #if defined(__APPLE__)
-        return OPENGL_33;       // NOTE: Force OpenGL 3.3 on OSX
-    #else
-        return OPENGL_21;
-    #endif
-#elif defined(GRAPHICS_API_OPENGL_33)
-    return OPENGL_33;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    return OPENGL_ES_20;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.stallTimeFrame = RLGL.State.stallTime;
+    RLGL.State.stallTime = 0.0;
+
+    RLGL.State.drawCallsRegisteredFrame = RLGL.State.drawCallsRegistered;
+    RLGL.State.drawCallsSubmittedFrame = RLGL.State.drawCallsSubmitted;
+    RLGL.State.drawCallsRegistered = 0;
+    RLGL.State.drawCallsSubmitted = 0;
 #endif
 }
 
-// Check internal buffer overflow for a given number of vertex
-bool rlCheckBufferLimit(int vCount)
+// Load a render batch (multi-buffered vertex buffers and draw calls tracking)
+// NOTE: bufferElements is the number of QUADS each vertex buffer can hold (4 vertex by element)
+RenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 {
-    bool overflow = false;
+    RenderBatch batch = { 0 };
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + vCount) >= (MAX_BATCH_ELEMENTS*4)) overflow = true;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Indices are 16bit on OpenGL ES 2.0, every buffer is limited to 65536 vertex
+    if (bufferElements > MAX_BATCH_ELEMENTS_LIMIT)
+    {
+        TRACELOG(LOG_WARNING, "Render batch elements limited to %i (16bit indices)", MAX_BATCH_ELEMENTS_LIMIT);
+        bufferElements = MAX_BATCH_ELEMENTS_LIMIT;
+    }
 #endif
-    return overflow;
-}
+    if (numBuffers < 1) numBuffers = 1;
+    if (bufferElements < 1) bufferElements = 1;
 
-// Set debug marker
-void rlSetDebugMarker(const char *text)
-{
-#if defined(GRAPHICS_API_OPENGL_33)
-    if (RLGL.ExtSupported.debugMarker) glInsertEventMarkerEXT(0, text);
+    // NOTE: If persistently mapped buffers are supported, vertex arrays are not allocated
+    // on CPU (RAM), they point directly to GPU-visible memory, mapped once on buffers creation
+    batch.mapped = RLGL.ExtSupported.bufferStorage;
+
+    // Initialize vertex buffers (CPU and GPU)
+    batch.buffersCount = numBuffers;
+    batch.vertexBuffer = (VertexBuffer *)RL_CALLOC(numBuffers, sizeof(VertexBuffer));
+
+    int mappedCount = 0;
+    for (int i = 0; i < numBuffers; i++)
+    {
+        LoadVertexBuffer(&batch.vertexBuffer[i], bufferElements, batch.mapped);
+        if (batch.vertexBuffer[i].mapped) mappedCount++;
+    }
+
+    if (mappedCount > 0) TRACELOG(LOG_INFO, "Render batch loaded successfully (%i buffers of %i elements, %i persistently mapped)", numBuffers, bufferElements, mappedCount);
+    else TRACELOG(LOG_INFO, "Render batch loaded successfully (%i buffers of %i elements)", numBuffers, bufferElements);
+
+    // Init draw calls tracking system
+    // NOTE: Draw calls array grows if required, no draw is forced when the initial size is reached
+    batch.drawsCapacity = MAX_DRAWCALL_REGISTERED;
+    batch.draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*batch.drawsCapacity);
+
+    for (int i = 0; i < batch.drawsCapacity; i++)
+    {
+        batch.draws[i].mode = RL_QUADS;
+        batch.draws[i].vertexCount = 0;
+        batch.draws[i].vertexAlignment = 0;
+        batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].shader = RLGL.State.currentShader;
+        batch.draws[i].blendMode = RLGL.State.currentBlendMode;
+        batch.draws[i].layer = RLGL.State.currentLayer;
+    }
+
+    batch.drawsCounter = 1;         // Reset draws counter
+    batch.currentDepth = -1.0f;     // Reset depth value
+    batch.elementsLimit = 0;        // No auto-grow by default, batch is drawn when full
 #endif
+
+    return batch;
 }
 
-// Load OpenGL extensions
-// NOTE: External loader function could be passed as a pointer
-void rlLoadExtensions(void *loader)
+// Unload render batch (vertex buffers from CPU and GPU, draw calls array)
+void rlUnloadRenderBatch(RenderBatch batch)
 {
-#if defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
-    #if !defined(__APPLE__)
-        if (!gladLoadGLLoader((GLADloadproc)loader)) TRACELOG(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
-        else TRACELOG(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Unbind everything
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(2);
+    glDisableVertexAttribArray(3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
-        #if defined(GRAPHICS_API_OPENGL_21)
-        if (GLAD_GL_VERSION_2_1) TRACELOG(LOG_INFO, "OpenGL 2.1 profile supported");
-        #elif defined(GRAPHICS_API_OPENGL_33)
-        if (GLAD_GL_VERSION_3_3) TRACELOG(LOG_INFO, "OpenGL 3.3 Core profile supported");
-        else TRACELOG(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
-        #endif
-    #endif
+    for (int i = 0; i < batch.buffersCount; i++) UnloadVertexBuffer(&batch.vertexBuffer[i]);
 
-    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
-    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+    RL_FREE(batch.vertexBuffer);
+    RL_FREE(batch.draws);
 #endif
 }
 
-// Get world coordinates from screen coordinates
-Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
+// Draw render batch data (update GPU buffers, draw registered calls and reset batch)
+// NOTE: Batch is drawn with current shader and current projection/modelview matrices
+void rlDrawRenderBatch(RenderBatch *batch)
 {
-    Vector3 result = { 0.0f, 0.0f, 0.0f };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Only process data if we have data to process
+    if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
+    {
+        VertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
-    Matrix matViewProj = MatrixMultiply(view, proj);
-    matViewProj = MatrixInvert(matViewProj);
+        // Update batch vertex buffers
+        //------------------------------------------------------------------------------------------------------------
+        // NOTE: Persistently mapped buffers are written directly by rlVertex*() functions,
+        // mapping is coherent, so no upload or flush is required before drawing
+        if (!buffer->mapped)
+        {
+            double startTime = RLGL_GET_TIME();
 
-    // Create quaternion from source point
-    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+            // Activate elements VAO
+            if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId);
 
-    // Multiply quat point by unproject matrix
-    quat = QuaternionTransform(quat, matViewProj);
+            // NOTE: Buffers are orphaned before being updated: glBufferData() with NULL pointer discards
+            // previous buffer storage, if GPU is still working with previous data, driver allocates
+            // a new storage and returns immediately instead of waiting (stall) for the GPU to finish
 
-    // Normalized world points in vectors
-    result.x = quat.x/quat.w;
-    result.y = quat.y/quat.w;
-    result.z = quat.z/quat.w;
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*buffer->elementsCount, NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*buffer->vCounter, buffer->vertices);
 
-    return result;
-}
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*buffer->elementsCount, NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*buffer->vCounter, buffer->texcoords);
 
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
-{
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*buffer->elementsCount, NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*buffer->vCounter, buffer->colors);
 
-    unsigned int id = 0;
+            // Unbind the current VAO
+            if (RLGL.ExtSupported.vao) glBindVertexArray(0);
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
-        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "DXT compressed texture format not supported");
-        return id;
-    }
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(LOG_WARNING, "ETC1 compressed texture format not supported");
-        return id;
-    }
+            RLGL.State.stallTime += (RLGL_GET_TIME() - startTime);
+        }
+        //------------------------------------------------------------------------------------------------------------
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "ETC2 compressed texture format not supported");
-        return id;
-    }
+        // Sort and merge draw calls by state (batch sorting mode)
+        // NOTE: Vertex data is not moved, an index buffer is generated with the sorted vertex ranges
+        int drawsCount = batch->drawsCounter;
+        if (RLGL.State.batchSorting) drawsCount = SortRenderBatch(batch);
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "PVRT compressed texture format not supported");
-        return id;
-    }
+        // Draw batch vertex buffers (considering VR stereo if required)
+        //------------------------------------------------------------------------------------------------------------
+        Matrix matProjection = RLGL.State.projection;
+        Matrix matModelView = RLGL.State.modelview;
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "ASTC compressed texture format not supported");
-        return id;
-    }
+        int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+        if (RLGL.Vr.stereoRender) eyesCount = 2;
 #endif
-#endif      // GRAPHICS_API_OPENGL_11
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (int eye = 0; eye < eyesCount; eye++)
+        {
+#if defined(SUPPORT_VR_SIMULATOR)
+            if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
+#endif
+            // Set current shader and upload current MVP matrix
+            glUseProgram(RLGL.State.currentShader.id);
 
-    glGenTextures(1, &id);              // Generate texture id
+            // Create modelview-projection matrix
+            Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
-#endif
+            glUniformMatrix4fv(RLGL.State.currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+            glUniform4f(RLGL.State.currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+            glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
 
-    glBindTexture(GL_TEXTURE_2D, id);
+            // TODO: Support additional texture units on custom shader
+            //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_SPECULAR], 1);
+            //if (RLGL.State.currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_NORMAL], 2);
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+            // NOTE: Right now additional map textures not considered for default buffers drawing
 
-    TRACELOGD("Load texture from data memory address: 0x%x", data);
+            int vertexOffset = 0;
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+            if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId);
+            else
+            {
+                // Bind vertex attrib: position (shader-location = 0)
+                glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+                // Bind vertex attrib: texcoord (shader-location = 1)
+                glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
 
-        TRACELOGD("Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+                // Bind vertex attrib: color (shader-location = 3)
+                glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
 
-        if (glInternalFormat != -1)
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+            }
+
+            glActiveTexture(GL_TEXTURE0);
+
+            if (RLGL.State.batchSorting)
+            {
+                // Draw sorted and merged draw calls, changing only the required states
+                // NOTE: Draw vertexCount and vertexOffset refer to the sorted indices buffer
+                unsigned int shaderId = RLGL.State.currentShader.id;
+                int blendMode = RLGL.State.currentBlendMode;
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.sortIndicesId);
+
+                for (int i = 0; i < drawsCount; i++)
+                {
+                    if (batch->draws[i].shader.id != shaderId)
+                    {
+                        glUseProgram(batch->draws[i].shader.id);
+                        glUniformMatrix4fv(batch->draws[i].shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+                        glUniform4f(batch->draws[i].shader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                        glUniform1i(batch->draws[i].shader.locs[LOC_MAP_DIFFUSE], 0);
+
+                        shaderId = batch->draws[i].shader.id;
+                    }
+
+                    if (batch->draws[i].blendMode != blendMode)
+                    {
+                        SetBlendMode(batch->draws[i].blendMode);
+                        blendMode = batch->draws[i].blendMode;
+                    }
+
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+#if defined(GRAPHICS_API_OPENGL_33)
+                    glDrawElements(batch->draws[i].mode, batch->draws[i].vertexCount, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*batch->draws[i].vertexOffset));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements(batch->draws[i].mode, batch->draws[i].vertexCount, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*batch->draws[i].vertexOffset));
+#endif
+                    RLGL.State.drawCallsSubmitted++;
+                }
+
+                // Restore current blending mode and quads indices buffer (stored in VAO state)
+                if (blendMode != RLGL.State.currentBlendMode) SetBlendMode(RLGL.State.currentBlendMode);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+            }
+            else for (int i = 0; i < batch->drawsCounter; i++)
+            {
+                if (batch->draws[i].vertexCount > 0)
+                {
+                    RLGL.State.drawCallsRegistered++;
+                    RLGL.State.drawCallsSubmitted++;
+                }
+
+                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+
+                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
+                //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
+                //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+
+                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                else
+                {
+#if defined(GRAPHICS_API_OPENGL_33)
+                    // We need to define the number of indices to be processed: quadsCount*6
+                    // NOTE: The final parameter tells the GPU the offset in bytes from the
+                    // start of the index buffer to the location of the first index to process
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
+#endif
+                }
+
+                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+            }
+
+            if (!RLGL.ExtSupported.vao)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            }
+
+            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+
+            if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+
+            glUseProgram(0);    // Unbind shader program
+        }
+
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+        // Register a fence after the draw calls reading current buffer,
+        // it will be checked before writing again into this buffer
+        if (buffer->mapped) buffer->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+        //------------------------------------------------------------------------------------------------------------
+
+        // Reset batch buffers
+        //------------------------------------------------------------------------------------------------------------
+        // Reset vertex counters for next frame
+        buffer->vCounter = 0;
+        buffer->tcCounter = 0;
+        buffer->cCounter = 0;
+
+        // Reset depth for next draw
+        batch->currentDepth = -1.0f;
+
+        // Restore projection/modelview matrices
+        RLGL.State.projection = matProjection;
+        RLGL.State.modelview = matModelView;
+
+        // Reset batch->draws array
+        for (int i = 0; i < batch->drawsCounter; i++)
+        {
+            batch->draws[i].mode = RL_QUADS;
+            batch->draws[i].vertexCount = 0;
+            batch->draws[i].vertexAlignment = 0;
+            batch->draws[i].textureId = RLGL.State.defaultTextureId;
+            batch->draws[i].shader = RLGL.State.currentShader;
+            batch->draws[i].blendMode = RLGL.State.currentBlendMode;
+            batch->draws[i].layer = RLGL.State.currentLayer;
+        }
+
+        batch->drawsCounter = 1;
+        //------------------------------------------------------------------------------------------------------------
+
+        // Change to next buffer in the list (in case of multi-buffering)
+        batch->currentBuffer++;
+        if (batch->currentBuffer >= batch->buffersCount) batch->currentBuffer = 0;
+
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+        // Wait for the GPU to finish reading next buffer before writing new vertex data into it
+        // NOTE: With enough buffers in the ring, the fence is usually already signaled and there is no wait
+        buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+        if (buffer->fence != NULL)
+        {
+            double startTime = RLGL_GET_TIME();
+
+            GLenum result = GL_TIMEOUT_EXPIRED;
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)buffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // Timeout: 1 ms
+
+            glDeleteSync((GLsync)buffer->fence);
+            buffer->fence = NULL;
+
+            RLGL.State.stallTime += (RLGL_GET_TIME() - startTime);
+        }
+#endif
+    }
+#endif
+}
+
+// Set the active render batch for rlgl (NULL for default internal batch)
+// NOTE: Current active batch is drawn before changing it
+void rlSetRenderBatchActive(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    if (batch != NULL) RLGL.currentBatch = batch;
+    else RLGL.currentBatch = &RLGL.defaultBatch;
+#endif
+}
+
+// Set render batch auto-grow limit (NULL for default internal batch)
+// NOTE: When a batch buffer gets full, all batch buffers grow up to elementsLimit instead of being drawn,
+// keeping all the frame data in a single draw, use 0 to disable auto-grow
+// NOTE: Persistently mapped buffers can not be read back, batch is drawn once before they grow
+void rlSetRenderBatchGrowLimit(RenderBatch *batch, int elementsLimit)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (elementsLimit > MAX_BATCH_ELEMENTS_LIMIT) elementsLimit = MAX_BATCH_ELEMENTS_LIMIT;
+#endif
+    if (batch != NULL) batch->elementsLimit = elementsLimit;
+    else RLGL.defaultBatch.elementsLimit = elementsLimit;
+#endif
+}
+
+// Enable batch sorting mode
+// NOTE: Shader, blending mode and layer changes do not draw the batch anymore, they are registered
+// with every draw call; on batch draw, draw calls are sorted by (layer, shader, texture, blending)
+// and consecutive draws sharing the same state are merged into a single GPU draw call.
+// Draws order is only kept by layer (and submission order for equal states), shader uniform values
+// are not registered per draw, last value set is used for all the draws using that shader
+void rlEnableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.batchSorting)
+    {
+        rlglDraw();
+        RLGL.State.batchSorting = true;
+    }
+#endif
+}
+
+// Disable batch sorting mode
+void rlDisableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting)
+    {
+        rlglDraw();
+        RLGL.State.batchSorting = false;
+    }
+#endif
+}
+
+// Set layer for next draws (batch sorting mode)
+// NOTE: Lower layers are drawn first, default layer is 0
+void rlSetBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentLayer != layer)
+    {
+        RLGL.State.currentLayer = layer;
+        if (RLGL.State.batchSorting) SetDrawCallState();
+    }
+#endif
+}
+
+// Returns current OpenGL version
+int rlGetVersion(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    return OPENGL_11;
+#elif defined(GRAPHICS_API_OPENGL_21)
+    #if defined(__APPLE__)
+        return OPENGL_33;       // NOTE: Force OpenGL 3.3 on OSX
+    #else
+        return OPENGL_21;
+    #endif
+#elif defined(GRAPHICS_API_OPENGL_33)
+    return OPENGL_33;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    return OPENGL_ES_20;
+#endif
+}
+
+// Check internal buffer overflow for a given number of vertex
+bool rlCheckBufferLimit(int vCount)
+{
+    bool overflow = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: If render batch supports auto-grow, buffer grows and no overflow is reported
+    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter + vCount) >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) overflow = !GrowRenderBatch(RLGL.currentBatch, vCount);
+#endif
+    return overflow;
+}
+
+// Get time spent uploading/waiting batch buffers on last frame (in seconds)
+// NOTE: It measures buffers update on CPU side and GPU sync waits when reusing a buffer
+double rlGetBatchStallTime(void)
+{
+    double time = 0.0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    time = RLGL.State.stallTimeFrame;
+#endif
+    return time;
+}
+
+// Get number of draw calls registered on last frame (before merging)
+int rlGetDrawCallsRegistered(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.State.drawCallsRegisteredFrame;
+#endif
+    return count;
+}
+
+// Get number of draw calls submitted to GPU on last frame (after merging)
+// NOTE: Only render batch draw calls are considered, meshes draws are not counted
+int rlGetDrawCallsSubmitted(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.State.drawCallsSubmittedFrame;
+#endif
+    return count;
+}
+
+// Set debug marker
+void rlSetDebugMarker(const char *text)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.debugMarker) glInsertEventMarkerEXT(0, text);
+#endif
+}
+
+// Load OpenGL extensions
+// NOTE: External loader function could be passed as a pointer
+void rlLoadExtensions(void *loader)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
+    #if !defined(__APPLE__)
+        if (!gladLoadGLLoader((GLADloadproc)loader)) TRACELOG(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
+        else TRACELOG(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+
+        #if defined(GRAPHICS_API_OPENGL_21)
+        if (GLAD_GL_VERSION_2_1) TRACELOG(LOG_INFO, "OpenGL 2.1 profile supported");
+        #elif defined(GRAPHICS_API_OPENGL_33)
+        if (GLAD_GL_VERSION_3_3) TRACELOG(LOG_INFO, "OpenGL 3.3 Core profile supported");
+        else TRACELOG(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
+        #endif
+    #endif
+
+    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
+    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+#endif
+}
+
+// Get world coordinates from screen coordinates
+Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
+{
+    Vector3 result = { 0.0f, 0.0f, 0.0f };
+
+    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
+    Matrix matViewProj = MatrixMultiply(view, proj);
+    matViewProj = MatrixInvert(matViewProj);
+
+    // Create quaternion from source point
+    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+
+    // Multiply quat point by unproject matrix
+    quat = QuaternionTransform(quat, matViewProj);
+
+    // Normalized world points in vectors
+    result.x = quat.x/quat.w;
+    result.y = quat.y/quat.w;
+    result.z = quat.z/quat.w;
+
+    return result;
+}
+
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+{
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    unsigned int id = 0;
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
+        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif      // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);              // Generate texture id
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
+#endif
+
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    TRACELOGD("Load texture from data memory address: 0x%x", data);
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TRACELOGD("Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != -1)
         {
             if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
         #if !defined(GRAPHICS_API_OPENGL_11)
@@ -2392,6 +3006,13 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
     mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
     mesh->vboId[6] = 0;     // Vertex indices VBO
 
+    // NOTE: Skinning data VBOs are only available if mesh contains bones data
+    if (mesh->boneIds != NULL)
+    {
+        mesh->vboId[7] = 0;     // Vertex bone ids VBO
+        mesh->vboId[8] = 0;     // Vertex bone weights VBO
+    }
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     int drawHint = GL_STATIC_DRAW;
     if (dynamic) drawHint = GL_DYNAMIC_DRAW;
@@ -2490,6 +3111,25 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, drawHint);
     }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Skinning vertex attributes: bone ids (shader-location = 11) and bone weights (shader-location = 12)
+    // NOTE: Bone ids are converted to float by OpenGL (not normalized)
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        glGenBuffers(1, &mesh->vboId[7]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[7]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(int)*4*mesh->vertexCount, mesh->boneIds, GL_STATIC_DRAW);
+        glVertexAttribPointer(11, 4, GL_INT, 0, 0, 0);
+        glEnableVertexAttribArray(11);
+
+        glGenBuffers(1, &mesh->vboId[8]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[8]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->boneWeights, GL_STATIC_DRAW);
+        glVertexAttribPointer(12, 4, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(12);
+    }
+#endif
+
     if (RLGL.ExtSupported.vao)
     {
         if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "[VAO ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
@@ -2649,169 +3289,101 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Bind shader program
-    glUseProgram(material.shader.id);
-
-    // Matrices and other values required by shader
-    //-----------------------------------------------------
-    // Calculate and send to shader model matrix (used by PBR shader)
-    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
-
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
-
-    // Upload to shader material.colSpecular (if available)
-    if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
-
-    if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], RLGL.State.modelview);
-    if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], RLGL.State.projection);
-
-    // At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matView = RLGL.State.modelview;         // View matrix (camera)
-    Matrix matProjection = RLGL.State.projection;  // Projection matrix (perspective)
-
-    // TODO: Consider possible transform matrices in the RLGL.State.stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = MatrixIdentity();
-    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(RLGL.State.stack[i], matStackTransform);
-
-    // Transform to camera-space coordinates
-    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(RLGL.State.transform, matView));
-    //-----------------------------------------------------
+    DrawMeshBuffers(mesh, material, transform, 0, false);
+#endif
+}
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+// Draw a 3d mesh multiple times with material and transforms
+// NOTE: GPU instancing is used if supported and material shader defines instanceTransform attribute
+// (default shader is replaced by default instancing shader), otherwise every instance is drawn separately,
+// instance color (optional) is multiplied by material diffuse color
+void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, Color *colors, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Skinned meshes are not drawn instanced (default instancing shader does not support skinning)
+    if ((count > 1) && RLGL.ExtSupported.instancing && (mesh.boneMatrices == NULL))
     {
-        if (material.maps[i].texture.id > 0)
-        {
-            glActiveTexture(GL_TEXTURE0 + i);
-            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+        if ((material.shader.id == RLGL.State.defaultShader.id) && (RLGL.State.instancingShader.id > 0)) material.shader = RLGL.State.instancingShader;
 
-            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
-        }
-    }
+        if (material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] != -1)
+        {
+            // Convert instance transforms to OpenGL matrices format (column-major)
+            if (RLGL.State.instanceCapacity < count)
+            {
+                RL_FREE(RLGL.State.instanceTransforms);
+                RLGL.State.instanceTransforms = (float16 *)RL_MALLOC(count*sizeof(float16));
+                RLGL.State.instanceCapacity = count;
+            }
 
-    // Bind vertex array objects (or VBOs)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
-    else
-    {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
+            for (int i = 0; i < count; i++) RLGL.State.instanceTransforms[i] = MatrixToFloatV(transforms[i]);
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
+            // Update instance data buffers
+            // NOTE: Buffers are orphaned, so the GPU can keep using previous data
+            if (RLGL.State.instanceBufferId[0] == 0) glGenBuffers(2, RLGL.State.instanceBufferId);
 
-        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
-        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
-        }
+            glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.instanceBufferId[0]);
+            glBufferData(GL_ARRAY_BUFFER, count*sizeof(float16), RLGL.State.instanceTransforms, GL_STREAM_DRAW);
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
+            if (colors != NULL)
             {
-                glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
-                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
+                glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.instanceBufferId[1]);
+                glBufferData(GL_ARRAY_BUFFER, count*sizeof(Color), colors, GL_STREAM_DRAW);
             }
-        }
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
-        }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
+            DrawMeshBuffers(mesh, material, MatrixIdentity(), count, (colors != NULL));
+            return;
         }
-
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
     }
-
-    int eyesCount = 1;
-#if defined(SUPPORT_VR_SIMULATOR)
-    if (RLGL.Vr.stereoRender) eyesCount = 2;
 #endif
 
-    for (int eye = 0; eye < eyesCount; eye++)
-    {
-        if (eyesCount == 1) RLGL.State.modelview = matModelView;
-        #if defined(SUPPORT_VR_SIMULATOR)
-        else SetStereoView(eye, matProjection, matModelView);
-        #endif
-
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);        // Transform to screen-space coordinates
-
-        // Send combined model-view-projection matrix to shader
-        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
-
-        // Draw call!
-        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
-        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
-    }
+    // Fallback: Draw every instance separately
+    Color color = material.maps[MAP_DIFFUSE].color;
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    for (int i = 0; i < count; i++)
     {
-        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+        if (colors != NULL)
+        {
+            material.maps[MAP_DIFFUSE].color.r = (unsigned char)((((float)color.r/255.0)*((float)colors[i].r/255.0))*255);
+            material.maps[MAP_DIFFUSE].color.g = (unsigned char)((((float)color.g/255.0)*((float)colors[i].g/255.0))*255);
+            material.maps[MAP_DIFFUSE].color.b = (unsigned char)((((float)color.b/255.0)*((float)colors[i].b/255.0))*255);
+            material.maps[MAP_DIFFUSE].color.a = (unsigned char)((((float)color.a/255.0)*((float)colors[i].a/255.0))*255);
+        }
+
+        rlDrawMesh(mesh, material, transforms[i]);
     }
+}
 
-    // Unind vertex array objects (or VBOs)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    else
+// Check if GPU skinning is supported for a shader and bones count
+// NOTE: Shader requires vertexBoneIds, vertexBoneWeights attributes and boneMatrices uniform,
+// default shader is supported through default skinning shader, bones count is limited by
+// GPU vertex uniform components (models with more bones use CPU skinning)
+bool rlCheckSkinningSupport(Shader shader, int boneCount)
+{
+    bool supported = false;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (boneCount <= RLGL.State.skinningMaxBones)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        if ((shader.id == RLGL.State.defaultShader.id) && (RLGL.State.skinningShader.id > 0)) supported = true;
+        else if ((shader.locs != NULL) &&
+                 (shader.locs[LOC_VERTEX_BONEIDS] != -1) &&
+                 (shader.locs[LOC_VERTEX_BONEWEIGHTS] != -1) &&
+                 (shader.locs[LOC_MATRIX_BONES] != -1)) supported = true;
     }
-
-    // Unbind shader program
-    glUseProgram(0);
-
-    // Restore RLGL.State.projection/RLGL.State.modelview matrices
-    // NOTE: In stereo rendering matrices are being modified to fit every eye
-    RLGL.State.projection = matProjection;
-    RLGL.State.modelview = matView;
 #endif
+    return supported;
 }
 
 // Unload mesh data from CPU and GPU
 void rlUnloadMesh(Mesh mesh)
 {
+    if (mesh.boneIds != NULL)
+    {
+        rlDeleteBuffers(mesh.vboId[7]);   // bone ids
+        rlDeleteBuffers(mesh.vboId[8]);   // bone weights
+    }
+
     RL_FREE(mesh.vertices);
     RL_FREE(mesh.texcoords);
     RL_FREE(mesh.normals);
@@ -2824,6 +3396,7 @@ void rlUnloadMesh(Mesh mesh)
     RL_FREE(mesh.animNormals);
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
 
     rlDeleteBuffers(mesh.vboId[0]);   // vertex
     rlDeleteBuffers(mesh.vboId[1]);   // texcoords
@@ -3082,8 +3655,10 @@ void BeginShaderMode(Shader shader)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShader.id != shader.id)
     {
-        rlglDraw();
+        // NOTE: On batch sorting mode, shader is registered with the draw calls, no draw required
+        if (!RLGL.State.batchSorting) rlglDraw();
         RLGL.State.currentShader = shader;
+        if (RLGL.State.batchSorting) SetDrawCallState();
     }
 #endif
 }
@@ -3540,22 +4115,27 @@ Texture2D GenTextureBRDF(Shader shader, int size)
 // NOTE: Only 3 blending modes supported, default blend mode is alpha
 void BeginBlendMode(int mode)
 {
+#if defined(GRAPHICS_API_OPENGL_11)
     static int blendMode = 0;   // Track current blending mode
 
     if ((blendMode != mode) && (mode < 3))
     {
-        rlglDraw();
+        SetBlendMode(mode);
+        blendMode = mode;
+    }
+#else
+    if ((RLGL.State.currentBlendMode != mode) && (mode < 3))
+    {
+        // NOTE: On batch sorting mode, blending mode is registered with the draw calls, no draw required,
+        // blending function is set anyway for non-batched draws (i.e. meshes)
+        if (!RLGL.State.batchSorting) rlglDraw();
 
-        switch (mode)
-        {
-            case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
-            case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
-            case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
-            default: break;
-        }
+        SetBlendMode(mode);
+        RLGL.State.currentBlendMode = mode;
 
-        blendMode = mode;
+        if (RLGL.State.batchSorting) SetDrawCallState();
     }
+#endif
 }
 
 // End blending mode (reset to default: alpha blending)
@@ -3779,8 +4359,7 @@ void EndVrDrawing(void)
         rlDisableTexture();
 
         // Update and draw render texture fbo with distortion to backbuffer
-        UpdateBuffersDefault();
-        DrawBuffersDefault();
+        rlDrawRenderBatch(RLGL.currentBatch);
 
         // Restore RLGL.State.defaultShader
         RLGL.State.currentShader = RLGL.State.defaultShader;
@@ -3857,6 +4436,23 @@ static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShad
     glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
     glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
 
+    // NOTE: Instancing attributes are only binded if supported and locations are available (OpenGL ES 2.0
+    // could support only 8 attributes), otherwise linker assigns them if used (locations are queried after linking)
+    if (RLGL.ExtSupported.instancing)
+    {
+        if (RLGL.ExtSupported.maxVertexAttribs >= 10) glBindAttribLocation(program, 6, DEFAULT_ATTRIB_INSTANCE_TRANSFORM_NAME);   // mat4 uses locations 6 to 9
+        if (RLGL.ExtSupported.maxVertexAttribs >= 11) glBindAttribLocation(program, 10, DEFAULT_ATTRIB_INSTANCE_COLOR_NAME);
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Skinning attributes only supported on OpenGL 3.3
+    if (RLGL.ExtSupported.maxVertexAttribs >= 13)
+    {
+        glBindAttribLocation(program, 11, DEFAULT_ATTRIB_BONEIDS_NAME);
+        glBindAttribLocation(program, 12, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
+    }
+#endif
+
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
     glLinkProgram(program);
@@ -3963,35 +4559,433 @@ static Shader LoadShaderDefault(void)
     "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
     "    finalColor = texelColor*colDiffuse*fragColor;        \n"
 #endif
-    "}                                  \n";
+    "}                                  \n";
+
+    // NOTE: Compiled vertex/fragment shaders are kept for re-use
+    RLGL.State.defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
+    RLGL.State.defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+    shader.id = LoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+
+    if (shader.id > 0)
+    {
+        TRACELOG(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+
+        // Set default shader locations: attributes locations
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+
+        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
+        // changed for external custom shaders, we just use direct bindings above
+        //SetShaderDefaultLocations(&shader);
+    }
+    else TRACELOG(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
+
+    return shader;
+}
+
+// Load default instancing shader
+// NOTE: Same as default shader but vertex are transformed and colored per-instance,
+// it's used to draw instanced meshes using default material
+static Shader LoadShaderInstancing(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *instancingVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute mat4 instanceTransform;  \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in mat4 instanceTransform;         \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor*instanceColor; \n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Default fragment shader is reused
+    RLGL.State.instancingVShaderId = CompileShader(instancingVShaderStr, GL_VERTEX_SHADER);
+
+    shader.id = LoadShaderProgram(RLGL.State.instancingVShaderId, RLGL.State.defaultFShaderId);
+
+    if (shader.id > 0)
+    {
+        TRACELOG(LOG_INFO, "[SHDR ID %i] Default instancing shader loaded successfully", shader.id);
+        SetShaderDefaultLocations(&shader);
+    }
+    else TRACELOG(LOG_WARNING, "[SHDR ID %i] Default instancing shader could not be loaded", shader.id);
+
+    return shader;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Load default skinning shader
+// NOTE: Same as default shader but vertex (and normals) are transformed by up to 4 bones (weighted)
+static Shader LoadShaderSkinning(void)
+{
+    Shader shader = { 0 };
+
+    // Bones array size is limited by vertex uniform components (OpenGL 3.3 only guarantees 1024),
+    // one mat4 requires 16 components, 64 components are kept for other uniforms (custom shaders)
+    int uniformComponents = 0;
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &uniformComponents);
+
+    RLGL.State.skinningMaxBones = (uniformComponents - 64)/16;
+    if (RLGL.State.skinningMaxBones > MAX_MESH_BONES) RLGL.State.skinningMaxBones = MAX_MESH_BONES;
+
+    if (RLGL.State.skinningMaxBones < 1)
+    {
+        RLGL.State.skinningMaxBones = 0;
+        TRACELOG(LOG_WARNING, "SHADER: Not enough vertex uniforms for GPU skinning, CPU skinning is used");
+
+        return shader;
+    }
+
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    // NOTE: Bones array size is set on shader loading, normals are skinned as CPU skinning does
+    // (fragNormal is not used by default fragment shader, custom skinning shaders can do the same)
+    const char *skinningVShaderFormat =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec3 vertexNormal;       \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec3 fragNormal;           \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec3 vertexNormal;              \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec3 fragNormal;               \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 boneMatrices[%i];     \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    mat4 skinMatrix = vertexBoneWeights.x*boneMatrices[int(vertexBoneIds.x)] + \n"
+    "                      vertexBoneWeights.y*boneMatrices[int(vertexBoneIds.y)] + \n"
+    "                      vertexBoneWeights.z*boneMatrices[int(vertexBoneIds.z)] + \n"
+    "                      vertexBoneWeights.w*boneMatrices[int(vertexBoneIds.w)];  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragNormal = normalize(vec3(skinMatrix*vec4(vertexNormal, 0.0))); \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*skinMatrix*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    char skinningVShaderStr[2048] = { 0 };
+    snprintf(skinningVShaderStr, sizeof(skinningVShaderStr), skinningVShaderFormat, RLGL.State.skinningMaxBones);
+
+    // NOTE: Default fragment shader is reused
+    RLGL.State.skinningVShaderId = CompileShader(skinningVShaderStr, GL_VERTEX_SHADER);
+
+    shader.id = LoadShaderProgram(RLGL.State.skinningVShaderId, RLGL.State.defaultFShaderId);
+
+    if (shader.id > 0)
+    {
+        TRACELOG(LOG_INFO, "[SHDR ID %i] Default skinning shader loaded successfully (%i bones)", shader.id, RLGL.State.skinningMaxBones);
+        SetShaderDefaultLocations(&shader);
+    }
+    else
+    {
+        RLGL.State.skinningMaxBones = 0;
+        TRACELOG(LOG_WARNING, "[SHDR ID %i] Default skinning shader could not be loaded", shader.id);
+    }
+
+    return shader;
+}
+#endif
+
+// Draw mesh buffers with material and transform
+// NOTE: If instances > 0, mesh is drawn instanced, per-instance transforms (and colors)
+// are read from instance data buffers and transform is applied to all instances
+static void DrawMeshBuffers(Mesh mesh, Material material, Matrix transform, int instances, bool instanceColors)
+{
+    // Skinned meshes using default shader are drawn with default skinning shader
+    if ((mesh.boneMatrices != NULL) && (material.shader.id == RLGL.State.defaultShader.id) && (RLGL.State.skinningShader.id > 0)) material.shader = RLGL.State.skinningShader;
+
+    // Bind shader program
+    glUseProgram(material.shader.id);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Upload bones transformation matrices (GPU skinning)
+    // NOTE: raylib matrices are stored row-major, they are transposed on upload
+    if ((mesh.boneMatrices != NULL) && (material.shader.locs[LOC_MATRIX_BONES] != -1))
+    {
+        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_BONES], (mesh.boneCount < RLGL.State.skinningMaxBones)? mesh.boneCount : RLGL.State.skinningMaxBones, GL_TRUE, (float *)mesh.boneMatrices);
+    }
+#endif
+
+    // Matrices and other values required by shader
+    //-----------------------------------------------------
+    // Calculate and send to shader model matrix (used by PBR shader)
+    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
+
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
+        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
+                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
+                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
+                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+
+    // Upload to shader material.colSpecular (if available)
+    if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
+        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
+                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
+                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
+                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
+
+    if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], RLGL.State.modelview);
+    if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], RLGL.State.projection);
+
+    // At this point the modelview matrix just contains the view matrix (camera)
+    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
+    Matrix matView = RLGL.State.modelview;         // View matrix (camera)
+    Matrix matProjection = RLGL.State.projection;  // Projection matrix (perspective)
+
+    // TODO: Consider possible transform matrices in the RLGL.State.stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = MatrixIdentity();
+    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(RLGL.State.stack[i], matStackTransform);
+
+    // Transform to camera-space coordinates
+    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(RLGL.State.transform, matView));
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            glActiveTexture(GL_TEXTURE0 + i);
+            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+
+            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
+        }
+    }
+
+    // Bind vertex array objects (or VBOs)
+    if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
+    else
+    {
+        // Bind mesh VBO data: vertex position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
+
+        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
+
+        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
+        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
+        }
+
+        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
+        {
+            if (mesh.vboId[3] != 0)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
+            }
+            else
+            {
+                // Set default value for unused attribute
+                // NOTE: Required when using default shader and no VAO support
+                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
+                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
+            }
+        }
+
+        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
+        }
+
+        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
+        }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Bind mesh VBO data: vertex bone ids and weights (shader-location = 11 and 12, if available)
+        if ((material.shader.locs[LOC_VERTEX_BONEIDS] != -1) && (mesh.boneIds != NULL))
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[7]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_BONEIDS], 4, GL_INT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_BONEIDS]);
+        }
+
+        if ((material.shader.locs[LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.boneWeights != NULL))
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[8]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_BONEWEIGHTS], 4, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_BONEWEIGHTS]);
+        }
+#endif
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    RLGL.State.defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+    }
 
-    shader.id = LoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    // Bind instance data: transforms (4 vec4 attributes, one per matrix column) and colors (if available)
+    // NOTE: Instance data buffers have been updated by rlDrawMeshInstanced()
+    if (instances > 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.instanceBufferId[0]);
+        for (int i = 0; i < 4; i++)
+        {
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] + i, 4, GL_FLOAT, 0, sizeof(float16), (void *)(i*4*sizeof(float)));
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] + i);
+            glVertexAttribDivisor(material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] + i, 1);
+        }
 
-    if (shader.id > 0)
+        if (material.shader.locs[LOC_VERTEX_INSTANCE_COLOR] != -1)
+        {
+            if (instanceColors)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.instanceBufferId[1]);
+                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR]);
+                glVertexAttribDivisor(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR], 1);
+            }
+            else
+            {
+                // Set default value for unused attribute
+                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
+                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR]);
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+    if (RLGL.Vr.stereoRender) eyesCount = 2;
+#endif
+
+    for (int eye = 0; eye < eyesCount; eye++)
     {
-        TRACELOG(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+        if (eyesCount == 1) RLGL.State.modelview = matModelView;
+        #if defined(SUPPORT_VR_SIMULATOR)
+        else SetStereoView(eye, matProjection, matModelView);
+        #endif
 
-        // Set default shader locations: attributes locations
-        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
-        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
-        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);        // Transform to screen-space coordinates
 
-        // Set default shader locations: uniform locations
-        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
-        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
-        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+        // Send combined model-view-projection matrix to shader
+        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
 
-        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
-        // changed for external custom shaders, we just use direct bindings above
-        //SetShaderDefaultLocations(&shader);
+        // Draw call!
+        if (instances > 0)
+        {
+            if (mesh.indices != NULL) glDrawElementsInstanced(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0, instances);
+            else glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.vertexCount, instances);
+        }
+        else if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
+        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
     }
-    else TRACELOG(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
 
-    return shader;
+    // Unbind all binded texture maps
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
+        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+    }
+
+    // Disable instance attributes
+    // NOTE: Attributes state is stored in mesh VAO, it must be restored for non-instanced draws
+    if (instances > 0)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            glVertexAttribDivisor(material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] + i, 0);
+            glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_INSTANCE_TRANSFORM] + i);
+        }
+
+        if (instanceColors && (material.shader.locs[LOC_VERTEX_INSTANCE_COLOR] != -1))
+        {
+            glVertexAttribDivisor(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR], 0);
+            glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_INSTANCE_COLOR]);
+        }
+    }
+
+    // Unind vertex array objects (or VBOs)
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    // Unbind shader program
+    glUseProgram(0);
+
+    // Restore RLGL.State.projection/RLGL.State.modelview matrices
+    // NOTE: In stereo rendering matrices are being modified to fit every eye
+    RLGL.State.projection = matProjection;
+    RLGL.State.modelview = matView;
 }
 
 // Get location handlers to for shader attributes and uniforms
@@ -4005,6 +4999,10 @@ static void SetShaderDefaultLocations(Shader *shader)
     //          vertex color location       = 3
     //          vertex tangent location     = 4
     //          vertex texcoord2 location   = 5
+    //          instance transform location = 6 (6..9, only if instancing supported)
+    //          instance color location     = 10 (only if instancing supported)
+    //          vertex bone ids location    = 11 (only OpenGL 3.3)
+    //          vertex bone weights location = 12 (only OpenGL 3.3)
 
     // Get handles to GLSL input attibute locations
     shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
@@ -4013,11 +5011,16 @@ static void SetShaderDefaultLocations(Shader *shader)
     shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
     shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
     shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
+    shader->locs[LOC_VERTEX_INSTANCE_TRANSFORM] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_INSTANCE_TRANSFORM_NAME);
+    shader->locs[LOC_VERTEX_INSTANCE_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_INSTANCE_COLOR_NAME);
+    shader->locs[LOC_VERTEX_BONEIDS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEIDS_NAME);
+    shader->locs[LOC_VERTEX_BONEWEIGHTS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
 
     // Get handles to GLSL uniform locations (vertex shader)
     shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
     shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
     shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+    shader->locs[LOC_MATRIX_BONES]  = glGetUniformLocation(shader->id, "boneMatrices");
 
     // Get handles to GLSL uniform locations (fragment shader)
     shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
@@ -4037,303 +5040,436 @@ static void UnloadShaderDefault(void)
     glDeleteShader(RLGL.State.defaultFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShader.id);
+
+    if (RLGL.State.instancingShader.id > 0)
+    {
+        glDetachShader(RLGL.State.instancingShader.id, RLGL.State.instancingVShaderId);
+        glDetachShader(RLGL.State.instancingShader.id, RLGL.State.defaultFShaderId);
+        glDeleteShader(RLGL.State.instancingVShaderId);
+
+        glDeleteProgram(RLGL.State.instancingShader.id);
+        RL_FREE(RLGL.State.instancingShader.locs);
+    }
+
+    if (RLGL.State.skinningShader.id > 0)
+    {
+        glDetachShader(RLGL.State.skinningShader.id, RLGL.State.skinningVShaderId);
+        glDetachShader(RLGL.State.skinningShader.id, RLGL.State.defaultFShaderId);
+        glDeleteShader(RLGL.State.skinningVShaderId);
+
+        glDeleteProgram(RLGL.State.skinningShader.id);
+        RL_FREE(RLGL.State.skinningShader.locs);
+    }
 }
 
-// Load default internal buffers
-static void LoadBuffersDefault(void)
+// Load vertex buffer data (CPU and GPU) for a render batch
+// NOTE: Vertex attributes are bound to default shader locations,
+// custom shaders use the same locations (set on LoadShaderProgram())
+static void LoadVertexBuffer(VertexBuffer *buffer, int elementsCount, bool mapped)
 {
+    buffer->elementsCount = elementsCount;
+    buffer->mapped = false;
+
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+    // NOTE: If mapping fails, buffer falls back to CPU arrays uploaded to orphaned buffers
+    if (mapped) buffer->mapped = MapVertexBuffer(buffer, elementsCount);
+#endif
+
     // Initialize CPU (RAM) arrays (vertex position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    if (!buffer->mapped)
     {
-        RLGL.State.vertexData[i].vertices = (float *)RL_MALLOC(sizeof(float)*3*4*MAX_BATCH_ELEMENTS);        // 3 float by vertex, 4 vertex by quad
-        RLGL.State.vertexData[i].texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*MAX_BATCH_ELEMENTS);       // 2 float by texcoord, 4 texcoord by quad
-        RLGL.State.vertexData[i].colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);  // 4 float by color, 4 colors by quad
+        buffer->vertices = (float *)RL_CALLOC(3*4*elementsCount, sizeof(float));                 // 3 float by vertex, 4 vertex by quad
+        buffer->texcoords = (float *)RL_CALLOC(2*4*elementsCount, sizeof(float));                // 2 float by texcoord, 4 texcoord by quad
+        buffer->colors = (unsigned char *)RL_CALLOC(4*4*elementsCount, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+    }
+
 #if defined(GRAPHICS_API_OPENGL_33)
-        RLGL.State.vertexData[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*MAX_BATCH_ELEMENTS);      // 6 int by quad (indices)
+    buffer->indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*elementsCount);      // 6 int by quad (indices)
 #elif defined(GRAPHICS_API_OPENGL_ES2)
-        RLGL.State.vertexData[i].indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*MAX_BATCH_ELEMENTS);  // 6 int by quad (indices)
+    buffer->indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*elementsCount);  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].colors[j] = 0;
-
-        int k = 0;
-
-        // Indices can be initialized right now
-        for (int j = 0; j < (6*MAX_BATCH_ELEMENTS); j += 6)
-        {
-            RLGL.State.vertexData[i].indices[j] = 4*k;
-            RLGL.State.vertexData[i].indices[j + 1] = 4*k + 1;
-            RLGL.State.vertexData[i].indices[j + 2] = 4*k + 2;
-            RLGL.State.vertexData[i].indices[j + 3] = 4*k;
-            RLGL.State.vertexData[i].indices[j + 4] = 4*k + 2;
-            RLGL.State.vertexData[i].indices[j + 5] = 4*k + 3;
-
-            k++;
-        }
+    int k = 0;
 
-        RLGL.State.vertexData[i].vCounter = 0;
-        RLGL.State.vertexData[i].tcCounter = 0;
-        RLGL.State.vertexData[i].cCounter = 0;
+    // Indices can be initialized right now
+    for (int j = 0; j < (6*elementsCount); j += 6)
+    {
+        buffer->indices[j] = 4*k;
+        buffer->indices[j + 1] = 4*k + 1;
+        buffer->indices[j + 2] = 4*k + 2;
+        buffer->indices[j + 3] = 4*k;
+        buffer->indices[j + 4] = 4*k + 2;
+        buffer->indices[j + 5] = 4*k + 3;
+
+        k++;
     }
 
-    TRACELOG(LOG_INFO, "Internal buffers initialized successfully (CPU)");
+    buffer->vCounter = 0;
+    buffer->tcCounter = 0;
+    buffer->cCounter = 0;
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
     //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    if (RLGL.ExtSupported.vao)
     {
-        if (RLGL.ExtSupported.vao)
-        {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &RLGL.State.vertexData[i].vaoId);
-            glBindVertexArray(RLGL.State.vertexData[i].vaoId);
-        }
+        // Initialize Quads VAO
+        glGenVertexArrays(1, &buffer->vaoId);
+        glBindVertexArray(buffer->vaoId);
+    }
+
+    // Quads - Vertex buffers binding and attributes enable
+    // Vertex position buffer (shader-location = 0)
+    if (!buffer->mapped)
+    {
+        glGenBuffers(1, &buffer->vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*elementsCount, buffer->vertices, GL_DYNAMIC_DRAW);
+    }
+    else glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glEnableVertexAttribArray(RLGL.State.defaultShader.locs[LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(RLGL.State.defaultShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &RLGL.State.vertexData[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &RLGL.State.vertexData[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &RLGL.State.vertexData[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-
-        // Fill index buffer
-        glGenBuffers(1, &RLGL.State.vertexData[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[3]);
+    // Vertex texcoord buffer (shader-location = 1)
+    if (!buffer->mapped)
+    {
+        glGenBuffers(1, &buffer->vboId[1]);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*elementsCount, buffer->texcoords, GL_DYNAMIC_DRAW);
+    }
+    else glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+    glEnableVertexAttribArray(RLGL.State.defaultShader.locs[LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(RLGL.State.defaultShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+    // Vertex color buffer (shader-location = 3)
+    if (!buffer->mapped)
+    {
+        glGenBuffers(1, &buffer->vboId[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*elementsCount, buffer->colors, GL_DYNAMIC_DRAW);
+    }
+    else glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+    glEnableVertexAttribArray(RLGL.State.defaultShader.locs[LOC_VERTEX_COLOR]);
+    glVertexAttribPointer(RLGL.State.defaultShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+    // Fill index buffer
+    glGenBuffers(1, &buffer->vboId[3]);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
 #if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].indices, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*elementsCount, buffer->indices, GL_STATIC_DRAW);
 #elif defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].indices, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*elementsCount, buffer->indices, GL_STATIC_DRAW);
 #endif
-    }
-
-    TRACELOG(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 }
 
-// Update default internal buffers (VAOs/VBOs) with vertex array data
-// NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-// TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-static void UpdateBuffersDefault(void)
+// Unload vertex buffer data from CPU and GPU
+static void UnloadVertexBuffer(VertexBuffer *buffer)
 {
-    // Update vertex buffers data
-    if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+    if (buffer->mapped)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.State.vertexData[RLGL.State.currentBuffer].vaoId);
+        if (buffer->fence != NULL) glDeleteSync((GLsync)buffer->fence);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+        // Unmap persistently mapped buffers before deleting them
+        for (int i = 0; i < 3; i++)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[i]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+#endif
 
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
+    // Delete VBOs from GPU (VRAM)
+    glDeleteBuffers(1, &buffer->vboId[0]);
+    glDeleteBuffers(1, &buffer->vboId[1]);
+    glDeleteBuffers(1, &buffer->vboId[2]);
+    glDeleteBuffers(1, &buffer->vboId[3]);
 
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // RLGL.State.vertexData[RLGL.State.currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (RLGL.State.vertexData[RLGL.State.currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+    // Delete VAOs from GPU (VRAM)
+    if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &buffer->vaoId);
 
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    // Free vertex arrays memory from CPU (RAM)
+    // NOTE: Persistently mapped arrays are GPU memory, already released with buffers
+    if (!buffer->mapped)
+    {
+        RL_FREE(buffer->vertices);
+        RL_FREE(buffer->texcoords);
+        RL_FREE(buffer->colors);
     }
+
+    RL_FREE(buffer->indices);
 }
 
-// Draw default internal buffers vertex data
-static void DrawBuffersDefault(void)
+// Grow vertex buffers of a render batch to fit vCount additional vertex on current buffer
+// NOTE: All buffers in the ring are grown together (same capacity), batched data is preserved,
+// buffers capacity is doubled until required size, up to batch limit
+// NOTE: Persistently mapped buffers are write-only (batched data can not be read back),
+// batch is drawn before growing and buffers grow empty
+static bool GrowRenderBatch(RenderBatch *batch, int vCount)
 {
-    Matrix matProjection = RLGL.State.projection;
-    Matrix matModelView = RLGL.State.modelview;
+    bool result = false;
 
-    int eyesCount = 1;
-#if defined(SUPPORT_VR_SIMULATOR)
-    if (RLGL.Vr.stereoRender) eyesCount = 2;
-#endif
+    VertexBuffer *current = &batch->vertexBuffer[batch->currentBuffer];
+    int requiredElements = (current->vCounter + vCount)/4 + 1;
 
-    for (int eye = 0; eye < eyesCount; eye++)
+    if (requiredElements <= batch->elementsLimit)
     {
-#if defined(SUPPORT_VR_SIMULATOR)
-        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
-#endif
+        int elementsCount = (current->elementsCount > 0)? current->elementsCount : 1;
+        while (elementsCount < requiredElements) elementsCount *= 2;
+        if (elementsCount > batch->elementsLimit) elementsCount = batch->elementsLimit;
 
-        // Draw buffers
-        if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
+        if (current->mapped && (current->vCounter > 0)) rlDrawRenderBatch(batch);
+
+        for (int i = 0; i < batch->buffersCount; i++)
         {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShader.id);
+            VertexBuffer *buffer = &batch->vertexBuffer[i];
 
-            // Create modelview-projection matrix
-            Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+            VertexBuffer grownBuffer = { 0 };
+            LoadVertexBuffer(&grownBuffer, elementsCount, batch->mapped);
 
-            glUniformMatrix4fv(RLGL.State.currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
-            glUniform4f(RLGL.State.currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
+            // Copy already batched vertex data into new buffer (only current not mapped buffer has data)
+            memcpy(grownBuffer.vertices, buffer->vertices, sizeof(float)*3*buffer->vCounter);
+            memcpy(grownBuffer.texcoords, buffer->texcoords, sizeof(float)*2*buffer->tcCounter);
+            memcpy(grownBuffer.colors, buffer->colors, sizeof(unsigned char)*4*buffer->cCounter);
 
-            // TODO: Support additional texture units on custom shader
-            //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_SPECULAR], 1);
-            //if (RLGL.State.currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_NORMAL], 2);
+            grownBuffer.vCounter = buffer->vCounter;
+            grownBuffer.tcCounter = buffer->tcCounter;
+            grownBuffer.cCounter = buffer->cCounter;
 
-            // NOTE: Right now additional map textures not considered for default buffers drawing
+            UnloadVertexBuffer(buffer);
+            *buffer = grownBuffer;
+        }
 
-            int vertexOffset = 0;
+        TRACELOG(LOG_DEBUG, "Render batch buffers grown to %i elements", elementsCount);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.State.vertexData[RLGL.State.currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
+        result = true;
+    }
 
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+    return result;
+}
 
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
+// Grow draw calls array of a render batch
+// NOTE: Draw calls are only tracked on CPU, no draw is required when array gets full
+static void GrowDrawCalls(RenderBatch *batch)
+{
+    DrawCall *draws = (DrawCall *)RL_REALLOC(batch->draws, sizeof(DrawCall)*batch->drawsCapacity*2);
 
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[3]);
-            }
+    if (draws != NULL)
+    {
+        for (int i = batch->drawsCapacity; i < batch->drawsCapacity*2; i++)
+        {
+            draws[i].mode = RL_QUADS;
+            draws[i].vertexCount = 0;
+            draws[i].vertexAlignment = 0;
+            draws[i].textureId = RLGL.State.defaultTextureId;
+        }
 
-            glActiveTexture(GL_TEXTURE0);
+        batch->draws = draws;
+        batch->drawsCapacity *= 2;
+    }
+    else rlDrawRenderBatch(batch);
+}
 
-            for (int i = 0; i < RLGL.State.drawsCounter; i++)
-            {
-                glBindTexture(GL_TEXTURE_2D, RLGL.State.draws[i].textureId);
+// Register current state (shader, blending mode, layer) on current batch draw call (batch sorting mode)
+// NOTE: If current draw call already contains vertex data, a new draw call is registered
+// keeping previous draw mode and texture
+static void SetDrawCallState(void)
+{
+    RenderBatch *batch = RLGL.currentBatch;
 
-                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
-                //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
-                //if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+    if (batch->draws[batch->drawsCounter - 1].vertexCount > 0)
+    {
+        // Align current draw vertex count to a multiple of 4 (see rlBegin())
+        if (batch->draws[batch->drawsCounter - 1].mode == RL_LINES) batch->draws[batch->drawsCounter - 1].vertexAlignment = ((batch->draws[batch->drawsCounter - 1].vertexCount < 4)? batch->draws[batch->drawsCounter - 1].vertexCount : batch->draws[batch->drawsCounter - 1].vertexCount%4);
+        else if (batch->draws[batch->drawsCounter - 1].mode == RL_TRIANGLES) batch->draws[batch->drawsCounter - 1].vertexAlignment = ((batch->draws[batch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (batch->draws[batch->drawsCounter - 1].vertexCount%4)));
+        else batch->draws[batch->drawsCounter - 1].vertexAlignment = 0;
 
-                if ((RLGL.State.draws[i].mode == RL_LINES) || (RLGL.State.draws[i].mode == RL_TRIANGLES)) glDrawArrays(RLGL.State.draws[i].mode, vertexOffset, RLGL.State.draws[i].vertexCount);
-                else
-                {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: quadsCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, RLGL.State.draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, RLGL.State.draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
-#endif
-                }
+        if (rlCheckBufferLimit(batch->draws[batch->drawsCounter - 1].vertexAlignment)) rlglDraw();
+        else
+        {
+            batch->vertexBuffer[batch->currentBuffer].vCounter += batch->draws[batch->drawsCounter - 1].vertexAlignment;
+            batch->vertexBuffer[batch->currentBuffer].cCounter += batch->draws[batch->drawsCounter - 1].vertexAlignment;
+            batch->vertexBuffer[batch->currentBuffer].tcCounter += batch->draws[batch->drawsCounter - 1].vertexAlignment;
 
-                vertexOffset += (RLGL.State.draws[i].vertexCount + RLGL.State.draws[i].vertexAlignment);
-            }
+            batch->drawsCounter++;
 
-            if (!RLGL.ExtSupported.vao)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-            }
+            if (batch->drawsCounter >= batch->drawsCapacity) GrowDrawCalls(batch);
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            batch->draws[batch->drawsCounter - 1].mode = batch->draws[batch->drawsCounter - 2].mode;
+            batch->draws[batch->drawsCounter - 1].textureId = batch->draws[batch->drawsCounter - 2].textureId;
+            batch->draws[batch->drawsCounter - 1].vertexCount = 0;
+            batch->draws[batch->drawsCounter - 1].vertexAlignment = 0;
         }
+    }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+    batch->draws[batch->drawsCounter - 1].shader = RLGL.State.currentShader;
+    batch->draws[batch->drawsCounter - 1].blendMode = RLGL.State.currentBlendMode;
+    batch->draws[batch->drawsCounter - 1].layer = RLGL.State.currentLayer;
+}
+
+// Sort batch draw calls by state and merge consecutive compatible draws (batch sorting mode)
+// NOTE: Sorted vertex ranges are written into an index buffer (QUADS and TRIANGLES are both drawn
+// as indexed triangles, so they can be merged), returns the number of merged draws,
+// merged draws are stored at the beginning of batch draws array
+static int SortRenderBatch(RenderBatch *batch)
+{
+    VertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-        glUseProgram(0);    // Unbind shader program
+    // Compute draws vertex offsets, also used as last sorting key (keeps submission order)
+    int vertexOffset = 0;
+    for (int i = 0; i < batch->drawsCounter; i++)
+    {
+        batch->draws[i].vertexOffset = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
     }
 
-    // Reset vertex counters for next frame
-    RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter = 0;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter = 0;
-    RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter = 0;
+    qsort(batch->draws, batch->drawsCounter, sizeof(DrawCall), CompareDrawCalls);
 
-    // Reset depth for next draw
-    RLGL.State.currentDepth = -1.0f;
+    // Check sorted indices array size, worst case is 6 indices per quad
+    if (RLGL.State.sortIndicesCapacity < 6*buffer->elementsCount)
+    {
+        RL_FREE(RLGL.State.sortIndices);
+        RLGL.State.sortIndicesCapacity = 6*buffer->elementsCount;
+        RLGL.State.sortIndices = RL_MALLOC(RLGL.State.sortIndicesCapacity*sizeof(RLGL.State.sortIndices[0]));
+    }
 
-    // Restore projection/modelview matrices
-    RLGL.State.projection = matProjection;
-    RLGL.State.modelview = matModelView;
+    int indicesCount = 0;
+    int drawsCount = 0;
 
-    // Reset RLGL.State.draws array
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+    for (int i = 0; i < batch->drawsCounter; i++)
     {
-        RLGL.State.draws[i].mode = RL_QUADS;
-        RLGL.State.draws[i].vertexCount = 0;
-        RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
+        DrawCall draw = batch->draws[i];    // NOTE: Merged draws overwrite batch draws array
+
+        if (draw.vertexCount == 0) continue;
+
+        RLGL.State.drawCallsRegistered++;
+
+        int firstIndex = indicesCount;
+
+        if (draw.mode == RL_QUADS)
+        {
+            for (int k = draw.vertexOffset; k < (draw.vertexOffset + draw.vertexCount/4*4); k += 4)
+            {
+                RLGL.State.sortIndices[indicesCount++] = k;
+                RLGL.State.sortIndices[indicesCount++] = k + 1;
+                RLGL.State.sortIndices[indicesCount++] = k + 2;
+                RLGL.State.sortIndices[indicesCount++] = k;
+                RLGL.State.sortIndices[indicesCount++] = k + 2;
+                RLGL.State.sortIndices[indicesCount++] = k + 3;
+            }
+
+            draw.mode = RL_TRIANGLES;
+        }
+        else for (int k = draw.vertexOffset; k < (draw.vertexOffset + draw.vertexCount); k++) RLGL.State.sortIndices[indicesCount++] = k;
+
+        // Merge with previous draw if state is the same
+        if ((drawsCount > 0) &&
+            (batch->draws[drawsCount - 1].mode == draw.mode) &&
+            (batch->draws[drawsCount - 1].shader.id == draw.shader.id) &&
+            (batch->draws[drawsCount - 1].textureId == draw.textureId) &&
+            (batch->draws[drawsCount - 1].blendMode == draw.blendMode)) batch->draws[drawsCount - 1].vertexCount += (indicesCount - firstIndex);
+        else
+        {
+            draw.vertexOffset = firstIndex;
+            draw.vertexCount = indicesCount - firstIndex;
+            batch->draws[drawsCount] = draw;
+            drawsCount++;
+        }
     }
 
-    RLGL.State.drawsCounter = 1;
+    // Upload sorted indices
+    // NOTE: Indices are uploaded through GL_ARRAY_BUFFER target to avoid modifying any VAO state
+    if (RLGL.State.sortIndicesId == 0) glGenBuffers(1, &RLGL.State.sortIndicesId);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.sortIndicesId);
+    glBufferData(GL_ARRAY_BUFFER, indicesCount*sizeof(RLGL.State.sortIndices[0]), RLGL.State.sortIndices, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Change to next buffer in the list
-    RLGL.State.currentBuffer++;
-    if (RLGL.State.currentBuffer >= MAX_BATCH_BUFFERING) RLGL.State.currentBuffer = 0;
+    return drawsCount;
 }
 
-// Unload default internal buffers vertex data from CPU and GPU
-static void UnloadBuffersDefault(void)
+// Compare draw calls by state key: layer, shader, texture, blending mode, draw mode
+// NOTE: Vertex offset is used as last key, making the sort stable (submission order is kept)
+static int CompareDrawCalls(const void *a, const void *b)
 {
-    // Unbind everything
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(2);
-    glDisableVertexAttribArray(3);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    const DrawCall *drawA = (const DrawCall *)a;
+    const DrawCall *drawB = (const DrawCall *)b;
 
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    if (drawA->layer != drawB->layer) return (drawA->layer < drawB->layer)? -1 : 1;
+    if (drawA->shader.id != drawB->shader.id) return (drawA->shader.id < drawB->shader.id)? -1 : 1;
+    if (drawA->textureId != drawB->textureId) return (drawA->textureId < drawB->textureId)? -1 : 1;
+    if (drawA->blendMode != drawB->blendMode) return (drawA->blendMode < drawB->blendMode)? -1 : 1;
+    if ((drawA->mode == RL_LINES) != (drawB->mode == RL_LINES)) return (drawA->mode == RL_LINES)? 1 : -1;
+
+    return (drawA->vertexOffset < drawB->vertexOffset)? -1 : 1;
+}
+
+#if defined(RLGL_BUFFER_STORAGE_AVAILABLE)
+// Create vertex buffers (position, texcoord, color) with immutable storage and map them persistently
+// NOTE: Storage can not be reallocated, if any mapping fails, buffers are deleted to be created again without mapping
+static bool MapVertexBuffer(VertexBuffer *buffer, int elementsCount)
+{
+    int sizes[3] = { sizeof(float)*3*4*elementsCount, sizeof(float)*2*4*elementsCount, sizeof(unsigned char)*4*4*elementsCount };
+    void *data[3] = { NULL };
+    bool result = true;
+
+    glGenBuffers(3, buffer->vboId);
+
+    for (int i = 0; result && (i < 3); i++)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[i]);
+        data[i] = MapBufferPersistent(GL_ARRAY_BUFFER, sizes[i]);
+        result = (data[i] != NULL);
+    }
+
+    if (result)
+    {
+        buffer->vertices = (float *)data[0];
+        buffer->texcoords = (float *)data[1];
+        buffer->colors = (unsigned char *)data[2];
+    }
+    else
     {
-        // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[0]);
-        glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[1]);
-        glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[2]);
-        glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[3]);
+        for (int i = 0; i < 3; i++)
+        {
+            if (data[i] == NULL) continue;
+
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[i]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
 
-        // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &RLGL.State.vertexData[i].vaoId);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDeleteBuffers(3, buffer->vboId);
+        for (int i = 0; i < 3; i++) buffer->vboId[i] = 0;
 
-        // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(RLGL.State.vertexData[i].vertices);
-        RL_FREE(RLGL.State.vertexData[i].texcoords);
-        RL_FREE(RLGL.State.vertexData[i].colors);
-        RL_FREE(RLGL.State.vertexData[i].indices);
+        TRACELOG(LOG_WARNING, "Render batch buffer could not be persistently mapped, using orphaned buffers");
     }
+
+    return result;
+}
+
+// Create immutable storage for currently bound buffer and map it persistently
+// NOTE: Mapping is coherent, CPU writes are visible to the GPU without explicit flush,
+// mapping is write-only, it could be uncached memory (vertex data is never read back)
+static void *MapBufferPersistent(unsigned int target, int size)
+{
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glBufferStorage(target, size, NULL, flags);
+    void *data = glMapBufferRange(target, 0, size, flags);
+
+    if (data != NULL) memset(data, 0, size);
+
+    return data;
 }
+#endif
 
 // Renders a 1x1 XY quad in NDC
 static void GenDrawQuad(void)
@@ -4469,6 +5605,18 @@ static void SetStereoView(int eye, Matrix matProjection, Matrix matModelView)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Set blending function for a blending mode
+static void SetBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+        case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
+        case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
+        default: break;
+    }
+}
+
 #if defined(GRAPHICS_API_OPENGL_11)
 // Mipmaps data is generated after image data
 // NOTE: Only works with RGBA (4 bytes) data!
@@ -89,7 +89,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Font asynchronous loading data, atlas generated on a loader thread is uploaded on main thread
+typedef struct FontAsset {
+    Font font;                      // Font data (texture uploaded from atlas)
+    Image atlas;                    // Font atlas image (unloaded once uploaded)
+} FontAsset;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -108,8 +112,18 @@ static Font defaultFont = { 0 };    // Default font provided by raylib
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_FNT)
-static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
+static Font LoadBMFont(const char *fileName, Image *atlas);     // Load a BMFont file (AngelCode font file), atlas not uploaded
 #endif
+static Font LoadFontAtlas(const char *fileName, Image *atlas);  // Load font data and atlas image from file (CPU only)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static Font LoadFontExAtlas(const char *fileName, int fontSize, int *fontChars, int charsCount, Image *atlas);   // Load TTF font data and generate atlas image (CPU only)
+#endif
+static Font LoadFontFromImageAtlas(Image image, Color key, int firstChar, Image *atlas);    // Load image font data and processed atlas image (CPU only)
+static Font UploadFontAtlas(const char *fileName, Font font, Image atlas);  // Upload font atlas into font texture, default font if not loaded
+
+static bool DecodeFontAsset(void *asset, const char *fileName);     // Load font asset data and atlas (loader thread)
+static bool UploadFontAsset(void *asset, const char *fileName);     // Upload font asset atlas into GPU memory (main thread)
+static void UnloadFontAsset(void *asset);                           // Unload font asset not retrieved
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -295,35 +309,10 @@ Font GetFontDefault()
 // Load Font from file into GPU memory (VRAM)
 Font LoadFont(const char *fileName)
 {
-    // Default hardcoded values for ttf file loading
-    #define DEFAULT_TTF_FONTSIZE    32      // Font first character (32 - space)
-    #define DEFAULT_TTF_NUMCHARS    95      // ASCII 32..126 is 95 glyphs
-    #define DEFAULT_FIRST_CHAR      32      // Expected first char for image sprite font
-
-    Font font = { 0 };
-
-#if defined(SUPPORT_FILEFORMAT_TTF)
-    if (IsFileExtension(fileName, ".ttf;.otf")) font = LoadFontEx(fileName, DEFAULT_TTF_FONTSIZE, NULL, DEFAULT_TTF_NUMCHARS);
-    else
-#endif
-#if defined(SUPPORT_FILEFORMAT_FNT)
-    if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
-    else
-#endif
-    {
-        Image image = LoadImage(fileName);
-        if (image.data != NULL) font = LoadFontFromImage(image, MAGENTA, DEFAULT_FIRST_CHAR);
-        UnloadImage(image);
-    }
-
-    if (font.texture.id == 0)
-    {
-        TRACELOG(LOG_WARNING, "[%s] Font could not be loaded, using default font", fileName);
-        font = GetFontDefault();
-    }
-    else SetTextureFilter(font.texture, FILTER_POINT);    // By default we set point filter (best performance)
+    Image atlas = { 0 };
+    Font font = LoadFontAtlas(fileName, &atlas);
 
-    return font;
+    return UploadFontAtlas(fileName, font, atlas);
 }
 
 // Load Font from TTF font file with generation parameters
@@ -334,22 +323,12 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
     Font font = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
-    font.baseSize = fontSize;
-    font.charsCount = (charsCount > 0)? charsCount : 95;
-    font.chars = LoadFontData(fileName, font.baseSize, fontChars, font.charsCount, FONT_DEFAULT);
+    Image atlas = { 0 };
+    font = LoadFontExAtlas(fileName, fontSize, fontChars, charsCount, &atlas);
 
     if (font.chars != NULL)
     {
-        Image atlas = GenImageFontAtlas(font.chars, &font.recs, font.charsCount, font.baseSize, 2, 0);
         font.texture = LoadTextureFromImage(atlas);
-
-        // Update chars[i].image to use alpha, required to be used on ImageDrawText()
-        for (int i = 0; i < font.charsCount; i++)
-        {
-            UnloadImage(font.chars[i].image);
-            font.chars[i].image = ImageFromImage(atlas, font.recs[i]);
-        }
-
         UnloadImage(atlas);
     }
     else font = GetFontDefault();
@@ -363,122 +342,31 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
 // Load an Image font file (XNA style)
 Font LoadFontFromImage(Image image, Color key, int firstChar)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
-    int charSpacing = 0;
-    int lineSpacing = 0;
-
-    int x = 0;
-    int y = 0;
-
-    // Default number of characters supported
-    #define MAX_FONTCHARS          256
-
-    // We allocate a temporal arrays for chars data measures,
-    // once we get the actual number of chars, we copy data to a sized arrays
-    int tempCharValues[MAX_FONTCHARS];
-    Rectangle tempCharRecs[MAX_FONTCHARS];
-
-    Color *pixels = GetImageData(image);
-
-    // Parse image data to get charSpacing and lineSpacing
-    for (y = 0; y < image.height; y++)
-    {
-        for (x = 0; x < image.width; x++)
-        {
-            if (!COLOR_EQUAL(pixels[y*image.width + x], key)) break;
-        }
-
-        if (!COLOR_EQUAL(pixels[y*image.width + x], key)) break;
-    }
-
-    charSpacing = x;
-    lineSpacing = y;
-
-    int charHeight = 0;
-    int j = 0;
-
-    while (!COLOR_EQUAL(pixels[(lineSpacing + j)*image.width + charSpacing], key)) j++;
-
-    charHeight = j;
-
-    // Check array values to get characters: value, x, y, w, h
-    int index = 0;
-    int lineToRead = 0;
-    int xPosToRead = charSpacing;
-
-    // Parse image data to get rectangle sizes
-    while ((lineSpacing + lineToRead*(charHeight + lineSpacing)) < image.height)
-    {
-        while ((xPosToRead < image.width) &&
-              !COLOR_EQUAL((pixels[(lineSpacing + (charHeight+lineSpacing)*lineToRead)*image.width + xPosToRead]), key))
-        {
-            tempCharValues[index] = firstChar + index;
-
-            tempCharRecs[index].x = (float)xPosToRead;
-            tempCharRecs[index].y = (float)(lineSpacing + lineToRead*(charHeight + lineSpacing));
-            tempCharRecs[index].height = (float)charHeight;
-
-            int charWidth = 0;
-
-            while (!COLOR_EQUAL(pixels[(lineSpacing + (charHeight+lineSpacing)*lineToRead)*image.width + xPosToRead + charWidth], key)) charWidth++;
-
-            tempCharRecs[index].width = (float)charWidth;
-
-            index++;
-
-            xPosToRead += (charWidth + charSpacing);
-        }
-
-        lineToRead++;
-        xPosToRead = charSpacing;
-    }
-
-    TRACELOGD("Font data parsed correctly from image");
-
-    // NOTE: We need to remove key color borders from image to avoid weird
-    // artifacts on texture scaling when using FILTER_BILINEAR or FILTER_TRILINEAR
-    for (int i = 0; i < image.height*image.width; i++) if (COLOR_EQUAL(pixels[i], key)) pixels[i] = BLANK;
-
-    // Create a new image with the processed color data (key color replaced by BLANK)
-    Image fontClear = LoadImageEx(pixels, image.width, image.height);
-
-    RL_FREE(pixels);    // Free pixels array memory
-
-    // Create spritefont with all data parsed from image
-    Font font = { 0 };
-
-    font.texture = LoadTextureFromImage(fontClear); // Convert processed image to OpenGL texture
-    font.charsCount = index;
-
-    // We got tempCharValues and tempCharsRecs populated with chars data
-    // Now we move temp data to sized charValues and charRecs arrays
-    font.chars = (CharInfo *)RL_MALLOC(font.charsCount*sizeof(CharInfo));
-    font.recs = (Rectangle *)RL_MALLOC(font.charsCount*sizeof(Rectangle));
-
-    for (int i = 0; i < font.charsCount; i++)
-    {
-        font.chars[i].value = tempCharValues[i];
-
-        // Get character rectangle in the font atlas texture
-        font.recs[i] = tempCharRecs[i];
+    Image atlas = { 0 };
+    Font font = LoadFontFromImageAtlas(image, key, firstChar, &atlas);
 
-        // NOTE: On image based fonts (XNA style), character offsets and xAdvance are not required (set to 0)
-        font.chars[i].offsetX = 0;
-        font.chars[i].offsetY = 0;
-        font.chars[i].advanceX = 0;
+    font.texture = LoadTextureFromImage(atlas);     // Convert processed image to OpenGL texture
+    UnloadImage(atlas);
 
-        // Fill character image data from fontClear data
-        font.chars[i].image = ImageFromImage(fontClear, tempCharRecs[i]);
-    }
+    return font;
+}
 
-    UnloadImage(fontClear);     // Unload processed image once converted to texture
+// Request font loading on background, returns asset handle
+// NOTE: Font data and atlas are generated on a loader thread, atlas texture is uploaded by PollAssetLoads()
+unsigned int LoadFontAsync(const char *fileName)
+{
+    return RequestAssetLoad(fileName, ASSET_TYPE_FONT, NULL, sizeof(FontAsset), DecodeFontAsset, UploadFontAsset, UnloadFontAsset);
+}
 
-    font.baseSize = (int)font.recs[0].height;
+// Get loaded font and release asset handle
+// NOTE: Returns default font if asset is not loaded yet (handle is kept) or loading failed, like LoadFont()
+Font GetAssetFont(unsigned int asset)
+{
+    FontAsset data = { 0 };
 
-    TRACELOG(LOG_INFO, "Image file loaded correctly as Font");
+    if (!TakeAssetData(asset, ASSET_TYPE_FONT, &data, sizeof(FontAsset))) data.font = GetFontDefault();
 
-    return font;
+    return data.font;
 }
 
 // Load font data for further use
@@ -1638,7 +1526,8 @@ RLAPI const char *CodepointToUtf8(int codepoint, int *byteLength)
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_FNT)
 // Load a BMFont file (AngelCode font file)
-static Font LoadBMFont(const char *fileName)
+// NOTE: Font atlas image is returned to be uploaded by caller
+static Font LoadBMFont(const char *fileName, Image *atlas)
 {
     #define MAX_BUFFER_SIZE     256
 
@@ -1718,8 +1607,6 @@ static Font LoadBMFont(const char *fileName)
         for (int p = 0; p < (imFont.width*imFont.height*2); p += 2) ((unsigned char *)(imFont.data))[p] = 0xff;
     }
 
-    font.texture = LoadTextureFromImage(imFont);
-
     RL_FREE(texPath);
 
     // Fill font characters info data
@@ -1749,17 +1636,246 @@ static Font LoadBMFont(const char *fileName)
         font.chars[i].image = ImageFromImage(imFont, font.recs[i]);
     }
 
-    UnloadImage(imFont);
-
     fclose(fntFile);
 
+    if (imFont.data == NULL)
+    {
+        for (int i = 0; i < font.charsCount; i++) UnloadImage(font.chars[i].image);
+        RL_FREE(font.chars);
+        RL_FREE(font.recs);
+
+        font = (Font){ 0 };
+    }
+    else
+    {
+        *atlas = imFont;
+        TRACELOG(LOG_INFO, "[%s] Font loaded successfully", fileName);
+    }
+
+    return font;
+}
+#endif
+
+// Load font data and atlas image from file (CPU only)
+// NOTE: Font texture is not loaded, atlas must be uploaded with UploadFontAtlas()
+static Font LoadFontAtlas(const char *fileName, Image *atlas)
+{
+    // Default hardcoded values for ttf file loading
+    #define DEFAULT_TTF_FONTSIZE    32      // Font first character (32 - space)
+    #define DEFAULT_TTF_NUMCHARS    95      // ASCII 32..126 is 95 glyphs
+    #define DEFAULT_FIRST_CHAR      32      // Expected first char for image sprite font
+
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (IsFileExtension(fileName, ".ttf;.otf")) font = LoadFontExAtlas(fileName, DEFAULT_TTF_FONTSIZE, NULL, DEFAULT_TTF_NUMCHARS, atlas);
+    else
+#endif
+#if defined(SUPPORT_FILEFORMAT_FNT)
+    if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName, atlas);
+    else
+#endif
+    {
+        Image image = LoadImage(fileName);
+        if (image.data != NULL) font = LoadFontFromImageAtlas(image, MAGENTA, DEFAULT_FIRST_CHAR, atlas);
+        UnloadImage(image);
+    }
+
+    return font;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load TTF font data and generate atlas image (CPU only)
+static Font LoadFontExAtlas(const char *fileName, int fontSize, int *fontChars, int charsCount, Image *atlas)
+{
+    Font font = { 0 };
+
+    font.baseSize = fontSize;
+    font.charsCount = (charsCount > 0)? charsCount : 95;
+    font.chars = LoadFontData(fileName, font.baseSize, fontChars, font.charsCount, FONT_DEFAULT);
+
+    if (font.chars != NULL)
+    {
+        *atlas = GenImageFontAtlas(font.chars, &font.recs, font.charsCount, font.baseSize, 2, 0);
+
+        // Update chars[i].image to use alpha, required to be used on ImageDrawText()
+        for (int i = 0; i < font.charsCount; i++)
+        {
+            UnloadImage(font.chars[i].image);
+            font.chars[i].image = ImageFromImage(*atlas, font.recs[i]);
+        }
+    }
+    else font = (Font){ 0 };
+
+    return font;
+}
+#endif
+
+// Load an Image font file (XNA style) data and processed atlas image (CPU only)
+static Font LoadFontFromImageAtlas(Image image, Color key, int firstChar, Image *atlas)
+{
+    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+
+    int charSpacing = 0;
+    int lineSpacing = 0;
+
+    int x = 0;
+    int y = 0;
+
+    // Default number of characters supported
+    #define MAX_FONTCHARS          256
+
+    // We allocate a temporal arrays for chars data measures,
+    // once we get the actual number of chars, we copy data to a sized arrays
+    int tempCharValues[MAX_FONTCHARS];
+    Rectangle tempCharRecs[MAX_FONTCHARS];
+
+    Color *pixels = GetImageData(image);
+
+    // Parse image data to get charSpacing and lineSpacing
+    for (y = 0; y < image.height; y++)
+    {
+        for (x = 0; x < image.width; x++)
+        {
+            if (!COLOR_EQUAL(pixels[y*image.width + x], key)) break;
+        }
+
+        if (!COLOR_EQUAL(pixels[y*image.width + x], key)) break;
+    }
+
+    charSpacing = x;
+    lineSpacing = y;
+
+    int charHeight = 0;
+    int j = 0;
+
+    while (!COLOR_EQUAL(pixels[(lineSpacing + j)*image.width + charSpacing], key)) j++;
+
+    charHeight = j;
+
+    // Check array values to get characters: value, x, y, w, h
+    int index = 0;
+    int lineToRead = 0;
+    int xPosToRead = charSpacing;
+
+    // Parse image data to get rectangle sizes
+    while ((lineSpacing + lineToRead*(charHeight + lineSpacing)) < image.height)
+    {
+        while ((xPosToRead < image.width) &&
+              !COLOR_EQUAL((pixels[(lineSpacing + (charHeight+lineSpacing)*lineToRead)*image.width + xPosToRead]), key))
+        {
+            tempCharValues[index] = firstChar + index;
+
+            tempCharRecs[index].x = (float)xPosToRead;
+            tempCharRecs[index].y = (float)(lineSpacing + lineToRead*(charHeight + lineSpacing));
+            tempCharRecs[index].height = (float)charHeight;
+
+            int charWidth = 0;
+
+            while (!COLOR_EQUAL(pixels[(lineSpacing + (charHeight+lineSpacing)*lineToRead)*image.width + xPosToRead + charWidth], key)) charWidth++;
+
+            tempCharRecs[index].width = (float)charWidth;
+
+            index++;
+
+            xPosToRead += (charWidth + charSpacing);
+        }
+
+        lineToRead++;
+        xPosToRead = charSpacing;
+    }
+
+    TRACELOGD("Font data parsed correctly from image");
+
+    // NOTE: We need to remove key color borders from image to avoid weird
+    // artifacts on texture scaling when using FILTER_BILINEAR or FILTER_TRILINEAR
+    for (int i = 0; i < image.height*image.width; i++) if (COLOR_EQUAL(pixels[i], key)) pixels[i] = BLANK;
+
+    // Create a new image with the processed color data (key color replaced by BLANK)
+    Image fontClear = LoadImageEx(pixels, image.width, image.height);
+
+    RL_FREE(pixels);    // Free pixels array memory
+
+    // Create spritefont with all data parsed from image
+    Font font = { 0 };
+
+    font.charsCount = index;
+
+    // We got tempCharValues and tempCharsRecs populated with chars data
+    // Now we move temp data to sized charValues and charRecs arrays
+    font.chars = (CharInfo *)RL_MALLOC(font.charsCount*sizeof(CharInfo));
+    font.recs = (Rectangle *)RL_MALLOC(font.charsCount*sizeof(Rectangle));
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        font.chars[i].value = tempCharValues[i];
+
+        // Get character rectangle in the font atlas texture
+        font.recs[i] = tempCharRecs[i];
+
+        // NOTE: On image based fonts (XNA style), character offsets and xAdvance are not required (set to 0)
+        font.chars[i].offsetX = 0;
+        font.chars[i].offsetY = 0;
+        font.chars[i].advanceX = 0;
+
+        // Fill character image data from fontClear data
+        font.chars[i].image = ImageFromImage(fontClear, tempCharRecs[i]);
+    }
+
+    *atlas = fontClear;         // Processed image is converted to texture by caller
+
+    font.baseSize = (int)font.recs[0].height;
+
+    TRACELOG(LOG_INFO, "Image file loaded correctly as Font");
+
+    return font;
+}
+
+// Upload font atlas image into font texture, atlas is unloaded
+// NOTE: Default font is returned if font could not be loaded
+static Font UploadFontAtlas(const char *fileName, Font font, Image atlas)
+{
+    if (atlas.data != NULL) font.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
     if (font.texture.id == 0)
     {
-        UnloadFont(font);
+        TRACELOG(LOG_WARNING, "[%s] Font could not be loaded, using default font", fileName);
+
+        if (font.chars != NULL) UnloadFont(font);
         font = GetFontDefault();
     }
-    else TRACELOG(LOG_INFO, "[%s] Font loaded successfully", fileName);
+    else SetTextureFilter(font.texture, FILTER_POINT);    // By default we set point filter (best performance)
 
     return font;
 }
-#endif
+
+// Load font asset data and atlas (loader thread)
+static bool DecodeFontAsset(void *asset, const char *fileName)
+{
+    FontAsset *data = (FontAsset *)asset;
+
+    data->font = LoadFontAtlas(fileName, &data->atlas);
+
+    return (data->atlas.data != NULL);
+}
+
+// Upload font asset atlas into GPU memory (main thread)
+static bool UploadFontAsset(void *asset, const char *fileName)
+{
+    FontAsset *data = (FontAsset *)asset;
+
+    data->font = UploadFontAtlas(fileName, data->font, data->atlas);
+    data->atlas = (Image){ 0 };
+
+    return true;
+}
+
+// Unload font asset not retrieved, it could be decoded but not uploaded yet
+static void UnloadFontAsset(void *asset)
+{
+    FontAsset *data = (FontAsset *)asset;
+
+    UnloadImage(data->atlas);
+    if (data->font.chars != NULL) UnloadFont(data->font);
+}
@@ -139,15 +139,127 @@
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
+// SIMD instruction sets used for pixel formats conversion (if available)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>                  // SSE2 intrinsics: _mm_loadu_si128(), _mm_packs_epi32(), _mm_cvtepi32_ps()...
+    #define PIXELS_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>                   // NEON intrinsics: vld4_u8(), vmlal_u8(), vcvtq_f32_u32()...
+    #define PIXELS_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-// Nop...
+#define IMAGE_CONVERT_BLOCK_PIXELS  1024    // Pixels converted per block on ImageFormat(), block buffers fit in L1 cache
+#define IMAGE_ALPHA_THRESHOLD         50    // Alpha threshold for 1 bit alpha formats (UNCOMPRESSED_R5G5B5A1)
+
+#define IMAGE_PIXELS_GRAIN_SIZE    16384    // Pixels processed per worker thread chunk on image color operations
+#define IMAGE_ROWS_GRAIN_SIZE         16    // Rows processed per worker thread chunk on image generation
+#define IMAGE_RESIZE_BANDS             8    // Output rows bands resized in parallel by ImageResize(), independent of threads count
+#define IMAGE_RESIZE_BAND_ROWS        64    // Minimum output rows per ImageResize() band
+#define IMAGE_DITHER_SYNC_PIXELS      64    // Pixels dithered per row between progress updates (next row waits for them)
+
+// Worker threads synchronization, acquire/release ordered accesses
+#if defined(__GNUC__) || defined(__clang__)
+    #define IMAGE_LOAD_ACQUIRE(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+    #define IMAGE_STORE_RELEASE(x, v)   __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+    #include <intrin.h>                     // Required for: _InterlockedOr(), _InterlockedExchange()
+    #define IMAGE_LOAD_ACQUIRE(x)       _InterlockedOr((volatile long *)&(x), 0)
+    #define IMAGE_STORE_RELEASE(x, v)   _InterlockedExchange((volatile long *)&(x), (v))
+#else
+    #define IMAGE_LOAD_ACQUIRE(x)       (*(volatile int *)&(x))     // NOTE: Requires a compiler with acquire/release volatile semantics
+    #define IMAGE_STORE_RELEASE(x, v)   (*(volatile int *)&(x) = (v))
+#endif
+
+// Worker threads yield processor while waiting for other threads progress
+#if defined(_WIN32)
+    // NOTE: We include SwitchToThread() function signature here to avoid windows.h inclusion
+    int __stdcall SwitchToThread(void);
+    #define IMAGE_THREAD_YIELD()        SwitchToThread()
+#else
+    #include <sched.h>                      // Required for: sched_yield()
+    #define IMAGE_THREAD_YIELD()        sched_yield()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image pixels view, pixels are accessed as Color by blocks
+// NOTE: UNCOMPRESSED_R8G8B8A8 image data is accessed in place (single block),
+// other formats are converted into block buffer and back
+typedef struct ImagePixels {
+    Image image;                // Image accessed
+    bool write;                 // Pixels blocks stored back into image (modified)
+    int total;                  // Pixels accessed (all mipmap levels when writing)
+    int offset;                 // Current block first pixel
+    int count;                  // Current block pixels count
+    Color *pixels;              // Current block pixels
+    Color buffer[IMAGE_CONVERT_BLOCK_PIXELS];   // Block buffer (formats other than UNCOMPRESSED_R8G8B8A8)
+} ImagePixels;
+
+// Image color operation parameters
+typedef struct ImageColorParams {
+    Color color;                // Operation color (tint, replaced color, alpha clear color)
+    Color replace;              // Replacement color
+    float factor[4];            // Operation factors (tint normalized RGBA, contrast)
+    int value;                  // Operation value (brightness, alpha threshold)
+} ImageColorParams;
+
+// Image color operation, applied to pixels blocks
+typedef void (*ImageColorOperation)(Color *pixels, int count, const ImageColorParams *params);
+
+// Image color operation data, shared by all threads processing an image
+typedef struct ImageColorData {
+    Image image;                        // Image processed (all mipmap levels)
+    ImageColorOperation operation;      // Operation applied to pixels
+    const ImageColorParams *params;     // Operation parameters
+} ImageColorData;
+
+// Image resize data, shared by all threads resizing output rows bands
+typedef struct ImageResizeData {
+    const void *input;          // Input image data
+    int width;                  // Input image width
+    int height;                 // Input image height
+    void *output;               // Output image data
+    int newWidth;               // Output image width
+    int newHeight;              // Output image height
+    int channels;               // Pixel channels (8 bit or float)
+    bool isFloat;               // Pixel channels are float
+    int bandCount;              // Output rows bands
+} ImageResizeData;
+
+// Image dithering data, shared by all threads dithering rows
+// NOTE: Rows are dithered as a wavefront, every row waits for previous row to diffuse
+// its error before dithering the affected pixels, so result is the same as sequential dithering
+typedef struct ImageDitherData {
+    Color *pixels;              // Pixels to dither (modified by error diffusion)
+    unsigned short *output;     // Dithered pixels (16bpp)
+    int width;                  // Image width
+    int height;                 // Image height
+    int rBpp, gBpp, bBpp, aBpp; // Dithered channels bits
+    int *progress;              // Pixels dithered per row (acquire/release accessed)
+} ImageDitherData;
+
+// Image generation data, shared by all threads generating rows
+typedef struct ImageGenData {
+    Color *pixels;              // Generated pixels
+    int width;                  // Image width
+    int height;                 // Image height
+    int offsetX, offsetY;       // Perlin noise offset
+    float scale;                // Perlin noise scale
+    int tileSize;               // Cellular tile size
+    const Vector2 *seeds;       // Cellular seeds (one per tile)
+    int seedsPerRow;            // Cellular seeds per row
+    int seedsPerCol;            // Cellular seeds per column
+} ImageGenData;
+
+// Texture asynchronous loading data, image decoded on a loader thread is uploaded on main thread
+typedef struct TextureAsset {
+    Image image;                // Decoded image (unloaded once uploaded)
+    Texture2D texture;          // Uploaded texture
+} TextureAsset;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -182,6 +294,48 @@ static Image LoadPVR(const char *fileName);   // Load PVR file
 static Image LoadASTC(const char *fileName);  // Load ASTC file
 #endif
 
+static void ConvertPixels(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count);    // Convert pixels between uncompressed formats
+static void UnpackPixels(const void *data, int format, unsigned char *rgba, int count);    // Unpack 8 bit formats pixels into RGBA 8 bit
+static void PackPixels(const unsigned char *rgba, void *data, int format, int count);      // Pack RGBA 8 bit pixels into 8 bit formats
+static void UnpackPixelsFloat(const void *data, int format, float *rgba, int count);       // Unpack float formats pixels into RGBA float
+static void PackPixelsFloat(const float *rgba, void *data, int format, int count);         // Pack RGBA float pixels into float formats
+static void NormalizePixels(const unsigned char *rgba, float *rgbaFloat, int count);       // Convert RGBA 8 bit pixels to RGBA float
+static void QuantizePixels(const float *rgbaFloat, unsigned char *rgba, int count);        // Convert RGBA float pixels to RGBA 8 bit
+
+static int GetImagePixelsCount(Image image);                                                // Get image pixels count, including mipmaps
+static Color *ReadImagePixels(Image image, int offset, int count, Color *buffer);          // Read image pixels range as Color (in place for R8G8B8A8)
+static void WriteImagePixels(Image image, int offset, int count, const Color *pixels);     // Write image pixels range read with ReadImagePixels()
+static Color *BeginImagePixels(Image *image, ImagePixels *view, bool write);               // Begin image pixels access by blocks, returns first block
+static Color *NextImagePixels(ImagePixels *view);                                          // Get next image pixels block, current block is written back
+static Color *ReadImageRow(Image image, int x, int y, int width, Color *buffer);             // Read image row pixels as Color (in place for R8G8B8A8)
+static void SampleRowPixels(const Color *row0, const Color *row1, int width, int fy, int x, int stepX, Color *pixels, int count);  // Sample source rows pixels (bilinear)
+static void AccumulateRowPixels(const Color *row, float weight, int x, int stepX, float *sums, int count);  // Accumulate source row pixels covered by destination pixels (box filter)
+static void BlendPixels(Color *dst, const Color *src, int count, Color tint);               // Alpha blend source pixels (tinted) over destination pixels
+
+static void ProcessImageColors(Image *image, ImageColorOperation operation, const ImageColorParams *params);  // Apply color operation to image pixels (parallel)
+static void ProcessImageColorsRange(void *data, int start, int end);                       // Apply color operation to image pixels range
+static void AlphaClearPixels(Color *pixels, int count, const ImageColorParams *params);    // Replace pixels with alpha below threshold by color
+static void PremultiplyPixels(Color *pixels, int count, const ImageColorParams *params);   // Premultiply pixels color by alpha
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void TintPixels(Color *pixels, int count, const ImageColorParams *params);          // Tint pixels by normalized color factors
+static void InvertPixels(Color *pixels, int count, const ImageColorParams *params);        // Invert pixels color
+static void ContrastPixels(Color *pixels, int count, const ImageColorParams *params);      // Scale pixels contrast by factor
+static void BrightnessPixels(Color *pixels, int count, const ImageColorParams *params);    // Add value to pixels brightness
+static void ReplacePixels(Color *pixels, int count, const ImageColorParams *params);       // Replace pixels matching color
+static void ResizeImageBands(void *data, int start, int end);       // Resize image output rows bands
+static void DitherImageRows(void *data, int start, int end);        // Dither image rows (wavefront, waits for previous rows)
+#endif
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenPerlinNoiseRows(void *data, int start, int end);     // Generate perlin noise image rows
+static void GenCellularRows(void *data, int start, int end);        // Generate cellular image rows
+#endif
+
+static bool DecodeImageAsset(void *asset, const char *fileName);    // Load image asset (loader thread)
+static void UnloadImageAsset(void *asset);                          // Unload image asset not retrieved
+static bool DecodeTextureAsset(void *asset, const char *fileName);  // Load texture asset image (loader thread)
+static bool UploadTextureAsset(void *asset, const char *fileName);  // Upload texture asset image into GPU memory (main thread)
+static void UnloadTextureAsset(void *asset);                        // Unload texture asset not retrieved
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -408,6 +562,42 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
+// Request image loading on background, returns asset handle
+// NOTE: Image is read and decoded on a loader thread, check it with GetAssetLoadState()
+unsigned int LoadImageAsync(const char *fileName)
+{
+    return RequestAssetLoad(fileName, ASSET_TYPE_IMAGE, NULL, sizeof(Image), DecodeImageAsset, NULL, UnloadImageAsset);
+}
+
+// Request texture loading on background, returns asset handle
+// NOTE: Image is decoded on a loader thread, texture is uploaded on main thread by PollAssetLoads()
+unsigned int LoadTextureAsync(const char *fileName)
+{
+    return RequestAssetLoad(fileName, ASSET_TYPE_TEXTURE, NULL, sizeof(TextureAsset), DecodeTextureAsset, UploadTextureAsset, UnloadTextureAsset);
+}
+
+// Get loaded image and release asset handle
+// NOTE: Returns an empty image if asset is not loaded yet (handle is kept) or loading failed
+Image GetAssetImage(unsigned int asset)
+{
+    Image image = { 0 };
+
+    TakeAssetData(asset, ASSET_TYPE_IMAGE, &image, sizeof(Image));
+
+    return image;
+}
+
+// Get loaded texture and release asset handle
+// NOTE: Returns an empty texture if asset is not loaded yet (handle is kept) or loading failed
+Texture2D GetAssetTexture(unsigned int asset)
+{
+    TextureAsset data = { 0 };
+
+    TakeAssetData(asset, ASSET_TYPE_TEXTURE, &data, sizeof(TextureAsset));
+
+    return data.texture;
+}
+
 // Load texture for rendering (framebuffer)
 // NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
 RenderTexture2D LoadRenderTexture(int width, int height)
@@ -454,103 +644,14 @@ Color *GetImageData(Image image)
             (image.format == UNCOMPRESSED_R32G32B32) ||
             (image.format == UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "32bit pixel format converted to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+        int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+        for (int i = 0; i < image.width*image.height; i += IMAGE_CONVERT_BLOCK_PIXELS)
+        {
+            int count = image.width*image.height - i;
+            if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+            ConvertPixels((unsigned char *)image.data + i*bytesPerPixel, image.format, pixels + i, UNCOMPRESSED_R8G8B8A8, count);
         }
     }
 
@@ -673,36 +774,34 @@ Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
     Rectangle crop = { 0 };
 
-    Color *pixels = GetImageData(image);
+    int xMin = 65536;   // Define a big enough number
+    int xMax = 0;
+    int yMin = 65536;
+    int yMax = 0;
 
-    if (pixels != NULL)
-    {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+    ImagePixels view;
 
-        for (int y = 0; y < image.height; y++)
+    for (Color *pixels = BeginImagePixels(&image, &view, false); pixels != NULL; pixels = NextImagePixels(&view))
+    {
+        for (int i = 0; i < view.count; i++)
         {
-            for (int x = 0; x < image.width; x++)
+            if (pixels[i].a > (unsigned char)(threshold*255.0f))
             {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
-        }
+                int x = (view.offset + i)%image.width;
+                int y = (view.offset + i)/image.width;
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
-        {
-            crop = (Rectangle){ xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
+                if (x < xMin) xMin = x;
+                if (x > xMax) xMax = x;
+                if (y < yMin) yMin = y;
+                if (y > yMax) yMax = y;
+            }
         }
+    }
 
-        RL_FREE(pixels);
+    // Check for empty blank image
+    if ((xMin != 65536) && (xMax != 65536))
+    {
+        crop = (Rectangle){ xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
     }
 
     return crop;
@@ -978,6 +1077,7 @@ void ImageToPOT(Image *image, Color fillColor)
 }
 
 // Convert image data to desired format
+// NOTE: Pixels are converted directly between formats by blocks, mipmaps are converted too
 void ImageFormat(Image *image, int newFormat)
 {
     // Security check to avoid program crash
@@ -987,169 +1087,37 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = GetImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
-
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
-
-            int k = 0;
-
-            switch (image->format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+            // Mipmaps are stored consecutively, all levels are converted as a single pixels array
+            int pixelCount = GetImagePixelsCount(*image);
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+            int srcPixelSize = GetPixelDataSize(1, 1, image->format);
+            int dstPixelSize = GetPixelDataSize(1, 1, newFormat);
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    #define ALPHA_THRESHOLD  50
-
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
-
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
-
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+            unsigned char *srcData = (unsigned char *)image->data;
+            unsigned char *dstData = srcData;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE eqeuivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+            // NOTE: Conversion to a smaller (or equal) pixel size is done in place,
+            // pixels written never overtake pixels pending to be read
+            if (dstPixelSize > srcPixelSize) dstData = (unsigned char *)RL_MALLOC(pixelCount*dstPixelSize);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+            for (int i = 0; i < pixelCount; i += IMAGE_CONVERT_BLOCK_PIXELS)
+            {
+                int count = pixelCount - i;
+                if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                default: break;
+                ConvertPixels(srcData + i*srcPixelSize, image->format, dstData + i*dstPixelSize, newFormat, count);
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
-
-            // In case original image had mipmaps, generate mipmaps for formated image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
+            if (dstData != srcData) RL_FREE(srcData);
+            else if (dstPixelSize < srcPixelSize)
             {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
+                // Release memory not required by new format
+                void *temp = RL_REALLOC(dstData, pixelCount*dstPixelSize);
+                if (temp != NULL) dstData = (unsigned char *)temp;
             }
+
+            image->data = dstData;
+            image->format = newFormat;
         }
         else TRACELOG(LOG_WARNING, "Image data format is compressed, can not be converted");
     }
@@ -1213,17 +1181,11 @@ void ImageAlphaClear(Image *image, Color color, float threshold)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    for (int i = 0; i < image->width*image->height; i++) if (pixels[i].a <= (unsigned char)(threshold*255.0f)) pixels[i] = color;
-
-    UnloadImage(*image);
-
-    int prevFormat = image->format;
-    *image = LoadImageEx(pixels, image->width, image->height);
+    ImageColorParams params = { 0 };
+    params.color = color;
+    params.value = (unsigned char)(threshold*255.0f);
 
-    ImageFormat(image, prevFormat);
-    RL_FREE(pixels);
+    ProcessImageColors(image, AlphaClearPixels, &params);
 }
 
 // Premultiply alpha channel
@@ -1232,24 +1194,7 @@ void ImageAlphaPremultiply(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
-    Color *pixels = GetImageData(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        alpha = (float)pixels[i].a/255.0f;
-        pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-        pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-        pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-    }
-
-    UnloadImage(*image);
-
-    int prevFormat = image->format;
-    *image = LoadImageEx(pixels, image->width, image->height);
-
-    ImageFormat(image, prevFormat);
-    RL_FREE(pixels);
+    ProcessImageColors(image, PremultiplyPixels, NULL);
 }
 
 #if defined(SUPPORT_IMAGE_MANIPULATION)
@@ -1342,6 +1287,12 @@ void ImageCrop(Image *image, Rectangle crop)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be cropped");
+        return;
+    }
+
     // Security checks to validate crop rectangle
     if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
     if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
@@ -1350,30 +1301,23 @@ void ImageCrop(Image *image, Rectangle crop)
 
     if ((crop.x < image->width) && (crop.y < image->height))
     {
-        // Start the cropping process
-        Color *pixels = GetImageData(*image);   // Get data as Color pixels array
-        Color *cropPixels = (Color *)RL_MALLOC((int)crop.width*(int)crop.height*sizeof(Color));
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        int rowSize = (int)crop.width*bytesPerPixel;
 
-        for (int j = (int)crop.y; j < (int)(crop.y + crop.height); j++)
+        // Crop rows are moved in place, pixels data formats are not converted
+        // NOTE: Cropped rows destination never overtakes rows pending to be moved
+        for (int y = 0; y < (int)crop.height; y++)
         {
-            for (int i = (int)crop.x; i < (int)(crop.x + crop.width); i++)
-            {
-                cropPixels[(j - (int)crop.y)*(int)crop.width + (i - (int)crop.x)] = pixels[j*image->width + i];
-            }
+            memmove((unsigned char *)image->data + y*rowSize, (unsigned char *)image->data + (((int)crop.y + y)*image->width + (int)crop.x)*bytesPerPixel, rowSize);
         }
 
-        RL_FREE(pixels);
-
-        int format = image->format;
-
-        UnloadImage(*image);
+        // Release memory not required by cropped image
+        void *temp = RL_REALLOC(image->data, (int)crop.height*rowSize);
+        if (temp != NULL) image->data = temp;
 
-        *image = LoadImageEx(cropPixels, (int)crop.width, (int)crop.height);
-
-        RL_FREE(cropPixels);
-
-        // Reformat 32bit RGBA image to original format
-        ImageFormat(image, format);
+        image->width = (int)crop.width;
+        image->height = (int)crop.height;
+        image->mipmaps = 1;
     }
     else TRACELOG(LOG_WARNING, "Image can not be cropped, crop rectangle out of bounds");
 }
@@ -1384,33 +1328,10 @@ void ImageAlphaCrop(Image *image, float threshold)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    int xMin = 65536;   // Define a big enough number
-    int xMax = 0;
-    int yMin = 65536;
-    int yMax = 0;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            if (pixels[y*image->width + x].a > (unsigned char)(threshold*255.0f))
-            {
-                if (x < xMin) xMin = x;
-                if (x > xMax) xMax = x;
-                if (y < yMin) yMin = y;
-                if (y > yMax) yMax = y;
-            }
-        }
-    }
-
-    Rectangle crop = { xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
-
-    RL_FREE(pixels);
+    Rectangle crop = GetImageAlphaBorder(*image, threshold);
 
     // Check for not empty image brefore cropping
-    if (!((xMax < xMin) || (yMax < yMin))) ImageCrop(image, crop);
+    if ((crop.width > 0) && (crop.height > 0)) ImageCrop(image, crop);
 }
 
 // Resize and image to new size
@@ -1422,22 +1343,65 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // Get data as Color pixels array to work with it
-    Color *pixels = GetImageData(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
-
-    // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
-    stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be resized");
+        return;
+    }
 
-    int format = image->format;
+    int channels = 0;
 
-    UnloadImage(*image);
+    switch (image->format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        case UNCOMPRESSED_R32: channels = 1; break;
+        case UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case UNCOMPRESSED_R8G8B8:
+        case UNCOMPRESSED_R32G32B32: channels = 3; break;
+        case UNCOMPRESSED_R8G8B8A8:
+        case UNCOMPRESSED_R32G32B32A32: channels = 4; break;
+        default: break;
+    }
 
-    *image = LoadImageEx(output, newWidth, newHeight);
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    if (channels > 0)
+    {
+        // 8 bit and float channels formats are resized directly, no format conversion required
+        void *output = RL_MALLOC(GetPixelDataSize(newWidth, newHeight, image->format));
+
+        // Output rows bands are resized in parallel by worker threads
+        // NOTE: Bands only depend on output size, so results do not depend on threads count
+        ImageResizeData resize = { 0 };
+        resize.input = image->data;
+        resize.width = image->width;
+        resize.height = image->height;
+        resize.output = output;
+        resize.newWidth = newWidth;
+        resize.newHeight = newHeight;
+        resize.channels = channels;
+        resize.isFloat = (image->format >= UNCOMPRESSED_R32);
+        resize.bandCount = newHeight/IMAGE_RESIZE_BAND_ROWS;
+
+        if (resize.bandCount < 1) resize.bandCount = 1;
+        if (resize.bandCount > IMAGE_RESIZE_BANDS) resize.bandCount = IMAGE_RESIZE_BANDS;
+
+        ProcessParallel(resize.bandCount, 1, ResizeImageBands, &resize);
+
+        RL_FREE(image->data);
+
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+        image->mipmaps = 1;
+    }
+    else
+    {
+        // Packed 16 bit formats are resized as 32bit RGBA image
+        int format = image->format;
 
-    RL_FREE(output);
-    RL_FREE(pixels);
+        ImageFormat(image, UNCOMPRESSED_R8G8B8A8);
+        ImageResize(image, newWidth, newHeight);
+        ImageFormat(image, format);     // Reformat 32bit RGBA image to original format
+    }
 }
 
 // Resize and image to new size using Nearest-Neighbor scaling algorithm
@@ -1446,8 +1410,16 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be resized");
+        return;
+    }
+
+    // Pixels are copied in image format, no format conversion required
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *pixels = (unsigned char *)image->data;
+    unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
     // EDIT: added +1 to account for an early rounding problem
     int xRatio = (int)((image->width << 16)/newWidth) + 1;
@@ -1461,20 +1433,17 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
             x2 = ((x*xRatio) >> 16);
             y2 = ((y*yRatio) >> 16);
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+            memcpy(output + ((y*newWidth) + x)*bytesPerPixel, pixels + ((y2*image->width) + x2)*bytesPerPixel, bytesPerPixel);
         }
     }
 
-    int format = image->format;
+    RL_FREE(image->data);
 
-    UnloadImage(*image);
-
-    *image = LoadImageEx(output, newWidth, newHeight);
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    RL_FREE(output);
-    RL_FREE(pixels);
-}
+    image->data = output;
+    image->width = newWidth;
+    image->height = newHeight;
+    image->mipmaps = 1;
+}
 
 // Resize canvas and fill with color
 // NOTE: Resize offset is relative to the top-left corner of the original image
@@ -1483,74 +1452,46 @@ void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, i
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be resized");
+        return;
+    }
+
     if ((newWidth != image->width) || (newHeight != image->height))
     {
-        // Support offsets out of canvas new size -> original image is cropped
-        if (offsetX < 0)
-        {
-            ImageCrop(image, (Rectangle) { -offsetX, 0, image->width + offsetX, image->height });
-            offsetX = 0;
-        }
-        else if (offsetX > (newWidth - image->width))
-        {
-            ImageCrop(image, (Rectangle) { 0, 0, image->width - (offsetX - (newWidth - image->width)), image->height });
-            offsetX = newWidth - image->width;
-        }
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *resizedData = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        if (offsetY < 0)
-        {
-            ImageCrop(image, (Rectangle) { 0, -offsetY, image->width, image->height + offsetY });
-            offsetY = 0;
-        }
-        else if (offsetY > (newHeight - image->height))
-        {
-            ImageCrop(image, (Rectangle) { 0, 0, image->width, image->height - (offsetY - (newHeight - image->height)) });
-            offsetY = newHeight - image->height;
-        }
+        // Fill first row with color (converted to image format) and copy it to all rows
+        unsigned char fillPixel[16] = { 0 };
+        ConvertPixels(&color, UNCOMPRESSED_R8G8B8A8, fillPixel, image->format, 1);
 
-        if ((newWidth > image->width) && (newHeight > image->height))
-        {
-            Image imTemp = GenImageColor(newWidth, newHeight, color);
+        for (int x = 0; x < newWidth; x++) memcpy(resizedData + x*bytesPerPixel, fillPixel, bytesPerPixel);
+        for (int y = 1; y < newHeight; y++) memcpy(resizedData + y*newWidth*bytesPerPixel, resizedData, newWidth*bytesPerPixel);
 
-            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
-            Rectangle dstRec = { (float)offsetX, (float)offsetY, srcRec.width, srcRec.height };
+        // Copy image rows to its offset position, offsets out of canvas new size crop original image
+        int srcX = (offsetX < 0)? -offsetX : 0;
+        int srcY = (offsetY < 0)? -offsetY : 0;
+        int dstX = (offsetX < 0)? 0 : offsetX;
+        int dstY = (offsetY < 0)? 0 : offsetY;
+        int width = image->width - srcX;
+        int height = image->height - srcY;
 
-            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
-            ImageFormat(&imTemp, image->format);
-            UnloadImage(*image);
-            *image = imTemp;
-        }
-        else if ((newWidth < image->width) && (newHeight < image->height))
+        if (width > (newWidth - dstX)) width = newWidth - dstX;
+        if (height > (newHeight - dstY)) height = newHeight - dstY;
+
+        for (int y = 0; y < height; y++)
         {
-            Rectangle crop = { (float)offsetX, (float)offsetY, (float)newWidth, (float)newHeight };
-            ImageCrop(image, crop);
+            memcpy(resizedData + ((dstY + y)*newWidth + dstX)*bytesPerPixel, (unsigned char *)image->data + ((srcY + y)*image->width + srcX)*bytesPerPixel, width*bytesPerPixel);
         }
-        else    // One side is bigger and the other is smaller
-        {
-            Image imTemp = GenImageColor(newWidth, newHeight, color);
-
-            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
-            Rectangle dstRec = { (float)offsetX, (float)offsetY, (float)image->width, (float)image->height };
-
-            if (newWidth < image->width)
-            {
-                srcRec.x = offsetX;
-                srcRec.width = newWidth;
-                dstRec.x = 0.0f;
-            }
 
-            if (newHeight < image->height)
-            {
-                srcRec.y = offsetY;
-                srcRec.height = newHeight;
-                dstRec.y = 0.0f;
-            }
+        RL_FREE(image->data);
 
-            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
-            ImageFormat(&imTemp, image->format);
-            UnloadImage(*image);
-            *image = imTemp;
-        }
+        image->data = resizedData;
+        image->width = newWidth;
+        image->height = newHeight;
+        image->mipmaps = 1;
     }
 }
 
@@ -1674,72 +1615,21 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
-
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
-
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
-
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
-
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
-
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
-
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
-
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
-
+        // Rows are dithered in parallel by worker threads, as a wavefront (see DitherImageRows())
+        ImageDitherData dither = { 0 };
+        dither.pixels = pixels;
+        dither.output = (unsigned short *)image->data;
+        dither.width = image->width;
+        dither.height = image->height;
+        dither.rBpp = rBpp;
+        dither.gBpp = gBpp;
+        dither.bBpp = bBpp;
+        dither.aBpp = aBpp;
+        dither.progress = (int *)RL_CALLOC(image->height, sizeof(int));
+
+        ProcessParallel(image->height, 1, DitherImageRows, &dither);
+
+        RL_FREE(dither.progress);
         RL_FREE(pixels);
     }
 }
@@ -1750,59 +1640,66 @@ Color *ImageExtractPalette(Image image, int maxPaletteSize, int *extractCount)
 {
     #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
 
-    Color *pixels = GetImageData(image);
     Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
     int palCount = 0;
     for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-    for (int i = 0; i < image.width*image.height; i++)
+    ImagePixels view;
+
+    for (Color *pixels = BeginImagePixels(&image, &view, false); (pixels != NULL) && (palCount < maxPaletteSize); pixels = NextImagePixels(&view))
     {
-        if (pixels[i].a > 0)
+        for (int i = 0; i < view.count; i++)
         {
-            bool colorInPalette = false;
-
-            // Check if the color is already on palette
-            for (int j = 0; j < maxPaletteSize; j++)
+            if (pixels[i].a > 0)
             {
-                if (COLOR_EQUAL(pixels[i], palette[j]))
+                bool colorInPalette = false;
+
+                // Check if the color is already on palette
+                for (int j = 0; j < palCount; j++)
                 {
-                    colorInPalette = true;
-                    break;
+                    if (COLOR_EQUAL(pixels[i], palette[j]))
+                    {
+                        colorInPalette = true;
+                        break;
+                    }
                 }
-            }
-
-            // Store color if not on the palette
-            if (!colorInPalette)
-            {
-                palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                palCount++;
 
-                // We reached the limit of colors supported by palette
-                if (palCount >= maxPaletteSize)
+                // Store color if not on the palette
+                if (!colorInPalette)
                 {
-                    i = image.width*image.height;   // Finish palette get
-                    TRACELOG(LOG_WARNING, "Image palette is greater than %i colors!", maxPaletteSize);
+                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
+                    palCount++;
+
+                    // We reached the limit of colors supported by palette
+                    if (palCount >= maxPaletteSize)
+                    {
+                        TRACELOG(LOG_WARNING, "Image palette is greater than %i colors!", maxPaletteSize);
+                        break;
+                    }
                 }
             }
         }
     }
 
-    RL_FREE(pixels);
-
     *extractCount = palCount;
 
     return palette;
 }
-
 // Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
+// NOTE: Color tint is applied to source image, source is scaled to destination rectangle with bilinear sampling
 void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
+    if ((dst->format >= COMPRESSED_DXT1_RGB) || (src.format >= COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be drawn");
+        return;
+    }
+
     // Security checks to avoid size and rectangle issues (out of bounds)
     // Check that srcRec is inside src image
     if (srcRec.x < 0) srcRec.x = 0;
@@ -1820,99 +1717,222 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         TRACELOG(LOG_WARNING, "Source rectangle height out of bounds, rescaled height: %i", srcRec.height);
     }
 
-    Image srcCopy = ImageCopy(src);     // Make a copy of source image to work with it
+    int srcWidth = (int)srcRec.width;
+    int srcHeight = (int)srcRec.height;
+    int dstX = (int)dstRec.x;
+    int dstY = (int)dstRec.y;
+    int dstWidth = (int)dstRec.width;
+    int dstHeight = (int)dstRec.height;
 
-    // Crop source image to desired source rectangle (if required)
-    if ((src.width != (int)srcRec.width) && (src.height != (int)srcRec.height)) ImageCrop(&srcCopy, srcRec);
+    // Clip destination rectangle to destination image: [left, top] is the first destination rectangle pixel drawn
+    int left = (dstX < 0)? -dstX : 0;
+    int top = (dstY < 0)? -dstY : 0;
+    int width = (((dstX + dstWidth) > dst->width)? (dst->width - dstX) : dstWidth) - left;
+    int height = (((dstY + dstHeight) > dst->height)? (dst->height - dstY) : dstHeight) - top;
 
-    // Scale source image in case destination rec size is different than source rec size
-    if (((int)dstRec.width != (int)srcRec.width) || ((int)dstRec.height != (int)srcRec.height))
-    {
-        ImageResize(&srcCopy, (int)dstRec.width, (int)dstRec.height);
-    }
+    if ((srcWidth <= 0) || (srcHeight <= 0) || (width <= 0) || (height <= 0) || (tint.a == 0)) return;
 
-    // Check that dstRec is inside dst image
-    // Allow negative position within destination with cropping
-    if (dstRec.x < 0)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { -dstRec.x, 0, dstRec.width + dstRec.x, dstRec.height });
-        dstRec.width = dstRec.width + dstRec.x;
-        dstRec.x = 0;
-    }
+    Image srcCopy = { 0 };
 
-    if ((dstRec.x + dstRec.width) > dst->width)
+    // Image drawn within itself, source rectangle is copied to avoid reading already drawn pixels
+    if (src.data == dst->data)
     {
-        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dst->width - dstRec.x, dstRec.height });
-        dstRec.width = dst->width - dstRec.x;
-    }
+        srcCopy = ImageFromImage(src, srcRec);
 
-    if (dstRec.y < 0)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { 0, -dstRec.y, dstRec.width, dstRec.height + dstRec.y });
-        dstRec.height = dstRec.height + dstRec.y;
-        dstRec.y = 0;
+        src = srcCopy;
+        srcRec.x = 0.0f;
+        srcRec.y = 0.0f;
     }
 
-    if ((dstRec.y + dstRec.height) > dst->height)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dstRec.width, dst->height - dstRec.y });
-        dstRec.height = dst->height - dstRec.y;
-    }
+    int srcX = (int)srcRec.x;
+    int srcY = (int)srcRec.y;
 
-    // Get image data as Color pixels array to work with it
-    Color *dstPixels = GetImageData(*dst);
-    Color *srcPixels = GetImageData(srcCopy);
+    int srcBytesPerPixel = GetPixelDataSize(1, 1, src.format);
+    int dstBytesPerPixel = GetPixelDataSize(1, 1, dst->format);
 
-    UnloadImage(srcCopy);       // Source copy not required any more
+    bool noTint = ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255));
+    bool srcAlpha = ((src.format == UNCOMPRESSED_GRAY_ALPHA) || (src.format == UNCOMPRESSED_R5G5B5A1) ||
+                     (src.format == UNCOMPRESSED_R4G4B4A4) || (src.format == UNCOMPRESSED_R8G8B8A8) ||
+                     (src.format == UNCOMPRESSED_R32G32B32A32));
 
-    Vector4 fsrc, fdst, fout;   // Normalized pixel data (ready for operation)
-    Vector4 ftint = ColorNormalize(tint);   // Normalized color tint
+    Color srcBuffer[IMAGE_CONVERT_BLOCK_PIXELS];
+    Color dstBuffer[IMAGE_CONVERT_BLOCK_PIXELS];
 
-    // Blit pixels, copy source image into destination
-    // TODO: Maybe out-of-bounds blitting could be considered here instead of so much cropping
-    for (int j = (int)dstRec.y; j < (int)(dstRec.y + dstRec.height); j++)
+    if ((srcWidth == dstWidth) && (srcHeight == dstHeight))
     {
-        for (int i = (int)dstRec.x; i < (int)(dstRec.x + dstRec.width); i++)
+        // Blit pixels by rows blocks, source blended into destination in place
+        for (int y = 0; y < height; y++)
         {
-            // Alpha blending (https://en.wikipedia.org/wiki/Alpha_compositing)
+            for (int x = 0; x < width; x += IMAGE_CONVERT_BLOCK_PIXELS)
+            {
+                int count = width - x;
+                if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
 
-            fdst = ColorNormalize(dstPixels[j*(int)dst->width + i]);
-            fsrc = ColorNormalize(srcPixels[(j - (int)dstRec.y)*(int)dstRec.width + (i - (int)dstRec.x)]);
+                int srcOffset = (srcY + top + y)*src.width + srcX + left + x;
+                int dstOffset = (dstY + top + y)*dst->width + dstX + left + x;
 
-            // Apply color tint to source image
-            fsrc.x *= ftint.x; fsrc.y *= ftint.y; fsrc.z *= ftint.z; fsrc.w *= ftint.w;
+                unsigned char *srcData = (unsigned char *)src.data + srcOffset*srcBytesPerPixel;
+                unsigned char *dstData = (unsigned char *)dst->data + dstOffset*dstBytesPerPixel;
 
-            fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+                // Opaque source pixels (no tint) are copied directly, no blending required
+                if (noTint && !srcAlpha)
+                {
+                    if (src.format == dst->format) memcpy(dstData, srcData, count*srcBytesPerPixel);
+                    else ConvertPixels(srcData, src.format, dstData, dst->format, count);
 
-            if (fout.w <= 0.0f)
-            {
-                fout.x = 0.0f;
-                fout.y = 0.0f;
-                fout.z = 0.0f;
+                    continue;
+                }
+
+                Color *srcPixels = ReadImagePixels(src, srcOffset, count, srcBuffer);
+
+                int opaque = 0;
+                if (noTint) while ((opaque < count) && (srcPixels[opaque].a == 255)) opaque++;
+
+                if (opaque == count)
+                {
+                    if (src.format == dst->format) memcpy(dstData, srcData, count*srcBytesPerPixel);
+                    else ConvertPixels(srcPixels, UNCOMPRESSED_R8G8B8A8, dstData, dst->format, count);
+                }
+                else
+                {
+                    Color *dstPixels = ReadImagePixels(*dst, dstOffset, count, dstBuffer);
+
+                    BlendPixels(dstPixels, srcPixels, count, tint);
+
+                    WriteImagePixels(*dst, dstOffset, count, dstPixels);
+                }
             }
-            else
+        }
+    }
+    else
+    {
+        // Scale source to destination rectangle, source rows are sampled for every destination row block
+        // NOTE: Scaled source is never stored, only the two source rows sampled are converted (if required)
+        Color *rowBuffers[2] = { NULL, NULL };
+        Color *rows[2] = { NULL, NULL };
+        int rowsY[2] = { -1, -1 };
+
+        if (src.format != UNCOMPRESSED_R8G8B8A8)
+        {
+            rowBuffers[0] = (Color *)RL_MALLOC(srcWidth*2*sizeof(Color));
+            rowBuffers[1] = rowBuffers[0] + srcWidth;
+        }
+
+        // Source pixels step for every destination pixel (16.16 fixed point)
+        int stepX = (int)(((long long)srcWidth << 16)/dstWidth);
+        int stepY = (int)(((long long)srcHeight << 16)/dstHeight);
+
+        if ((stepX > 0x10000) || (stepY > 0x10000))
+        {
+            // Downscaling: source pixels covered by every destination pixel are averaged (box filter),
+            // bilinear sampling would skip source pixels and alias
+            float *sums = (float *)RL_MALLOC(width*4*sizeof(float));
+
+            for (int y = top; y < (top + height); y++)
             {
-                fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-                fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-                fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
-            }
+                long long sy0 = (long long)y*stepY;
+                long long sy1 = sy0 + stepY;
+
+                memset(sums, 0, width*4*sizeof(float));
+
+                // Covered source rows accumulated with their vertical coverage as weight
+                for (int r = (int)(sy0 >> 16); ((long long)r << 16) < sy1; r++)
+                {
+                    long long start = ((long long)r << 16 > sy0)? (long long)r << 16 : sy0;
+                    long long end = (((long long)r + 1) << 16 < sy1)? ((long long)r + 1) << 16 : sy1;
+
+                    const Color *row = ReadImageRow(src, srcX, srcY + r, srcWidth, rowBuffers[0]);
+
+                    AccumulateRowPixels(row, (float)(end - start)/65536.0f, left, stepX, sums, width);
+                }
 
-            dstPixels[j*(int)dst->width + i] = (Color){ (unsigned char)(fout.x*255.0f),
-                                                        (unsigned char)(fout.y*255.0f),
-                                                        (unsigned char)(fout.z*255.0f),
-                                                        (unsigned char)(fout.w*255.0f) };
+                // Sums are divided by covered area (same for every pixel)
+                float scale = (65536.0f*65536.0f)/((float)stepX*(float)stepY);
 
-            // TODO: Support other blending options
+                for (int x = 0; x < width; x += IMAGE_CONVERT_BLOCK_PIXELS)
+                {
+                    int count = width - x;
+                    if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+                    for (int i = 0; i < count; i++)
+                    {
+                        const float *sum = sums + (x + i)*4;
+
+                        srcBuffer[i].r = (unsigned char)(sum[0]*scale + 0.5f);
+                        srcBuffer[i].g = (unsigned char)(sum[1]*scale + 0.5f);
+                        srcBuffer[i].b = (unsigned char)(sum[2]*scale + 0.5f);
+                        srcBuffer[i].a = (unsigned char)(sum[3]*scale + 0.5f);
+                    }
+
+                    int dstOffset = (dstY + y)*dst->width + dstX + left + x;
+
+                    Color *dstPixels = ReadImagePixels(*dst, dstOffset, count, dstBuffer);
+
+                    BlendPixels(dstPixels, srcBuffer, count, tint);
+
+                    WriteImagePixels(*dst, dstOffset, count, dstPixels);
+                }
+            }
+
+            RL_FREE(sums);
         }
-    }
+        else
+        {
+            for (int y = top; y < (top + height); y++)
+            {
+                // Destination pixel center mapped to source, sampled rows and vertical weight
+                int sy = (int)((((long long)(2*y + 1)*stepY) >> 1) - 0x8000);
 
-    UnloadImage(*dst);
+                if (sy < 0) sy = 0;
+                if (sy > ((srcHeight - 1) << 16)) sy = (srcHeight - 1) << 16;
 
-    *dst = LoadImageEx(dstPixels, (int)dst->width, (int)dst->height);
-    ImageFormat(dst, dst->format);
+                int y0 = sy >> 16;
+                int y1 = (y0 < (srcHeight - 1))? (y0 + 1) : y0;
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+                if (rowsY[0] != y0)
+                {
+                    if (rowsY[1] == y0)
+                    {
+                        // Rows advance by one: second row becomes first row, buffers are swapped
+                        Color *temp = rows[0]; rows[0] = rows[1]; rows[1] = temp;
+                        temp = rowBuffers[0]; rowBuffers[0] = rowBuffers[1]; rowBuffers[1] = temp;
+
+                        rowsY[1] = rowsY[0];
+                    }
+                    else rows[0] = ReadImageRow(src, srcX, srcY + y0, srcWidth, rowBuffers[0]);
+
+                    rowsY[0] = y0;
+                }
+
+                if (rowsY[1] != y1)
+                {
+                    rows[1] = ReadImageRow(src, srcX, srcY + y1, srcWidth, rowBuffers[1]);
+                    rowsY[1] = y1;
+                }
+
+                for (int x = 0; x < width; x += IMAGE_CONVERT_BLOCK_PIXELS)
+                {
+                    int count = width - x;
+                    if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+                    int dstOffset = (dstY + y)*dst->width + dstX + left + x;
+
+                    SampleRowPixels(rows[0], rows[1], srcWidth, (sy >> 8) & 0xff, left + x, stepX, srcBuffer, count);
+
+                    Color *dstPixels = ReadImagePixels(*dst, dstOffset, count, dstBuffer);
+
+                    BlendPixels(dstPixels, srcBuffer, count, tint);
+
+                    WriteImagePixels(*dst, dstOffset, count, dstPixels);
+                }
+            }
+        }
+
+        // NOTE: Row buffers are allocated as a single block, swapped pointers must be sorted to free it
+        RL_FREE((rowBuffers[0] < rowBuffers[1])? rowBuffers[0] : rowBuffers[1]);
+    }
+
+    if (srcCopy.data != NULL) UnloadImage(srcCopy);
 }
 
 // Create an image from text (default font)
@@ -1989,9 +2009,61 @@ void ImageDrawRectangle(Image *dst, Rectangle rec, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    Image imRec = GenImageColor((int)rec.width, (int)rec.height, color);
-    ImageDraw(dst, imRec, (Rectangle){ 0, 0, rec.width, rec.height }, rec, WHITE);
-    UnloadImage(imRec);
+    if (dst->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be drawn");
+        return;
+    }
+
+    // Clip rectangle to image
+    int x0 = (int)rec.x;
+    int y0 = (int)rec.y;
+    int x1 = x0 + (int)rec.width;
+    int y1 = y0 + (int)rec.height;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > dst->width) x1 = dst->width;
+    if (y1 > dst->height) y1 = dst->height;
+
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    int rowSize = (x1 - x0)*bytesPerPixel;
+    unsigned char *data = (unsigned char *)dst->data;
+
+    if (color.a == 255)
+    {
+        // Opaque rectangle: first row filled with color (converted to image format) and copied to all rows
+        unsigned char fillPixel[16] = { 0 };
+        ConvertPixels(&color, UNCOMPRESSED_R8G8B8A8, fillPixel, dst->format, 1);
+
+        unsigned char *firstRow = data + (y0*dst->width + x0)*bytesPerPixel;
+
+        for (int x = 0; x < (x1 - x0); x++) memcpy(firstRow + x*bytesPerPixel, fillPixel, bytesPerPixel);
+        for (int y = y0 + 1; y < y1; y++) memcpy(data + (y*dst->width + x0)*bytesPerPixel, firstRow, rowSize);
+    }
+    else
+    {
+        // Translucent rectangle: color blended by rows blocks
+        Color colorBuffer[IMAGE_CONVERT_BLOCK_PIXELS];
+        Color dstBuffer[IMAGE_CONVERT_BLOCK_PIXELS];
+
+        for (int i = 0; i < IMAGE_CONVERT_BLOCK_PIXELS; i++) colorBuffer[i] = color;
+
+        for (int y = y0; y < y1; y++)
+        {
+            for (int x = x0; x < x1; x += IMAGE_CONVERT_BLOCK_PIXELS)
+            {
+                int count = x1 - x;
+                if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+                Color *dstPixels = ReadImagePixels(*dst, y*dst->width + x, count, dstBuffer);
+                BlendPixels(dstPixels, colorBuffer, count, WHITE);
+                WriteImagePixels(*dst, y*dst->width + x, count, dstPixels);
+            }
+        }
+    }
 }
 
 // Draw rectangle lines within an image
@@ -2024,115 +2096,188 @@ void ImageDrawTextEx(Image *dst, Vector2 position, Font font, const char *text,
 }
 
 // Flip image vertically
+// NOTE: Rows are swapped in place, all mipmap levels are flipped
 void ImageFlipVertical(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be flipped");
+        return;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *data = (unsigned char *)image->data;
+    int width = image->width;
+    int height = image->height;
 
-    for (int y = 0; y < image->height; y++)
+    for (int level = 0; level < image->mipmaps; level++)
     {
-        for (int x = 0; x < image->width; x++)
+        int rowSize = width*bytesPerPixel;
+
+        for (int y = 0; y < height/2; y++)
         {
-            dstPixels[y*image->width + x] = srcPixels[(image->height - 1 - y)*image->width + x];
+            unsigned char *topRow = data + y*rowSize;
+            unsigned char *bottomRow = data + (height - 1 - y)*rowSize;
+            unsigned char temp[1024];
+
+            // Rows swapped by chunks, no row buffer allocation required
+            for (int i = 0; i < rowSize; i += sizeof(temp))
+            {
+                int size = rowSize - i;
+                if (size > (int)sizeof(temp)) size = sizeof(temp);
+
+                memcpy(temp, topRow + i, size);
+                memcpy(topRow + i, bottomRow + i, size);
+                memcpy(bottomRow + i, temp, size);
+            }
         }
-    }
 
-    Image processed = LoadImageEx(dstPixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+        data += height*rowSize;
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+        width /= 2;
+        height /= 2;
 
-    image->data = processed.data;
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
 }
 
 // Flip image horizontally
+// NOTE: Pixels are swapped in place, all mipmap levels are flipped
 void ImageFlipHorizontal(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be flipped");
+        return;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *data = (unsigned char *)image->data;
+    int width = image->width;
+    int height = image->height;
 
-    for (int y = 0; y < image->height; y++)
+    for (int level = 0; level < image->mipmaps; level++)
     {
-        for (int x = 0; x < image->width; x++)
+        for (int y = 0; y < height; y++)
         {
-            dstPixels[y*image->width + x] = srcPixels[y*image->width + (image->width - 1 - x)];
+            if (bytesPerPixel == 4)
+            {
+                // 32 bit pixels swapped as a whole
+                unsigned int *row = (unsigned int *)data + y*width;
+
+                for (int x = 0; x < width/2; x++)
+                {
+                    unsigned int temp = row[x];
+                    row[x] = row[width - 1 - x];
+                    row[width - 1 - x] = temp;
+                }
+            }
+            else
+            {
+                unsigned char *row = data + y*width*bytesPerPixel;
+
+                for (int x = 0; x < width/2; x++)
+                {
+                    unsigned char *left = row + x*bytesPerPixel;
+                    unsigned char *right = row + (width - 1 - x)*bytesPerPixel;
+
+                    for (int k = 0; k < bytesPerPixel; k++)
+                    {
+                        unsigned char temp = left[k];
+                        left[k] = right[k];
+                        right[k] = temp;
+                    }
+                }
+            }
         }
-    }
 
-    Image processed = LoadImageEx(dstPixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+        data += width*height*bytesPerPixel;
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+        width /= 2;
+        height /= 2;
 
-    image->data = processed.data;
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
 }
 
 // Rotate image clockwise 90deg
+// NOTE: Pixels are copied in image format, mipmaps are not kept
 void ImageRotateCW(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be rotated");
+        return;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *pixels = (unsigned char *)image->data;
+    unsigned char *rotPixels = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
     for (int y = 0; y < image->height; y++)
     {
         for (int x = 0; x < image->width; x++)
         {
-            rotPixels[x*image->height + (image->height - y - 1)] = srcPixels[y*image->width + x];
+            memcpy(rotPixels + (x*image->height + (image->height - y - 1))*bytesPerPixel, pixels + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
         }
     }
 
-    Image processed = LoadImageEx(rotPixels, image->height, image->width);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+    RL_FREE(image->data);
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+    int width = image->width;
 
-    image->data = processed.data;
-    image->width = processed.width;
-    image->height = processed.height;
+    image->data = rotPixels;
+    image->width = image->height;
+    image->height = width;
+    image->mipmaps = 1;
 }
 
 // Rotate image counter-clockwise 90deg
+// NOTE: Pixels are copied in image format, mipmaps are not kept
 void ImageRotateCCW(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Compressed data formats can not be rotated");
+        return;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *pixels = (unsigned char *)image->data;
+    unsigned char *rotPixels = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
     for (int y = 0; y < image->height; y++)
     {
         for (int x = 0; x < image->width; x++)
         {
-            rotPixels[x*image->height + y] = srcPixels[y*image->width + (image->width - x - 1)];
+            memcpy(rotPixels + ((image->width - x - 1)*image->height + y)*bytesPerPixel, pixels + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
         }
     }
 
-    Image processed = LoadImageEx(rotPixels, image->height, image->width);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+    RL_FREE(image->data);
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+    int width = image->width;
 
-    image->data = processed.data;
-    image->width = processed.width;
-    image->height = processed.height;
+    image->data = rotPixels;
+    image->width = image->height;
+    image->height = width;
+    image->mipmaps = 1;
 }
 
 // Modify image color: tint
@@ -2141,36 +2286,13 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y * image->width + x;
-            unsigned char r = 255*((float)pixels[index].r/255*cR);
-            unsigned char g = 255*((float)pixels[index].g/255*cG);
-            unsigned char b = 255*((float)pixels[index].b/255*cB);
-            unsigned char a = 255*((float)pixels[index].a/255*cA);
-
-            pixels[y*image->width + x].r = r;
-            pixels[y*image->width + x].g = g;
-            pixels[y*image->width + x].b = b;
-            pixels[y*image->width + x].a = a;
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
+    ImageColorParams params = { 0 };
+    params.factor[0] = (float)color.r/255;
+    params.factor[1] = (float)color.g/255;
+    params.factor[2] = (float)color.b/255;
+    params.factor[3] = (float)color.a/255;
 
-    image->data = processed.data;
+    ProcessImageColors(image, TintPixels, &params);
 }
 
 // Modify image color: invert
@@ -2179,24 +2301,7 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
-
-    image->data = processed.data;
+    ProcessImageColors(image, InvertPixels, NULL);
 }
 
 // Modify image color: grayscale
@@ -2218,48 +2323,10 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = GetImageData(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5;
-            pR *= contrast;
-            pR += 0.5;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5;
-            pG *= contrast;
-            pG += 0.5;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5;
-            pB *= contrast;
-            pB += 0.5;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
+    ImageColorParams params = { 0 };
+    params.factor[0] = contrast;
 
-    image->data = processed.data;
+    ProcessImageColors(image, ContrastPixels, &params);
 }
 
 // Modify image color: brightness
@@ -2272,37 +2339,10 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = GetImageData(*image);
+    ImageColorParams params = { 0 };
+    params.value = brightness;
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
-
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
-
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
-
-    image->data = processed.data;
+    ProcessImageColors(image, BrightnessPixels, &params);
 }
 
 // Modify image color: replace color
@@ -2311,31 +2351,11 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
-            {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
-            }
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
+    ImageColorParams params = { 0 };
+    params.color = color;
+    params.replace = replace;
 
-    image->data = processed.data;
+    ProcessImageColors(image, ReplacePixels, &params);
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -2470,29 +2490,20 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 }
 
 // Generate image: perlin noise
+// NOTE: Rows are generated in parallel by worker threads
 Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*scale/(float)width;
-            float ny = (float)(y + offsetY)*scale/(float)height;
-
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-
-            // NOTE: We need to translate the data from [-1..1] to [0..1]
-            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.offsetX = offsetX;
+    gen.offsetY = offsetY;
+    gen.scale = scale;
 
-            int intensity = (int)(p*255.0f);
-            pixels[y*width + x] = (Color){intensity, intensity, intensity, 255};
-        }
-    }
+    ProcessParallel(height, IMAGE_ROWS_GRAIN_SIZE, GenPerlinNoiseRows, &gen);
 
     Image image = LoadImageEx(pixels, width, height);
     RL_FREE(pixels);
@@ -2501,6 +2512,7 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 }
 
 // Generate image: cellular algorithm. Bigger tileSize means bigger cells
+// NOTE: Seeds are generated on calling thread (random sequence is kept), rows are generated in parallel by worker threads
 Image GenImageCellular(int width, int height, int tileSize)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
@@ -2518,39 +2530,16 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y};
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = (float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.tileSize = tileSize;
+    gen.seeds = seeds;
+    gen.seedsPerRow = seedsPerRow;
+    gen.seedsPerCol = seedsPerCol;
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ProcessParallel(height, IMAGE_ROWS_GRAIN_SIZE, GenCellularRows, &gen);
 
     RL_FREE(seeds);
 
@@ -3687,3 +3676,1138 @@ static Image LoadASTC(const char *fileName)
     return image;
 }
 #endif
+
+// Convert pixels between uncompressed formats
+// NOTE: Pixels are converted through a block sized RGBA buffer (8 bit or float, depending on formats),
+// UNCOMPRESSED_R8G8B8A8 pixels are packed/unpacked directly, without intermediate buffer
+static void ConvertPixels(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count)
+{
+    unsigned char rgba[IMAGE_CONVERT_BLOCK_PIXELS*4];
+
+    if ((srcFormat < UNCOMPRESSED_R32) && (dstFormat < UNCOMPRESSED_R32))
+    {
+        if (srcFormat == UNCOMPRESSED_R8G8B8A8) PackPixels((const unsigned char *)srcData, dstData, dstFormat, count);
+        else if (dstFormat == UNCOMPRESSED_R8G8B8A8) UnpackPixels(srcData, srcFormat, (unsigned char *)dstData, count);
+        else
+        {
+            UnpackPixels(srcData, srcFormat, rgba, count);
+            PackPixels(rgba, dstData, dstFormat, count);
+        }
+    }
+    else
+    {
+        float rgbaFloat[IMAGE_CONVERT_BLOCK_PIXELS*4];
+
+        if (srcFormat >= UNCOMPRESSED_R32) UnpackPixelsFloat(srcData, srcFormat, rgbaFloat, count);
+        else if (srcFormat == UNCOMPRESSED_R8G8B8A8) NormalizePixels((const unsigned char *)srcData, rgbaFloat, count);
+        else
+        {
+            UnpackPixels(srcData, srcFormat, rgba, count);
+            NormalizePixels(rgba, rgbaFloat, count);
+        }
+
+        if (dstFormat >= UNCOMPRESSED_R32) PackPixelsFloat(rgbaFloat, dstData, dstFormat, count);
+        else if (dstFormat == UNCOMPRESSED_R8G8B8A8) QuantizePixels(rgbaFloat, (unsigned char *)dstData, count);
+        else
+        {
+            QuantizePixels(rgbaFloat, rgba, count);
+            PackPixels(rgba, dstData, dstFormat, count);
+        }
+    }
+}
+
+// Unpack 8 bit formats pixels into RGBA 8 bit
+// NOTE: Channels with less than 8 bit are expanded to the nearest 8 bit value
+static void UnpackPixels(const void *data, int format, unsigned char *rgba, int count)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    const unsigned short *shorts = (const unsigned short *)data;
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = bytes[i];
+                rgba[i*4 + 1] = bytes[i];
+                rgba[i*4 + 2] = bytes[i];
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = bytes[i*2];
+                rgba[i*4 + 1] = bytes[i*2];
+                rgba[i*4 + 2] = bytes[i*2];
+                rgba[i*4 + 3] = bytes[i*2 + 1];
+            }
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[i];
+
+                rgba[i*4] = (unsigned char)((((pixel >> 11) & 0x1f)*255 + 15)/31);
+                rgba[i*4 + 1] = (unsigned char)((((pixel >> 5) & 0x3f)*255 + 31)/63);
+                rgba[i*4 + 2] = (unsigned char)(((pixel & 0x1f)*255 + 15)/31);
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = bytes[i*3];
+                rgba[i*4 + 1] = bytes[i*3 + 1];
+                rgba[i*4 + 2] = bytes[i*3 + 2];
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[i];
+
+                rgba[i*4] = (unsigned char)((((pixel >> 11) & 0x1f)*255 + 15)/31);
+                rgba[i*4 + 1] = (unsigned char)((((pixel >> 6) & 0x1f)*255 + 15)/31);
+                rgba[i*4 + 2] = (unsigned char)((((pixel >> 1) & 0x1f)*255 + 15)/31);
+                rgba[i*4 + 3] = (pixel & 0x1)? 255 : 0;
+            }
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[i];
+
+                rgba[i*4] = (unsigned char)(((pixel >> 12) & 0xf)*17);
+                rgba[i*4 + 1] = (unsigned char)(((pixel >> 8) & 0xf)*17);
+                rgba[i*4 + 2] = (unsigned char)(((pixel >> 4) & 0xf)*17);
+                rgba[i*4 + 3] = (unsigned char)((pixel & 0xf)*17);
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8A8: memcpy(rgba, data, count*4); break;
+        default: break;
+    }
+}
+
+// Pack RGBA 8 bit pixels into 8 bit formats
+// NOTE: Channels are rounded to the nearest value, (x*levels + 127)/255 is computed as (y + (y >> 8)) >> 8
+// with y = x*levels + 128 (exact for 8 bit values and vectorizable), grayscale uses ITU-R BT.601 luma weights (0.299, 0.587, 0.114)
+static void PackPixels(const unsigned char *rgba, void *data, int format, int count)
+{
+    unsigned char *bytes = (unsigned char *)data;
+    unsigned short *shorts = (unsigned short *)data;
+
+    #define QUANTIZE_CHANNEL(value, levels) ((((value)*(levels) + 128) + (((value)*(levels) + 128) >> 8)) >> 8)
+    #define GRAYSCALE_VALUE(r, g, b) (((r)*19595 + (g)*38470 + (b)*7471 + 32768) >> 16)
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++) bytes[i] = (unsigned char)GRAYSCALE_VALUE(rgba[i*4], rgba[i*4 + 1], rgba[i*4 + 2]);
+        } break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                bytes[i*2] = (unsigned char)GRAYSCALE_VALUE(rgba[i*4], rgba[i*4 + 1], rgba[i*4 + 2]);
+                bytes[i*2 + 1] = rgba[i*4 + 3];
+            }
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            int i = 0;
+#if defined(PIXELS_SIMD_SSE2)
+            // Channels are processed in 32 bit lanes (4 pixels per vector), packed into 16 bit with a signed bias
+            const __m128i mask = _mm_set1_epi32(0xff);
+            const __m128i rounding = _mm_set1_epi32(128);
+            const __m128i bias32 = _mm_set1_epi32(0x8000);
+            const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i result[2];
+
+                for (int k = 0; k < 2; k++)
+                {
+                    __m128i pixels = _mm_loadu_si128((const __m128i *)(rgba + (i + k*4)*4));
+
+                    __m128i r = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(pixels, mask), _mm_set1_epi32(31)), rounding);
+                    __m128i g = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pixels, 8), mask), _mm_set1_epi32(63)), rounding);
+                    __m128i b = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pixels, 16), mask), _mm_set1_epi32(31)), rounding);
+
+                    r = _mm_srli_epi32(_mm_add_epi32(r, _mm_srli_epi32(r, 8)), 8);
+                    g = _mm_srli_epi32(_mm_add_epi32(g, _mm_srli_epi32(g, 8)), 8);
+                    b = _mm_srli_epi32(_mm_add_epi32(b, _mm_srli_epi32(b, 8)), 8);
+
+                    result[k] = _mm_sub_epi32(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 11), _mm_slli_epi32(g, 5)), b), bias32);
+                }
+
+                _mm_storeu_si128((__m128i *)(shorts + i), _mm_add_epi16(_mm_packs_epi32(result[0], result[1]), bias16));
+            }
+#elif defined(PIXELS_SIMD_NEON)
+            // Channels are deinterleaved by load, 8 pixels per vector
+            const uint16x8_t rounding = vdupq_n_u16(128);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba + i*4);
+
+                uint16x8_t r = vmlal_u8(rounding, pixels.val[0], vdup_n_u8(31));
+                uint16x8_t g = vmlal_u8(rounding, pixels.val[1], vdup_n_u8(63));
+                uint16x8_t b = vmlal_u8(rounding, pixels.val[2], vdup_n_u8(31));
+
+                r = vshrq_n_u16(vsraq_n_u16(r, r, 8), 8);
+                g = vshrq_n_u16(vsraq_n_u16(g, g, 8), 8);
+                b = vshrq_n_u16(vsraq_n_u16(b, b, 8), 8);
+
+                vst1q_u16(shorts + i, vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b));
+            }
+#endif
+            for (; i < count; i++)
+            {
+                shorts[i] = (unsigned short)(QUANTIZE_CHANNEL(rgba[i*4], 31) << 11 | QUANTIZE_CHANNEL(rgba[i*4 + 1], 63) << 5 | QUANTIZE_CHANNEL(rgba[i*4 + 2], 31));
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                bytes[i*3] = rgba[i*4];
+                bytes[i*3 + 1] = rgba[i*4 + 1];
+                bytes[i*3 + 2] = rgba[i*4 + 2];
+            }
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                shorts[i] = (unsigned short)(QUANTIZE_CHANNEL(rgba[i*4], 31) << 11 | QUANTIZE_CHANNEL(rgba[i*4 + 1], 31) << 6 |
+                                             QUANTIZE_CHANNEL(rgba[i*4 + 2], 31) << 1 | ((rgba[i*4 + 3] > IMAGE_ALPHA_THRESHOLD)? 1 : 0));
+            }
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                shorts[i] = (unsigned short)(QUANTIZE_CHANNEL(rgba[i*4], 15) << 12 | QUANTIZE_CHANNEL(rgba[i*4 + 1], 15) << 8 |
+                                             QUANTIZE_CHANNEL(rgba[i*4 + 2], 15) << 4 | QUANTIZE_CHANNEL(rgba[i*4 + 3], 15));
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8A8: memcpy(data, rgba, count*4); break;
+        default: break;
+    }
+
+    #undef QUANTIZE_CHANNEL
+    #undef GRAYSCALE_VALUE
+}
+
+// Unpack float formats pixels into RGBA float
+// NOTE: UNCOMPRESSED_R32 is considered a grayscale format
+static void UnpackPixelsFloat(const void *data, int format, float *rgba, int count)
+{
+    const float *values = (const float *)data;
+
+    switch (format)
+    {
+        case UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = values[i];
+                rgba[i*4 + 1] = values[i];
+                rgba[i*4 + 2] = values[i];
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = values[i*3];
+                rgba[i*4 + 1] = values[i*3 + 1];
+                rgba[i*4 + 2] = values[i*3 + 2];
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case UNCOMPRESSED_R32G32B32A32: memcpy(rgba, data, count*4*sizeof(float)); break;
+        default: break;
+    }
+}
+
+// Pack RGBA float pixels into float formats
+static void PackPixelsFloat(const float *rgba, void *data, int format, int count)
+{
+    float *values = (float *)data;
+
+    switch (format)
+    {
+        case UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++) values[i] = rgba[i*4]*0.299f + rgba[i*4 + 1]*0.587f + rgba[i*4 + 2]*0.114f;
+        } break;
+        case UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                values[i*3] = rgba[i*4];
+                values[i*3 + 1] = rgba[i*4 + 1];
+                values[i*3 + 2] = rgba[i*4 + 2];
+            }
+        } break;
+        case UNCOMPRESSED_R32G32B32A32: memcpy(data, rgba, count*4*sizeof(float)); break;
+        default: break;
+    }
+}
+
+// Convert RGBA 8 bit pixels to RGBA float (normalized)
+static void NormalizePixels(const unsigned char *rgba, float *rgbaFloat, int count)
+{
+    int i = 0;
+
+#if defined(PIXELS_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(1.0f/255.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(rgba + i*4));
+        __m128i low = _mm_unpacklo_epi8(pixels, zero);
+        __m128i high = _mm_unpackhi_epi8(pixels, zero);
+
+        _mm_storeu_ps(rgbaFloat + i*4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+        _mm_storeu_ps(rgbaFloat + i*4 + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+        _mm_storeu_ps(rgbaFloat + i*4 + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+        _mm_storeu_ps(rgbaFloat + i*4 + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+    }
+#elif defined(PIXELS_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        uint8x16_t pixels = vld1q_u8(rgba + i*4);
+        uint16x8_t low = vmovl_u8(vget_low_u8(pixels));
+        uint16x8_t high = vmovl_u8(vget_high_u8(pixels));
+
+        vst1q_f32(rgbaFloat + i*4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))), 1.0f/255.0f));
+        vst1q_f32(rgbaFloat + i*4 + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(low))), 1.0f/255.0f));
+        vst1q_f32(rgbaFloat + i*4 + 8, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))), 1.0f/255.0f));
+        vst1q_f32(rgbaFloat + i*4 + 12, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(high))), 1.0f/255.0f));
+    }
+#endif
+
+    for (i *= 4; i < count*4; i++) rgbaFloat[i] = (float)rgba[i]*(1.0f/255.0f);
+}
+
+// Convert RGBA float pixels to RGBA 8 bit
+// NOTE: Values are clamped to [0.0f..1.0f] range and rounded to nearest
+static void QuantizePixels(const float *rgbaFloat, unsigned char *rgba, int count)
+{
+    int i = 0;
+
+#if defined(PIXELS_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i values[4];
+
+        // NOTE: Max operation returns second operand for NaN values, converted to 0
+        for (int k = 0; k < 4; k++) values[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(rgbaFloat + i*4 + k*4), zero), one), scale), half));
+
+        _mm_storeu_si128((__m128i *)(rgba + i*4), _mm_packus_epi16(_mm_packs_epi32(values[0], values[1]), _mm_packs_epi32(values[2], values[3])));
+    }
+#elif defined(PIXELS_SIMD_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t values[4];
+
+        for (int k = 0; k < 4; k++) values[k] = vcvtq_u32_f32(vmlaq_n_f32(half, vminq_f32(vmaxq_f32(vld1q_f32(rgbaFloat + i*4 + k*4), zero), one), 255.0f));
+
+        uint16x8_t low = vcombine_u16(vmovn_u32(values[0]), vmovn_u32(values[1]));
+        uint16x8_t high = vcombine_u16(vmovn_u32(values[2]), vmovn_u32(values[3]));
+
+        vst1q_u8(rgba + i*4, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+
+    for (i *= 4; i < count*4; i++)
+    {
+        float value = rgbaFloat[i];
+
+        if (!(value > 0.0f)) value = 0.0f;         // NOTE: NaN values converted to 0
+        else if (value > 1.0f) value = 1.0f;
+
+        rgba[i] = (unsigned char)(value*255.0f + 0.5f);
+    }
+}
+
+// Get image pixels count, including mipmaps
+static int GetImagePixelsCount(Image image)
+{
+    int pixelCount = 0;
+    int width = image.width;
+    int height = image.height;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        pixelCount += width*height;
+
+        width /= 2;
+        height /= 2;
+
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return pixelCount;
+}
+
+// Read image pixels range as Color array
+// NOTE: UNCOMPRESSED_R8G8B8A8 image data is returned in place (any count), other formats
+// are converted into provided buffer (IMAGE_CONVERT_BLOCK_PIXELS max)
+static Color *ReadImagePixels(Image image, int offset, int count, Color *buffer)
+{
+    if (image.format == UNCOMPRESSED_R8G8B8A8) return (Color *)image.data + offset;
+
+    ConvertPixels((unsigned char *)image.data + offset*GetPixelDataSize(1, 1, image.format), image.format, buffer, UNCOMPRESSED_R8G8B8A8, count);
+
+    return buffer;
+}
+
+// Write image pixels range read with ReadImagePixels()
+static void WriteImagePixels(Image image, int offset, int count, const Color *pixels)
+{
+    if (image.format != UNCOMPRESSED_R8G8B8A8) ConvertPixels(pixels, UNCOMPRESSED_R8G8B8A8, (unsigned char *)image.data + offset*GetPixelDataSize(1, 1, image.format), image.format, count);
+}
+
+// Begin image pixels access by blocks, returns first block (NULL if pixels can not be accessed)
+// NOTE: Modified pixels (write) are accessed on all mipmap levels, read only access covers base level,
+// when writing, blocks must be iterated with NextImagePixels() until it returns NULL
+static Color *BeginImagePixels(Image *image, ImagePixels *view, bool write)
+{
+    view->image = *image;
+    view->write = write;
+    view->total = 0;
+    view->offset = 0;
+    view->count = 0;
+    view->pixels = NULL;
+
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return NULL;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Pixel data access not supported for compressed image formats");
+        return NULL;
+    }
+
+    view->total = write? GetImagePixelsCount(*image) : image->width*image->height;
+    view->count = view->total;
+
+    if ((image->format != UNCOMPRESSED_R8G8B8A8) && (view->count > IMAGE_CONVERT_BLOCK_PIXELS)) view->count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+    view->pixels = ReadImagePixels(view->image, 0, view->count, view->buffer);
+
+    return view->pixels;
+}
+
+// Get next image pixels block, current block is written back into image (if writing)
+static Color *NextImagePixels(ImagePixels *view)
+{
+    if (view->write) WriteImagePixels(view->image, view->offset, view->count, view->pixels);
+
+    view->offset += view->count;
+    view->count = view->total - view->offset;
+
+    if (view->count <= 0)
+    {
+        view->count = 0;
+        view->pixels = NULL;
+
+        return NULL;
+    }
+
+    if (view->count > IMAGE_CONVERT_BLOCK_PIXELS) view->count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+    view->pixels = ReadImagePixels(view->image, view->offset, view->count, view->buffer);
+
+    return view->pixels;
+}
+
+// Read image row pixels as Color array
+// NOTE: UNCOMPRESSED_R8G8B8A8 image data is returned in place, other formats are converted into provided buffer (width pixels)
+static Color *ReadImageRow(Image image, int x, int y, int width, Color *buffer)
+{
+    if (image.format == UNCOMPRESSED_R8G8B8A8) return (Color *)image.data + y*image.width + x;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    unsigned char *data = (unsigned char *)image.data + (y*image.width + x)*bytesPerPixel;
+
+    for (int i = 0; i < width; i += IMAGE_CONVERT_BLOCK_PIXELS)
+    {
+        int count = width - i;
+        if (count > IMAGE_CONVERT_BLOCK_PIXELS) count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+        ConvertPixels(data + i*bytesPerPixel, image.format, buffer + i, UNCOMPRESSED_R8G8B8A8, count);
+    }
+
+    return buffer;
+}
+
+// Accumulate source row pixels covered by destination pixels [x, x + count] (box filter)
+// NOTE: Destination pixel covers source range [x*stepX, (x + 1)*stepX] (16.16 fixed point), every covered
+// source pixel is weighted by its horizontal coverage and row weight, sums are RGBA for every destination pixel
+static void AccumulateRowPixels(const Color *row, float weight, int x, int stepX, float *sums, int count)
+{
+    long long sx0 = (long long)x*stepX;
+
+    for (int i = 0; i < count; i++, sx0 += stepX)
+    {
+        long long sx1 = sx0 + stepX;
+        float *sum = sums + i*4;
+
+        for (int p = (int)(sx0 >> 16); ((long long)p << 16) < sx1; p++)
+        {
+            long long start = ((long long)p << 16 > sx0)? (long long)p << 16 : sx0;
+            long long end = (((long long)p + 1) << 16 < sx1)? ((long long)p + 1) << 16 : sx1;
+
+            float w = weight*(float)(end - start)/65536.0f;
+
+            sum[0] += w*row[p].r;
+            sum[1] += w*row[p].g;
+            sum[2] += w*row[p].b;
+            sum[3] += w*row[p].a;
+        }
+    }
+}
+
+// Sample source rows pixels (bilinear) for destination pixels [x, x + count]
+// NOTE: Source position and step are 16.16 fixed point, vertical weight (fy) is 8 bit (row1 weight),
+// rows are interpolated first and result interpolated horizontally, rounding every step (SIMD paths are identical)
+static void SampleRowPixels(const Color *row0, const Color *row1, int width, int fy, int x, int stepX, Color *pixels, int count)
+{
+    int maxX = (width - 1) << 16;
+
+    // First destination pixel center mapped to source, next pixels are one step away
+    long long sx = (((long long)(2*x + 1)*stepX) >> 1) - 0x8000;
+
+#if defined(PIXELS_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi16(128);
+    const __m128i weight0 = _mm_set1_epi16((short)(256 - fy));
+    const __m128i weight1 = _mm_set1_epi16((short)fy);
+#elif defined(PIXELS_SIMD_NEON)
+    const uint16x8_t weight0 = vdupq_n_u16((unsigned short)(256 - fy));
+    const uint16x8_t weight1 = vdupq_n_u16((unsigned short)fy);
+#endif
+
+    for (int i = 0; i < count; i++, sx += stepX)
+    {
+        int px = (sx < 0)? 0 : ((sx > maxX)? maxX : (int)sx);
+
+        int x0 = px >> 16;
+        int fx = (px >> 8) & 0xff;
+
+#if defined(PIXELS_SIMD_SSE2)
+        if (x0 < (width - 1))
+        {
+            // Two consecutive pixels per row, channels as 16 bit values
+            __m128i top = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row0 + x0)), zero);
+            __m128i bottom = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row1 + x0)), zero);
+
+            __m128i column = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(top, weight0), _mm_mullo_epi16(bottom, weight1)), rounding), 8);
+            column = _mm_mullo_epi16(column, _mm_set_epi16((short)fx, (short)fx, (short)fx, (short)fx, (short)(256 - fx), (short)(256 - fx), (short)(256 - fx), (short)(256 - fx)));
+
+            __m128i result = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(column, _mm_srli_si128(column, 8)), rounding), 8);
+
+            ((int *)pixels)[i] = _mm_cvtsi128_si32(_mm_packus_epi16(result, zero));
+            continue;
+        }
+#elif defined(PIXELS_SIMD_NEON)
+        if (x0 < (width - 1))
+        {
+            // Two consecutive pixels per row, channels as 16 bit values
+            uint16x8_t top = vmovl_u8(vld1_u8((const unsigned char *)(row0 + x0)));
+            uint16x8_t bottom = vmovl_u8(vld1_u8((const unsigned char *)(row1 + x0)));
+
+            uint16x8_t column = vrshrq_n_u16(vmlaq_u16(vmulq_u16(top, weight0), bottom, weight1), 8);
+            uint16x4_t result = vrshr_n_u16(vmla_n_u16(vmul_n_u16(vget_low_u16(column), (unsigned short)(256 - fx)), vget_high_u16(column), (unsigned short)fx), 8);
+
+            vst1_lane_u32((uint32_t *)(pixels + i), vreinterpret_u32_u8(vmovn_u16(vcombine_u16(result, result))), 0);
+            continue;
+        }
+#endif
+        int x1 = (x0 < (width - 1))? (x0 + 1) : x0;
+
+        const unsigned char *p00 = (const unsigned char *)(row0 + x0);
+        const unsigned char *p01 = (const unsigned char *)(row0 + x1);
+        const unsigned char *p10 = (const unsigned char *)(row1 + x0);
+        const unsigned char *p11 = (const unsigned char *)(row1 + x1);
+        unsigned char *out = (unsigned char *)(pixels + i);
+
+        for (int k = 0; k < 4; k++)
+        {
+            int column0 = (p00[k]*(256 - fy) + p10[k]*fy + 128) >> 8;
+            int column1 = (p01[k]*(256 - fy) + p11[k]*fy + 128) >> 8;
+
+            out[k] = (unsigned char)((column0*(256 - fx) + column1*fx + 128) >> 8);
+        }
+    }
+}
+
+// Alpha blend source pixels (tinted) over destination pixels
+// NOTE: Opaque source pixels (no tint) are copied and transparent ones skipped, same result as blending,
+// SIMD paths blend 4 pixels at once with the same float operations (results are identical)
+static void BlendPixels(Color *dst, const Color *src, int count, Color tint)
+{
+    if (tint.a == 0) return;
+
+    bool noTint = ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255));
+
+    Vector4 fsrc, fdst, fout;   // Normalized pixel data (ready for operation)
+    Vector4 ftint = { (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f };
+
+    int i = 0;
+
+#if defined(PIXELS_SIMD_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i zeroInt = _mm_setzero_si128();
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 tintR = _mm_set1_ps(ftint.x);
+    const __m128 tintG = _mm_set1_ps(ftint.y);
+    const __m128 tintB = _mm_set1_ps(ftint.z);
+    const __m128 tintA = _mm_set1_ps(ftint.w);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i srcPixels = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i srcAlpha = _mm_srli_epi32(srcPixels, 24);
+        __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zeroInt);
+
+        if (_mm_movemask_epi8(transparent) == 0xffff) continue;
+        if (noTint && (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, mask)) == 0xffff))
+        {
+            _mm_storeu_si128((__m128i *)(dst + i), srcPixels);
+            continue;
+        }
+
+        __m128i dstPixels = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        __m128 sr = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(srcPixels, mask)), scale), tintR);
+        __m128 sg = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(srcPixels, 8), mask)), scale), tintG);
+        __m128 sb = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(srcPixels, 16), mask)), scale), tintB);
+        __m128 sa = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(srcAlpha), scale), tintA);
+
+        __m128 dr = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(dstPixels, mask)), scale);
+        __m128 dg = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(dstPixels, 8), mask)), scale);
+        __m128 db = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(dstPixels, 16), mask)), scale);
+        __m128 da = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(dstPixels, 24)), scale);
+
+        __m128 invAlpha = _mm_sub_ps(one, sa);
+        __m128 outA = _mm_add_ps(sa, _mm_mul_ps(da, invAlpha));
+        __m128 valid = _mm_cmpgt_ps(outA, zero);
+
+        __m128 outR = _mm_and_ps(_mm_div_ps(_mm_add_ps(_mm_mul_ps(sr, sa), _mm_mul_ps(_mm_mul_ps(dr, da), invAlpha)), outA), valid);
+        __m128 outG = _mm_and_ps(_mm_div_ps(_mm_add_ps(_mm_mul_ps(sg, sa), _mm_mul_ps(_mm_mul_ps(dg, da), invAlpha)), outA), valid);
+        __m128 outB = _mm_and_ps(_mm_div_ps(_mm_add_ps(_mm_mul_ps(sb, sa), _mm_mul_ps(_mm_mul_ps(db, da), invAlpha)), outA), valid);
+
+        __m128i result = _mm_or_si128(_mm_or_si128(_mm_cvttps_epi32(_mm_mul_ps(outR, scale)), _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(outG, scale)), 8)),
+                                      _mm_or_si128(_mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(outB, scale)), 16), _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(outA, scale)), 24)));
+
+        // Transparent source pixels keep destination pixels
+        result = _mm_or_si128(_mm_and_si128(transparent, dstPixels), _mm_andnot_si128(transparent, result));
+
+        _mm_storeu_si128((__m128i *)(dst + i), result);
+    }
+#elif defined(PIXELS_SIMD_NEON) && defined(__aarch64__)
+    // NOTE: Float division (vdivq_f32) is only available on AArch64, required for identical results
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    const float32x4_t tintR = vdupq_n_f32(ftint.x);
+    const float32x4_t tintG = vdupq_n_f32(ftint.y);
+    const float32x4_t tintB = vdupq_n_f32(ftint.z);
+    const float32x4_t tintA = vdupq_n_f32(ftint.w);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t srcPixels = vld1q_u32((const uint32_t *)(src + i));
+        uint32x4_t srcAlpha = vshrq_n_u32(srcPixels, 24);
+        uint32x4_t transparent = vceqq_u32(srcAlpha, vdupq_n_u32(0));
+
+        if (vmaxvq_u32(srcAlpha) == 0) continue;
+        if (noTint && (vminvq_u32(srcAlpha) == 255))
+        {
+            vst1q_u32((uint32_t *)(dst + i), srcPixels);
+            continue;
+        }
+
+        uint32x4_t dstPixels = vld1q_u32((const uint32_t *)(dst + i));
+
+        float32x4_t sr = vmulq_f32(vdivq_f32(vcvtq_f32_u32(vandq_u32(srcPixels, mask)), scale), tintR);
+        float32x4_t sg = vmulq_f32(vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(srcPixels, 8), mask)), scale), tintG);
+        float32x4_t sb = vmulq_f32(vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(srcPixels, 16), mask)), scale), tintB);
+        float32x4_t sa = vmulq_f32(vdivq_f32(vcvtq_f32_u32(srcAlpha), scale), tintA);
+
+        float32x4_t dr = vdivq_f32(vcvtq_f32_u32(vandq_u32(dstPixels, mask)), scale);
+        float32x4_t dg = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(dstPixels, 8), mask)), scale);
+        float32x4_t db = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(dstPixels, 16), mask)), scale);
+        float32x4_t da = vdivq_f32(vcvtq_f32_u32(vshrq_n_u32(dstPixels, 24)), scale);
+
+        float32x4_t invAlpha = vsubq_f32(one, sa);
+        float32x4_t outA = vaddq_f32(sa, vmulq_f32(da, invAlpha));
+        uint32x4_t valid = vcgtq_f32(outA, zero);
+
+        float32x4_t outR = vdivq_f32(vaddq_f32(vmulq_f32(sr, sa), vmulq_f32(vmulq_f32(dr, da), invAlpha)), outA);
+        float32x4_t outG = vdivq_f32(vaddq_f32(vmulq_f32(sg, sa), vmulq_f32(vmulq_f32(dg, da), invAlpha)), outA);
+        float32x4_t outB = vdivq_f32(vaddq_f32(vmulq_f32(sb, sa), vmulq_f32(vmulq_f32(db, da), invAlpha)), outA);
+
+        uint32x4_t result = vorrq_u32(vorrq_u32(vandq_u32(vcvtq_u32_f32(vmulq_f32(outR, scale)), valid),
+                                                vshlq_n_u32(vandq_u32(vcvtq_u32_f32(vmulq_f32(outG, scale)), valid), 8)),
+                                      vorrq_u32(vshlq_n_u32(vandq_u32(vcvtq_u32_f32(vmulq_f32(outB, scale)), valid), 16),
+                                                vshlq_n_u32(vcvtq_u32_f32(vmulq_f32(outA, scale)), 24)));
+
+        // Transparent source pixels keep destination pixels
+        vst1q_u32((uint32_t *)(dst + i), vbslq_u32(transparent, dstPixels, result));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (src[i].a == 0) continue;
+        if (noTint && (src[i].a == 255))
+        {
+            dst[i] = src[i];
+            continue;
+        }
+
+        // Alpha blending (https://en.wikipedia.org/wiki/Alpha_compositing)
+        fdst = (Vector4){ (float)dst[i].r/255.0f, (float)dst[i].g/255.0f, (float)dst[i].b/255.0f, (float)dst[i].a/255.0f };
+        fsrc = (Vector4){ (float)src[i].r/255.0f, (float)src[i].g/255.0f, (float)src[i].b/255.0f, (float)src[i].a/255.0f };
+
+        // Apply color tint to source image
+        fsrc.x *= ftint.x; fsrc.y *= ftint.y; fsrc.z *= ftint.z; fsrc.w *= ftint.w;
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w <= 0.0f)
+        {
+            fout.x = 0.0f;
+            fout.y = 0.0f;
+            fout.z = 0.0f;
+        }
+        else
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        dst[i] = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+
+        // TODO: Support other blending options
+    }
+}
+
+// Apply color operation to image pixels, all mipmap levels are processed
+// NOTE: Pixels ranges are processed in parallel by worker threads
+static void ProcessImageColors(Image *image, ImageColorOperation operation, const ImageColorParams *params)
+{
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Pixel data access not supported for compressed image formats");
+        return;
+    }
+
+    ImageColorData data = { *image, operation, params };
+
+    ProcessParallel(GetImagePixelsCount(*image), IMAGE_PIXELS_GRAIN_SIZE, ProcessImageColorsRange, &data);
+}
+
+// Apply color operation to image pixels range
+// NOTE: UNCOMPRESSED_R8G8B8A8 pixels are processed in place, other formats by blocks
+static void ProcessImageColorsRange(void *data, int start, int end)
+{
+    ImageColorData *colors = (ImageColorData *)data;
+    Color buffer[IMAGE_CONVERT_BLOCK_PIXELS];
+
+    while (start < end)
+    {
+        int count = end - start;
+        if ((colors->image.format != UNCOMPRESSED_R8G8B8A8) && (count > IMAGE_CONVERT_BLOCK_PIXELS)) count = IMAGE_CONVERT_BLOCK_PIXELS;
+
+        Color *pixels = ReadImagePixels(colors->image, start, count, buffer);
+        colors->operation(pixels, count, colors->params);
+        WriteImagePixels(colors->image, start, count, pixels);
+
+        start += count;
+    }
+}
+
+// Replace pixels with alpha below threshold by color
+static void AlphaClearPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    for (int i = 0; i < count; i++) if (pixels[i].a <= params->value) pixels[i] = params->color;
+}
+
+// Premultiply pixels color by alpha
+static void PremultiplyPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    float alpha = 0.0f;
+
+    for (int i = 0; i < count; i++)
+    {
+        alpha = (float)pixels[i].a/255.0f;
+        pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+        pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+        pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Tint pixels by normalized color factors
+static void TintPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    float cR = params->factor[0];
+    float cG = params->factor[1];
+    float cB = params->factor[2];
+    float cA = params->factor[3];
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i].r = (unsigned char)(255*((float)pixels[i].r/255*cR));
+        pixels[i].g = (unsigned char)(255*((float)pixels[i].g/255*cG));
+        pixels[i].b = (unsigned char)(255*((float)pixels[i].b/255*cB));
+        pixels[i].a = (unsigned char)(255*((float)pixels[i].a/255*cA));
+    }
+}
+
+// Invert pixels color
+static void InvertPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+}
+
+// Scale pixels contrast by factor
+static void ContrastPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    float contrast = params->factor[0];
+
+    for (int i = 0; i < count; i++)
+    {
+        float pR = (float)pixels[i].r/255.0f;
+        pR -= 0.5;
+        pR *= contrast;
+        pR += 0.5;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[i].g/255.0f;
+        pG -= 0.5;
+        pG *= contrast;
+        pG += 0.5;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[i].b/255.0f;
+        pB -= 0.5;
+        pB *= contrast;
+        pB += 0.5;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[i].r = (unsigned char)pR;
+        pixels[i].g = (unsigned char)pG;
+        pixels[i].b = (unsigned char)pB;
+    }
+}
+
+// Add value to pixels brightness
+static void BrightnessPixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    int brightness = params->value;
+
+    for (int i = 0; i < count; i++)
+    {
+        int cR = pixels[i].r + brightness;
+        int cG = pixels[i].g + brightness;
+        int cB = pixels[i].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[i].r = (unsigned char)cR;
+        pixels[i].g = (unsigned char)cG;
+        pixels[i].b = (unsigned char)cB;
+    }
+}
+
+// Replace pixels matching color
+static void ReplacePixels(Color *pixels, int count, const ImageColorParams *params)
+{
+    Color color = params->color;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((pixels[i].r == color.r) &&
+            (pixels[i].g == color.g) &&
+            (pixels[i].b == color.b) &&
+            (pixels[i].a == color.a)) pixels[i] = params->replace;
+    }
+}
+
+// Resize image output rows bands
+// NOTE: Every band is resized from full input image, input rows mapping is offset to band first row
+static void ResizeImageBands(void *data, int start, int end)
+{
+    ImageResizeData *resize = (ImageResizeData *)data;
+    int rowSize = resize->newWidth*resize->channels*(resize->isFloat? sizeof(float) : sizeof(unsigned char));
+
+    for (int band = start; band < end; band++)
+    {
+        int firstRow = resize->newHeight*band/resize->bandCount;
+        int rows = resize->newHeight*(band + 1)/resize->bandCount - firstRow;
+
+        stbir_resize_subpixel(resize->input, resize->width, resize->height, 0, (unsigned char *)resize->output + firstRow*rowSize, resize->newWidth, rows, 0,
+                              resize->isFloat? STBIR_TYPE_FLOAT : STBIR_TYPE_UINT8, resize->channels, STBIR_ALPHA_CHANNEL_NONE, 0,
+                              STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP, STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT, STBIR_COLORSPACE_LINEAR, NULL,
+                              (float)resize->newWidth/resize->width, (float)resize->newHeight/resize->height, 0.0f, (float)firstRow);
+    }
+}
+
+// Dither image rows (Floyd-Steinberg dithering)
+// NOTE: Before dithering a pixel, previous row must have diffused its error over the pixels modified
+// by it (up to 2 pixels ahead), rows claimed in order by worker threads progress as a wavefront
+static void DitherImageRows(void *data, int start, int end)
+{
+    #define MIN(a,b) (((a)<(b))?(a):(b))
+
+    ImageDitherData *dither = (ImageDitherData *)data;
+    Color *pixels = dither->pixels;
+    int width = dither->width;
+    int rBpp = dither->rBpp, gBpp = dither->gBpp, bBpp = dither->bBpp, aBpp = dither->aBpp;
+
+    Color oldPixel = WHITE;
+    Color newPixel = WHITE;
+
+    int rError, gError, bError;
+    unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+
+    for (int y = start; y < end; y++)
+    {
+        int ready = (y == 0)? width : 0;     // Previous row dithered pixels
+
+        for (int x = 0; x < width; x++)
+        {
+            // Wait for previous row to dither pixels up to 2 pixels ahead
+            while (ready < MIN(x + 3, width))
+            {
+                ready = IMAGE_LOAD_ACQUIRE(dither->progress[y - 1]);
+                if (ready < MIN(x + 3, width)) IMAGE_THREAD_YIELD();
+            }
+
+            oldPixel = pixels[y*width + x];
+
+            // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+            newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+            newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+            newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+            newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+
+            // NOTE: Error must be computed between new and old pixel but using same number of bits!
+            // We want to know how much color precision we have lost...
+            rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+            gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+            bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+            pixels[y*width + x] = newPixel;
+
+            // NOTE: Some cases are out of the array and should be ignored
+            if (x < (width - 1))
+            {
+                pixels[y*width + x+1].r = MIN((int)pixels[y*width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                pixels[y*width + x+1].g = MIN((int)pixels[y*width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                pixels[y*width + x+1].b = MIN((int)pixels[y*width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+            }
+
+            if ((x > 0) && (y < (dither->height - 1)))
+            {
+                pixels[(y+1)*width + x-1].r = MIN((int)pixels[(y+1)*width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].g = MIN((int)pixels[(y+1)*width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].b = MIN((int)pixels[(y+1)*width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+            }
+
+            if (y < (dither->height - 1))
+            {
+                pixels[(y+1)*width + x].r = MIN((int)pixels[(y+1)*width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].g = MIN((int)pixels[(y+1)*width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].b = MIN((int)pixels[(y+1)*width + x].b + (int)((float)bError*5.0f/16), 0xff);
+            }
+
+            if ((x < (width - 1)) && (y < (dither->height - 1)))
+            {
+                pixels[(y+1)*width + x+1].r = MIN((int)pixels[(y+1)*width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].g = MIN((int)pixels[(y+1)*width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].b = MIN((int)pixels[(y+1)*width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+            }
+
+            rPixel = (unsigned short)newPixel.r;
+            gPixel = (unsigned short)newPixel.g;
+            bPixel = (unsigned short)newPixel.b;
+            aPixel = (unsigned short)newPixel.a;
+
+            dither->output[y*width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+
+            // Publish row progress for next row
+            if ((((x + 1)%IMAGE_DITHER_SYNC_PIXELS) == 0) || (x == (width - 1))) IMAGE_STORE_RELEASE(dither->progress[y], x + 1);
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate perlin noise image rows
+static void GenPerlinNoiseRows(void *data, int start, int end)
+{
+    ImageGenData *gen = (ImageGenData *)data;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < gen->width; x++)
+        {
+            float nx = (float)(x + gen->offsetX)*gen->scale/(float)gen->width;
+            float ny = (float)(y + gen->offsetY)*gen->scale/(float)gen->height;
+
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+
+            // NOTE: We need to translate the data from [-1..1] to [0..1]
+            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
+
+            int intensity = (int)(p*255.0f);
+            gen->pixels[y*gen->width + x] = (Color){intensity, intensity, intensity, 255};
+        }
+    }
+}
+
+// Generate cellular image rows, pixels intensity is distance to nearest seed on adjacent tiles
+static void GenCellularRows(void *data, int start, int end)
+{
+    ImageGenData *gen = (ImageGenData *)data;
+    int tileSize = gen->tileSize;
+
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < gen->width; x++)
+        {
+            int tileX = x/tileSize;
+
+            float minDistance = (float)strtod("Inf", NULL);
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= gen->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= gen->seedsPerCol)) continue;
+
+                    Vector2 neighborSeed = gen->seeds[(tileY + j)*gen->seedsPerRow + tileX + i];
+
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
+            }
+
+            // I made this up but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            gen->pixels[y*gen->width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+// Load image asset (loader thread)
+static bool DecodeImageAsset(void *asset, const char *fileName)
+{
+    Image *image = (Image *)asset;
+
+    *image = LoadImage(fileName);
+
+    return (image->data != NULL);
+}
+
+// Unload image asset not retrieved
+static void UnloadImageAsset(void *asset)
+{
+    UnloadImage(*(Image *)asset);
+}
+
+// Load texture asset image (loader thread)
+static bool DecodeTextureAsset(void *asset, const char *fileName)
+{
+    TextureAsset *data = (TextureAsset *)asset;
+
+    data->image = LoadImage(fileName);
+
+    return (data->image.data != NULL);
+}
+
+// Upload texture asset image into GPU memory (main thread), image is unloaded
+static bool UploadTextureAsset(void *asset, const char *fileName)
+{
+    TextureAsset *data = (TextureAsset *)asset;
+
+    data->texture = LoadTextureFromImage(data->image);
+
+    UnloadImage(data->image);
+    data->image = (Image){ 0 };
+
+    return (data->texture.id > 0);
+}
+
+// Unload texture asset not retrieved, it could be decoded but not uploaded yet
+static void UnloadTextureAsset(void *asset)
+{
+    TextureAsset *data = (TextureAsset *)asset;
+
+    UnloadImage(data->image);
+    if (data->texture.id > 0) UnloadTexture(data->texture);
+}
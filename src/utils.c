@@ -8,6 +8,12 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_WORKER_THREADS
+*       Use a pool of worker threads to split heavy CPU processing, see ProcessParallel(),
+*       and background loader threads to read and decode assets, see PollAssetLoads()
+*       NOTE: Not available on PLATFORM_WEB, processing is done on calling thread and
+*       assets are decoded on main thread by PollAssetLoads()
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -50,8 +56,55 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(PLATFORM_WEB)
+    #undef SUPPORT_WORKER_THREADS       // Threads not available on web platform
+#endif
+
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+        // NOTE: Avoiding windows.h inclusion, it conflicts with raylib naming,
+        // SRWLOCK and CONDITION_VARIABLE are just pointer-sized opaque structures
+        typedef struct { void *ptr; } WorkerMutex;
+        typedef struct { void *ptr; } WorkerCondition;
+        typedef void *WorkerThread;
+
+        #define WORKER_MUTEX_INITIALIZER        { 0 }   // SRWLOCK_INIT
+        #define WORKER_CONDITION_INITIALIZER    { 0 }   // CONDITION_VARIABLE_INIT
+
+        __declspec(dllimport) void __stdcall InitializeSRWLock(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(WorkerMutex *lock);
+        __declspec(dllimport) void __stdcall InitializeConditionVariable(WorkerCondition *cond);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(WorkerCondition *cond, WorkerMutex *lock, unsigned long ms, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(WorkerCondition *cond);
+        __declspec(dllimport) void *__stdcall CreateThread(void *attribs, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *id);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+        #include <unistd.h>             // Required for: sysconf()
+
+        typedef pthread_mutex_t WorkerMutex;
+        typedef pthread_cond_t WorkerCondition;
+        typedef pthread_t WorkerThread;
+
+        #define WORKER_MUTEX_INITIALIZER        PTHREAD_MUTEX_INITIALIZER
+        #define WORKER_CONDITION_INITIALIZER    PTHREAD_COND_INITIALIZER
+    #endif
+
+    #if defined(_MSC_VER)
+        #define THREAD_LOCAL __declspec(thread)
+    #else
+        #define THREAD_LOCAL __thread
+    #endif
+#endif
+
 #define MAX_TRACELOG_BUFFER_SIZE   128  // Max length of one trace-log message
 
+#define MAX_WORKER_THREADS          15  // Max worker threads in the pool (calling thread also processes chunks)
+#define MAX_ASSET_LOADER_THREADS     2  // Asset loader threads, reading and decoding queued assets
+
 #define MAX_UWP_MESSAGES 512            // Max UWP messages to process
 
 //----------------------------------------------------------------------------------
@@ -67,6 +120,73 @@ static TraceLogCallback logCallback = NULL;             // Log callback function
 static AAssetManager *assetManager = NULL;              // Android assets manager pointer
 #endif
 
+#if defined(SUPPORT_WORKER_THREADS)
+// Worker threads pool, shared by all parallel processing requests
+// NOTE: Only one request is processed by the pool at a time, concurrent (or nested)
+// requests are processed directly on the calling thread. Synchronization objects are
+// statically initialized and never destroyed, pool can be closed while other threads use it
+typedef struct WorkerPool {
+    WorkerMutex mutex;                                  // Pool state access mutex
+    WorkerCondition workReady;                          // Signaled when new chunks are available (or shutdown)
+    WorkerCondition workDone;                           // Signaled when all chunks have been processed (or pool is not busy)
+
+    WorkerThread threads[MAX_WORKER_THREADS];           // Worker threads handles
+    int threadCount;                                    // Number of worker threads running
+    bool ready;                                         // Worker threads pool initialized
+    bool shutdown;                                      // Worker threads requested to exit (pool closing)
+
+    bool busy;                                          // Pool processing a request
+    ParallelProcessCallback process;                    // Current request process function
+    void *data;                                         // Current request user data
+    int count;                                          // Current request number of elements
+    int grainSize;                                      // Current request elements per chunk
+    int chunkCount;                                     // Current request number of chunks
+    int nextChunk;                                      // Next chunk to be processed
+    int chunksDone;                                     // Number of chunks already processed
+} WorkerPool;
+
+static WorkerPool workerPool = { WORKER_MUTEX_INITIALIZER, WORKER_CONDITION_INITIALIZER, WORKER_CONDITION_INITIALIZER };   // Worker threads pool
+static THREAD_LOCAL bool isAssetLoaderThread = false;   // Current thread is an asset loader thread (processing is not split)
+#endif
+static int workerThreadCount = 0;                       // Requested parallel processing threads (0 = hardware concurrency)
+
+// Asynchronous asset loading request
+typedef struct AssetLoad {
+    unsigned int id;                                    // Asset handle
+    char *fileName;                                     // Asset file name (copy)
+    int type;                                           // Asset type (AssetType)
+    int state;                                          // Asset loading state (AssetLoadState)
+    bool decoding;                                      // Asset being decoded (state is ASSET_LOAD_PENDING)
+    bool released;                                      // Asset handle released while decoding, unloaded once decoded
+    void *data;                                         // Asset data, filled by loading callbacks
+    AssetLoadCallback decode;                           // Read and decode asset data (loader thread)
+    AssetLoadCallback finalize;                         // Finalize asset loading (main thread), NULL if not required
+    AssetUnloadCallback unload;                         // Unload asset data (main thread)
+    struct AssetLoad *next;                             // Next request on loading queue
+} AssetLoad;
+
+// Asset loader, loading queue shared by loader threads and main thread
+// NOTE: Requests are only added and removed by main thread, loader threads just decode them
+typedef struct AssetLoader {
+#if defined(SUPPORT_WORKER_THREADS)
+    WorkerThread threads[MAX_ASSET_LOADER_THREADS];     // Loader threads handles
+    bool shutdown;                                      // Loader threads requested to exit
+
+    WorkerMutex mutex;                                  // Loading queue access mutex
+    WorkerCondition loadReady;                          // Signaled when new requests are queued (or shutdown)
+#endif
+    int threadCount;                                    // Number of loader threads running
+    bool ready;                                         // Asset loader initialized
+
+    AssetLoad *first;                                   // Loading queue, oldest request first
+    AssetLoad *last;                                    // Loading queue, newest request last
+    unsigned int nextId;                                // Next asset handle
+    int requested;                                      // Requests since all previous requests finished
+    int finished;                                       // Requests finished (loaded, failed or released)
+} AssetLoader;
+
+static AssetLoader assetLoader = { 0 };                 // Asynchronous asset loader
+
 #if defined(PLATFORM_UWP)
 static int UWPOutMessageId = -1;                        // Last index of output message
 static UWPMessage *UWPOutMessages[MAX_UWP_MESSAGES];    // Messages out to UWP
@@ -87,6 +207,19 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_WORKER_THREADS)
+static int InitWorkerThreads(void);                     // Initialize worker threads pool (if required), returns worker threads count, pool mutex must be locked
+static bool ProcessWorkerChunk(WorkerPool *pool);       // Process next available chunk, pool mutex must be locked
+#endif
+
+static void InitAssetLoader(void);                      // Initialize asset loader (if required), loader threads are created
+static void LockAssetLoader(AssetLoader *loader);       // Lock loading queue access (if loader threads available)
+static void UnlockAssetLoader(AssetLoader *loader);     // Unlock loading queue access (if loader threads available)
+static AssetLoad *FindAssetLoad(AssetLoader *loader, unsigned int asset);  // Find asset loading request by handle, queue must be locked
+static void DecodeAssetLoad(AssetLoader *loader, AssetLoad *load);     // Decode asset, queue must be locked (released while decoding)
+static void RemoveAssetLoad(AssetLoader *loader, AssetLoad *load);     // Remove request from loading queue, queue must be locked
+static void FreeAssetLoad(AssetLoad *load, bool unload);               // Free asset loading request, unloading asset data if required
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -290,6 +423,471 @@ void SaveFileText(const char *fileName, char *text)
     else TRACELOG(LOG_WARNING, "File name provided is not valid");
 }
 
+// Set number of threads used for parallel processing (0 = hardware concurrency, 1 = disabled)
+// NOTE: Calling thread is also used for processing, so (count - 1) worker threads are created
+void SetWorkerThreadCount(int count)
+{
+    if (count < 0) count = 0;
+    if (count > (MAX_WORKER_THREADS + 1)) count = MAX_WORKER_THREADS + 1;
+
+#if defined(SUPPORT_WORKER_THREADS)
+    WorkerPool *pool = &workerPool;
+    bool changed = false;
+
+    // NOTE: Requested count is read by pool initialization, it could happen on any thread
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->mutex);
+    changed = (count != workerThreadCount);
+    workerThreadCount = count;
+    ReleaseSRWLockExclusive(&pool->mutex);
+    #else
+    pthread_mutex_lock(&pool->mutex);
+    changed = (count != workerThreadCount);
+    workerThreadCount = count;
+    pthread_mutex_unlock(&pool->mutex);
+    #endif
+
+    if (changed) CloseWorkerThreads();  // Pool is re-created on next parallel processing request
+#else
+    workerThreadCount = count;
+#endif
+}
+
+// Get number of threads used for parallel processing (including calling thread)
+int GetWorkerThreadCount(void)
+{
+#if defined(SUPPORT_WORKER_THREADS)
+    WorkerPool *pool = &workerPool;
+
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->mutex);
+    int count = InitWorkerThreads() + 1;
+    ReleaseSRWLockExclusive(&pool->mutex);
+    #else
+    pthread_mutex_lock(&pool->mutex);
+    int count = InitWorkerThreads() + 1;
+    pthread_mutex_unlock(&pool->mutex);
+    #endif
+
+    return count;
+#else
+    return 1;
+#endif
+}
+
+// Process elements splitting them in chunks of grainSize elements between worker threads
+// NOTE: Calling thread also processes chunks and waits until all of them have been processed,
+// process function must be thread-safe and only write elements in its [start, end) range
+void ProcessParallel(int count, int grainSize, ParallelProcessCallback process, void *data)
+{
+    if ((count <= 0) || (process == NULL)) return;
+    if (grainSize < 1) grainSize = 1;
+
+#if defined(SUPPORT_WORKER_THREADS)
+    int chunkCount = (count + grainSize - 1)/grainSize;
+
+    // NOTE: Asset loader threads do not use the pool, main thread could be using it
+    if ((chunkCount > 1) && !isAssetLoaderThread)
+    {
+        WorkerPool *pool = &workerPool;
+        bool processed = false;
+
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&pool->mutex);
+    #else
+        pthread_mutex_lock(&pool->mutex);
+    #endif
+
+        // NOTE: Pool could be closing on another thread, request is processed on calling thread
+        if (!pool->busy && (InitWorkerThreads() > 0) && !pool->shutdown)
+        {
+            pool->busy = true;
+            pool->process = process;
+            pool->data = data;
+            pool->count = count;
+            pool->grainSize = grainSize;
+            pool->chunkCount = chunkCount;
+            pool->nextChunk = 0;
+            pool->chunksDone = 0;
+
+        #if defined(_WIN32)
+            WakeAllConditionVariable(&pool->workReady);
+            while (ProcessWorkerChunk(pool)) { }
+            while (pool->chunksDone < pool->chunkCount) SleepConditionVariableSRW(&pool->workDone, &pool->mutex, 0xFFFFFFFF, 0);
+        #else
+            pthread_cond_broadcast(&pool->workReady);
+            while (ProcessWorkerChunk(pool)) { }
+            while (pool->chunksDone < pool->chunkCount) pthread_cond_wait(&pool->workDone, &pool->mutex);
+        #endif
+
+            pool->busy = false;
+            pool->process = NULL;
+            pool->data = NULL;
+            processed = true;
+
+            // Pool could be waiting to be closed
+        #if defined(_WIN32)
+            WakeAllConditionVariable(&pool->workDone);
+        #else
+            pthread_cond_broadcast(&pool->workDone);
+        #endif
+        }
+
+    #if defined(_WIN32)
+        ReleaseSRWLockExclusive(&pool->mutex);
+    #else
+        pthread_mutex_unlock(&pool->mutex);
+    #endif
+
+        if (processed) return;
+    }
+#endif
+
+    // Process all elements on calling thread
+    process(data, 0, count);
+}
+
+// Close worker threads pool (if initialized)
+// NOTE: Parallel processing request in progress (on any thread) is finished before closing,
+// requests received while closing are processed on calling thread, it must not be called from a process function
+void CloseWorkerThreads(void)
+{
+#if defined(SUPPORT_WORKER_THREADS)
+    WorkerPool *pool = &workerPool;
+
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->mutex);
+
+    if (!pool->ready || pool->shutdown)
+    {
+        ReleaseSRWLockExclusive(&pool->mutex);
+        return;
+    }
+
+    while (pool->busy) SleepConditionVariableSRW(&pool->workDone, &pool->mutex, 0xFFFFFFFF, 0);
+
+    pool->shutdown = true;
+    WakeAllConditionVariable(&pool->workReady);
+    ReleaseSRWLockExclusive(&pool->mutex);
+
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+        WaitForSingleObject(pool->threads[i], 0xFFFFFFFF);
+        CloseHandle(pool->threads[i]);
+    }
+    #else
+    pthread_mutex_lock(&pool->mutex);
+
+    if (!pool->ready || pool->shutdown)
+    {
+        pthread_mutex_unlock(&pool->mutex);
+        return;
+    }
+
+    while (pool->busy) pthread_cond_wait(&pool->workDone, &pool->mutex);
+
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 0; i < pool->threadCount; i++) pthread_join(pool->threads[i], NULL);
+    #endif
+
+    if (pool->threadCount > 0) TRACELOG(LOG_INFO, "Worker threads pool closed successfully");
+
+    // Pool state is reset, it's re-created on next parallel processing request
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->mutex);
+    #else
+    pthread_mutex_lock(&pool->mutex);
+    #endif
+
+    memset(pool->threads, 0, sizeof(pool->threads));
+    pool->threadCount = 0;
+    pool->ready = false;
+    pool->shutdown = false;
+
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&pool->mutex);
+    #else
+    pthread_mutex_unlock(&pool->mutex);
+    #endif
+#endif
+}
+
+// Queue asset loading request, returns asset handle (0 if request is not valid)
+// NOTE: Request data is copied (zero initialized if NULL), asset is decoded on a loader thread
+// and finalize is called on main thread by PollAssetLoads()
+unsigned int RequestAssetLoad(const char *fileName, int type, const void *data, int size, AssetLoadCallback decode, AssetLoadCallback finalize, AssetUnloadCallback unload)
+{
+    if ((fileName == NULL) || (decode == NULL) || (size <= 0)) return 0;
+
+    InitAssetLoader();
+
+    AssetLoader *loader = &assetLoader;
+    AssetLoad *load = (AssetLoad *)RL_CALLOC(1, sizeof(AssetLoad));
+
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
+    load->type = type;
+    load->state = ASSET_LOAD_PENDING;
+    load->data = RL_CALLOC(1, size);
+    if (data != NULL) memcpy(load->data, data, size);
+    load->decode = decode;
+    load->finalize = finalize;
+    load->unload = unload;
+
+    LockAssetLoader(loader);
+
+    unsigned int id = loader->nextId++;
+    if (loader->nextId == 0) loader->nextId = 1;    // Handle 0 is not valid
+    load->id = id;
+
+    // Progress counters are restarted when all previous requests have finished
+    if (loader->finished >= loader->requested)
+    {
+        loader->requested = 0;
+        loader->finished = 0;
+    }
+
+    loader->requested++;
+
+    if (loader->last != NULL) loader->last->next = load;
+    else loader->first = load;
+    loader->last = load;
+
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&loader->loadReady);
+    #else
+    pthread_cond_broadcast(&loader->loadReady);
+    #endif
+#endif
+
+    UnlockAssetLoader(loader);
+
+    return id;
+}
+
+// Finalize decoded assets loading (i.e. GPU upload) for timeBudget seconds, returns assets still loading
+// NOTE: At least one asset is finalized per call, without loader threads assets are also decoded here
+int PollAssetLoads(float timeBudget)
+{
+    AssetLoader *loader = &assetLoader;
+    int loading = 0;
+
+    if (!loader->ready) return loading;
+
+    double startTime = GetTime();
+    bool processed = false;
+
+    LockAssetLoader(loader);
+
+    AssetLoad *load = loader->first;
+
+    while (load != NULL)
+    {
+        AssetLoad *next = load->next;   // NOTE: Requests are only added or removed by main thread
+
+        if (load->released)
+        {
+            // Asset released while decoding is unloaded once decoded
+            if (!load->decoding)
+            {
+                RemoveAssetLoad(loader, load);
+                UnlockAssetLoader(loader);
+                FreeAssetLoad(load, true);
+                LockAssetLoader(loader);
+            }
+        }
+        else
+        {
+            if ((load->state == ASSET_LOAD_PENDING) && !load->decoding && (loader->threadCount == 0) &&
+                (!processed || ((GetTime() - startTime) < timeBudget)))
+            {
+                DecodeAssetLoad(loader, load);
+                processed = true;
+            }
+
+            if ((load->state == ASSET_LOAD_DECODED) && (!processed || ((GetTime() - startTime) < timeBudget)))
+            {
+                UnlockAssetLoader(loader);
+                bool success = load->finalize(load->data, load->fileName);
+                LockAssetLoader(loader);
+
+                load->state = success? ASSET_LOAD_READY : ASSET_LOAD_FAILED;
+                loader->finished++;
+                processed = true;
+            }
+
+            if (load->state < ASSET_LOAD_READY) loading++;
+        }
+
+        load = next;
+    }
+
+    UnlockAssetLoader(loader);
+
+    return loading;
+}
+
+// Get asset loading state (AssetLoadState), ASSET_LOAD_INVALID if handle is not valid or released
+int GetAssetLoadState(unsigned int asset)
+{
+    AssetLoader *loader = &assetLoader;
+    int state = ASSET_LOAD_INVALID;
+
+    if (loader->ready)
+    {
+        LockAssetLoader(loader);
+
+        AssetLoad *load = FindAssetLoad(loader, asset);
+        if (load != NULL) state = load->state;
+
+        UnlockAssetLoader(loader);
+    }
+
+    return state;
+}
+
+// Get assets loading progress: requests finished (loaded, failed or released) of requested
+// NOTE: Counters are restarted by the first request after all previous requests have finished
+void GetAssetLoadProgress(int *loaded, int *requested)
+{
+    AssetLoader *loader = &assetLoader;
+    int finishedCount = 0;
+    int requestedCount = 0;
+
+    if (loader->ready)
+    {
+        LockAssetLoader(loader);
+        finishedCount = loader->finished;
+        requestedCount = loader->requested;
+        UnlockAssetLoader(loader);
+    }
+
+    if (loaded != NULL) *loaded = finishedCount;
+    if (requested != NULL) *requested = requestedCount;
+}
+
+// Cancel asset loading or unload loaded asset not retrieved, asset handle is released
+void UnloadAsset(unsigned int asset)
+{
+    AssetLoader *loader = &assetLoader;
+
+    if (!loader->ready) return;
+
+    LockAssetLoader(loader);
+
+    AssetLoad *load = FindAssetLoad(loader, asset);
+
+    if (load != NULL)
+    {
+        if (load->decoding)
+        {
+            load->released = true;      // Unloaded by PollAssetLoads() once decoded
+            load = NULL;
+        }
+        else RemoveAssetLoad(loader, load);
+    }
+
+    UnlockAssetLoader(loader);
+
+    if (load != NULL) FreeAssetLoad(load, true);
+}
+
+// Copy loaded asset data and release asset handle (if loading finished)
+// NOTE: Returns false if asset is not loaded yet (handle is kept) or loading failed (handle is released)
+bool TakeAssetData(unsigned int asset, int type, void *data, int size)
+{
+    AssetLoader *loader = &assetLoader;
+    AssetLoad *load = NULL;
+    int state = ASSET_LOAD_INVALID;
+
+    if (loader->ready)
+    {
+        LockAssetLoader(loader);
+
+        load = FindAssetLoad(loader, asset);
+
+        if ((load != NULL) && (load->type == type))
+        {
+            state = load->state;
+            if (state >= ASSET_LOAD_READY) RemoveAssetLoad(loader, load);
+        }
+
+        UnlockAssetLoader(loader);
+    }
+
+    if (state == ASSET_LOAD_INVALID)
+    {
+        TRACELOG(LOG_WARNING, "Asset handle %u is not valid for requested asset type", asset);
+        return false;
+    }
+    else if (state < ASSET_LOAD_READY)
+    {
+        TRACELOG(LOG_WARNING, "[%s] Asset not loaded yet, PollAssetLoads() required until ready", load->fileName);
+        return false;
+    }
+
+    if (state == ASSET_LOAD_READY) memcpy(data, load->data, size);
+    else TRACELOG(LOG_WARNING, "[%s] Asset could not be loaded", load->fileName);
+
+    FreeAssetLoad(load, (state != ASSET_LOAD_READY));
+
+    return (state == ASSET_LOAD_READY);
+}
+
+// Close asset loader threads, assets not retrieved are unloaded
+// NOTE: Loader threads finish decoding current assets before exiting
+void CloseAssetLoader(void)
+{
+    AssetLoader *loader = &assetLoader;
+
+    if (!loader->ready) return;
+
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&loader->mutex);
+    loader->shutdown = true;
+    WakeAllConditionVariable(&loader->loadReady);
+    ReleaseSRWLockExclusive(&loader->mutex);
+
+    for (int i = 0; i < loader->threadCount; i++)
+    {
+        WaitForSingleObject(loader->threads[i], 0xFFFFFFFF);
+        CloseHandle(loader->threads[i]);
+    }
+    #else
+    pthread_mutex_lock(&loader->mutex);
+    loader->shutdown = true;
+    pthread_cond_broadcast(&loader->loadReady);
+    pthread_mutex_unlock(&loader->mutex);
+
+    for (int i = 0; i < loader->threadCount; i++) pthread_join(loader->threads[i], NULL);
+
+    pthread_cond_destroy(&loader->loadReady);
+    pthread_mutex_destroy(&loader->mutex);
+    #endif
+#endif
+
+    int unloadedCount = 0;
+
+    while (loader->first != NULL)
+    {
+        AssetLoad *load = loader->first;
+        loader->first = load->next;
+
+        FreeAssetLoad(load, true);
+        unloadedCount++;
+    }
+
+    if (unloadedCount > 0) TRACELOG(LOG_WARNING, "Asset loader: %i assets not retrieved have been unloaded", unloadedCount);
+    TRACELOG(LOG_INFO, "Asset loader closed successfully");
+
+    memset(loader, 0, sizeof(AssetLoader));
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager)
@@ -403,3 +1001,283 @@ UWPMessage *GetMessageFromUWP(void)
     return NULL;
 }
 #endif  // PLATFORM_UWP
+
+#if defined(SUPPORT_WORKER_THREADS)
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Worker threads
+//----------------------------------------------------------------------------------
+
+// Process next available chunk of current request
+// NOTE: Pool mutex must be locked, it's released while chunk is processed
+static bool ProcessWorkerChunk(WorkerPool *pool)
+{
+    if (pool->nextChunk >= pool->chunkCount) return false;
+
+    int chunk = pool->nextChunk++;
+    int start = chunk*pool->grainSize;
+    int end = start + pool->grainSize;
+    if (end > pool->count) end = pool->count;
+
+    ParallelProcessCallback process = pool->process;
+    void *data = pool->data;
+
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&pool->mutex);
+    process(data, start, end);
+    AcquireSRWLockExclusive(&pool->mutex);
+
+    pool->chunksDone++;
+    if (pool->chunksDone == pool->chunkCount) WakeAllConditionVariable(&pool->workDone);
+#else
+    pthread_mutex_unlock(&pool->mutex);
+    process(data, start, end);
+    pthread_mutex_lock(&pool->mutex);
+
+    pool->chunksDone++;
+    if (pool->chunksDone == pool->chunkCount) pthread_cond_broadcast(&pool->workDone);
+#endif
+
+    return true;
+}
+
+// Worker thread main loop, wait for chunks to be available and process them
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThreadMain(void *arg)
+#else
+static void *WorkerThreadMain(void *arg)
+#endif
+{
+    WorkerPool *pool = (WorkerPool *)arg;
+
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->mutex);
+
+    while (!pool->shutdown)
+    {
+        if (!ProcessWorkerChunk(pool)) SleepConditionVariableSRW(&pool->workReady, &pool->mutex, 0xFFFFFFFF, 0);
+    }
+
+    ReleaseSRWLockExclusive(&pool->mutex);
+
+    return 0;
+#else
+    pthread_mutex_lock(&pool->mutex);
+
+    while (!pool->shutdown)
+    {
+        if (!ProcessWorkerChunk(pool)) pthread_cond_wait(&pool->workReady, &pool->mutex);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+#endif
+}
+
+// Initialize worker threads pool (if required), returns worker threads count
+// NOTE: Pool is lazily initialized on first parallel processing request, pool mutex must be locked
+// (worker threads wait for it to be released), pool is not re-created while it's being closed
+static int InitWorkerThreads(void)
+{
+    WorkerPool *pool = &workerPool;
+
+    if (pool->ready || pool->shutdown) return pool->threadCount;
+
+    int count = workerThreadCount - 1;
+
+    if (workerThreadCount == 0)
+    {
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xFFFF) - 1;   // ALL_PROCESSOR_GROUPS
+    #else
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    #endif
+    }
+
+    if (count < 0) count = 0;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+
+    pool->ready = true;
+
+    for (int i = 0; i < count; i++)
+    {
+    #if defined(_WIN32)
+        pool->threads[i] = CreateThread(NULL, 0, WorkerThreadMain, pool, 0, NULL);
+        if (pool->threads[i] == NULL) break;
+    #else
+        if (pthread_create(&pool->threads[i], NULL, WorkerThreadMain, pool) != 0) break;
+    #endif
+        pool->threadCount++;
+    }
+
+    if (pool->threadCount < count) TRACELOG(LOG_WARNING, "Only %i of %i worker threads could be created", pool->threadCount, count);
+    else if (pool->threadCount > 0) TRACELOG(LOG_INFO, "Worker threads pool initialized successfully (%i threads)", pool->threadCount);
+
+    return pool->threadCount;
+}
+#endif  // SUPPORT_WORKER_THREADS
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Asset loader
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_WORKER_THREADS)
+// Loader thread main loop, wait for requests to be queued and decode them (oldest first)
+#if defined(_WIN32)
+static unsigned long __stdcall AssetLoaderThreadMain(void *arg)
+#else
+static void *AssetLoaderThreadMain(void *arg)
+#endif
+{
+    AssetLoader *loader = (AssetLoader *)arg;
+
+    isAssetLoaderThread = true;
+
+    LockAssetLoader(loader);
+
+    while (!loader->shutdown)
+    {
+        AssetLoad *load = loader->first;
+        while ((load != NULL) && ((load->state != ASSET_LOAD_PENDING) || load->decoding)) load = load->next;
+
+        if (load != NULL) DecodeAssetLoad(loader, load);
+    #if defined(_WIN32)
+        else SleepConditionVariableSRW(&loader->loadReady, &loader->mutex, 0xFFFFFFFF, 0);
+    #else
+        else pthread_cond_wait(&loader->loadReady, &loader->mutex);
+    #endif
+    }
+
+    UnlockAssetLoader(loader);
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+#endif
+
+// Initialize asset loader (if required)
+// NOTE: Loader is lazily initialized on first asset loading request
+static void InitAssetLoader(void)
+{
+    AssetLoader *loader = &assetLoader;
+
+    if (loader->ready) return;
+
+    loader->nextId = 1;
+
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+    InitializeSRWLock(&loader->mutex);
+    InitializeConditionVariable(&loader->loadReady);
+    #else
+    pthread_mutex_init(&loader->mutex, NULL);
+    pthread_cond_init(&loader->loadReady, NULL);
+    #endif
+
+    for (int i = 0; i < MAX_ASSET_LOADER_THREADS; i++)
+    {
+    #if defined(_WIN32)
+        loader->threads[i] = CreateThread(NULL, 0, AssetLoaderThreadMain, loader, 0, NULL);
+        if (loader->threads[i] == NULL) break;
+    #else
+        if (pthread_create(&loader->threads[i], NULL, AssetLoaderThreadMain, loader) != 0) break;
+    #endif
+        loader->threadCount++;
+    }
+#endif
+
+    loader->ready = true;
+
+    if (loader->threadCount > 0) TRACELOG(LOG_INFO, "Asset loader initialized successfully (%i threads)", loader->threadCount);
+    else TRACELOG(LOG_INFO, "Asset loader initialized successfully (assets decoded on main thread)");
+}
+
+// Lock loading queue access
+// NOTE: Without loader threads, loading queue is only accessed by main thread
+static void LockAssetLoader(AssetLoader *loader)
+{
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&loader->mutex);
+    #else
+    pthread_mutex_lock(&loader->mutex);
+    #endif
+#endif
+}
+
+// Unlock loading queue access
+static void UnlockAssetLoader(AssetLoader *loader)
+{
+#if defined(SUPPORT_WORKER_THREADS)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&loader->mutex);
+    #else
+    pthread_mutex_unlock(&loader->mutex);
+    #endif
+#endif
+}
+
+// Find asset loading request by handle, released requests are not found
+static AssetLoad *FindAssetLoad(AssetLoader *loader, unsigned int asset)
+{
+    AssetLoad *load = loader->first;
+
+    while ((load != NULL) && ((load->id != asset) || load->released)) load = load->next;
+
+    return load;
+}
+
+// Decode asset on current thread
+// NOTE: Loading queue must be locked, it's unlocked while asset is decoded
+static void DecodeAssetLoad(AssetLoader *loader, AssetLoad *load)
+{
+    load->decoding = true;
+
+    UnlockAssetLoader(loader);
+    bool success = load->decode(load->data, load->fileName);
+    LockAssetLoader(loader);
+
+    load->decoding = false;
+
+    if (!success) load->state = ASSET_LOAD_FAILED;
+    else if (load->finalize != NULL) load->state = ASSET_LOAD_DECODED;
+    else load->state = ASSET_LOAD_READY;
+
+    if (load->state != ASSET_LOAD_DECODED) loader->finished++;
+}
+
+// Remove request from loading queue, requests not finished yet are counted as finished
+static void RemoveAssetLoad(AssetLoader *loader, AssetLoad *load)
+{
+    AssetLoad *prev = NULL;
+    AssetLoad *current = loader->first;
+
+    while ((current != NULL) && (current != load))
+    {
+        prev = current;
+        current = current->next;
+    }
+
+    if (current == NULL) return;
+
+    if (prev != NULL) prev->next = load->next;
+    else loader->first = load->next;
+
+    if (loader->last == load) loader->last = prev;
+
+    load->next = NULL;
+
+    if (load->state < ASSET_LOAD_READY) loader->finished++;
+}
+
+// Free asset loading request, asset data is unloaded if required (not retrieved)
+static void FreeAssetLoad(AssetLoad *load, bool unload)
+{
+    if (unload && (load->unload != NULL)) load->unload(load->data);
+
+    RL_FREE(load->data);
+    RL_FREE(load->fileName);
+    RL_FREE(load);
+}
@@ -67,6 +67,30 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
+// Parallel processing callback, process elements in range [start, end)
+typedef void (*ParallelProcessCallback)(void *data, int start, int end);
+
+void ProcessParallel(int count, int grainSize, ParallelProcessCallback process, void *data);   // Process elements splitting them in chunks between worker threads
+void CloseWorkerThreads(void);                  // Close worker threads pool (if initialized)
+
+// Asynchronous asset types, loaded asset data can only be retrieved as the requested type
+typedef enum {
+    ASSET_TYPE_IMAGE = 0,
+    ASSET_TYPE_TEXTURE,
+    ASSET_TYPE_FONT,
+    ASSET_TYPE_MODEL,
+    ASSET_TYPE_SOUND
+} AssetType;
+
+// Asynchronous asset loading callbacks, asset points to request data (copied from request)
+// NOTE: decode is called on a loader thread (CPU only), finalize and unload on main thread
+typedef bool (*AssetLoadCallback)(void *asset, const char *fileName);
+typedef void (*AssetUnloadCallback)(void *asset);
+
+unsigned int RequestAssetLoad(const char *fileName, int type, const void *data, int size, AssetLoadCallback decode, AssetLoadCallback finalize, AssetUnloadCallback unload);  // Queue asset loading request, returns asset handle
+bool TakeAssetData(unsigned int asset, int type, void *data, int size);    // Copy loaded asset data and release asset handle (if loading finished)
+void CloseAssetLoader(void);                    // Close asset loader threads, assets not retrieved are unloaded
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager);  // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);    // Replacement for fopen()